@@ -0,0 +1,8981 @@
+// Generated by tools/gentables.c with make tables, do not edit
+
+#include "bitboard.h"
+
+const uint16_t BishopPextAttacks[5248] = {
+    0x007f, 0x0001, 0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0001, 0x000f, 0x0001, 0x0003, 0x0001,
+    0x0007, 0x0001, 0x0003, 0x0001, 0x001f, 0x0001, 0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0001,
+    0x000f, 0x0001, 0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0001, 0x003f, 0x0001, 0x0003, 0x0001,
+    0x0007, 0x0001, 0x0003, 0x0001, 0x000f, 0x0001, 0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0001,
+    0x001f, 0x0001, 0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0001, 0x000f, 0x0001, 0x0003, 0x0001,
+    0x0007, 0x0001, 0x0003, 0x0001, 0x007f, 0x0003, 0x0007, 0x0003, 0x000f, 0x0003, 0x0007, 0x0003,
+    0x001f, 0x0003, 0x0007, 0x0003, 0x000f, 0x0003, 0x0007, 0x0003, 0x003f, 0x0003, 0x0007, 0x0003,
+    0x000f, 0x0003, 0x0007, 0x0003, 0x001f, 0x0003, 0x0007, 0x0003, 0x000f, 0x0003, 0x0007, 0x0003,
+    0x007f, 0x007b, 0x0007, 0x0003, 0x000f, 0x000b, 0x0007, 0x0003, 0x001f, 0x001b, 0x0007, 0x0003,
+    0x000f, 0x000b, 0x0007, 0x0003, 0x003f, 0x003b, 0x0007, 0x0003, 0x000f, 0x000b, 0x0007, 0x0003,
+    0x001f, 0x001b, 0x0007, 0x0003, 0x000f, 0x000b, 0x0007, 0x0003, 0x007f, 0x006b, 0x0017, 0x0003,
+    0x006f, 0x006b, 0x0007, 0x0003, 0x001f, 0x000b, 0x0017, 0x0003, 0x000f, 0x000b, 0x0007, 0x0003,
+    0x003f, 0x002b, 0x0017, 0x0003, 0x002f, 0x002b, 0x0007, 0x0003, 0x001f, 0x000b, 0x0017, 0x0003,
+    0x000f, 0x000b, 0x0007, 0x0003, 0x007f, 0x002b, 0x0057, 0x0003, 0x002f, 0x002b, 0x0007, 0x0003,
+    0x005f, 0x000b, 0x0057, 0x0003, 0x000f, 0x000b, 0x0007, 0x0003, 0x003f, 0x002b, 0x0017, 0x0003,
+    0x002f, 0x002b, 0x0007, 0x0003, 0x001f, 0x000b, 0x0017, 0x0003, 0x000f, 0x000b, 0x0007, 0x0003,
+    0x007f, 0x000b, 0x0077, 0x0003, 0x000f, 0x000b, 0x0007, 0x0003, 0x001f, 0x000b, 0x0017, 0x0003,
+    0x000f, 0x000b, 0x0007, 0x0003, 0x003f, 0x000b, 0x0037, 0x0003, 0x000f, 0x000b, 0x0007, 0x0003,
+    0x001f, 0x000b, 0x0017, 0x0003, 0x000f, 0x000b, 0x0007, 0x0003, 0x007f, 0x0003, 0x0007, 0x0003,
+    0x000f, 0x0003, 0x0007, 0x0003, 0x001f, 0x0003, 0x0007, 0x0003, 0x000f, 0x0003, 0x0007, 0x0003,
+    0x003f, 0x0003, 0x0007, 0x0003, 0x000f, 0x0003, 0x0007, 0x0003, 0x001f, 0x0003, 0x0007, 0x0003,
+    0x000f, 0x0003, 0x0007, 0x0003, 0x007f, 0x0001, 0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0001,
+    0x000f, 0x0001, 0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0001, 0x001f, 0x0001, 0x0003, 0x0001,
+    0x0007, 0x0001, 0x0003, 0x0001, 0x000f, 0x0001, 0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0001,
+    0x003f, 0x0001, 0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0001, 0x000f, 0x0001, 0x0003, 0x0001,
+    0x0007, 0x0001, 0x0003, 0x0001, 0x001f, 0x0001, 0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0001,
+    0x000f, 0x0001, 0x0003, 0x0001, 0x0007, 0x0001, 0x0003, 0x0001, 0x007f, 0x0003, 0x0007, 0x0003,
+    0x000f, 0x0003, 0x0007, 0x0003, 0x001f, 0x0003, 0x0007, 0x0003, 0x000f, 0x0003, 0x0007, 0x0003,
+    0x003f, 0x0003, 0x0007, 0x0003, 0x000f, 0x0003, 0x0007, 0x0003, 0x001f, 0x0003, 0x0007, 0x0003,
+    0x000f, 0x0003, 0x0007, 0x0003, 0x01ff, 0x000f, 0x001f, 0x000f, 0x003f, 0x000f, 0x001f, 0x000f,
+    0x007f, 0x000f, 0x001f, 0x000f, 0x003f, 0x000f, 0x001f, 0x000f, 0x00ff, 0x000f, 0x001f, 0x000f,
+    0x003f, 0x000f, 0x001f, 0x000f, 0x007f, 0x000f, 0x001f, 0x000f, 0x003f, 0x000f, 0x001f, 0x000f,
+    0x01ff, 0x01ef, 0x001f, 0x000f, 0x003f, 0x002f, 0x001f, 0x000f, 0x007f, 0x006f, 0x001f, 0x000f,
+    0x003f, 0x002f, 0x001f, 0x000f, 0x00ff, 0x00ef, 0x001f, 0x000f, 0x003f, 0x002f, 0x001f, 0x000f,
+    0x007f, 0x006f, 0x001f, 0x000f, 0x003f, 0x002f, 0x001f, 0x000f, 0x01ff, 0x01af, 0x005f, 0x000f,
+    0x01bf, 0x01af, 0x001f, 0x000f, 0x007f, 0x002f, 0x005f, 0x000f, 0x003f, 0x002f, 0x001f, 0x000f,
+    0x00ff, 0x00af, 0x005f, 0x000f, 0x00bf, 0x00af, 0x001f, 0x000f, 0x007f, 0x002f, 0x005f, 0x000f,
+    0x003f, 0x002f, 0x001f, 0x000f, 0x01ff, 0x00af, 0x015f, 0x000f, 0x00bf, 0x00af, 0x001f, 0x000f,
+    0x017f, 0x002f, 0x015f, 0x000f, 0x003f, 0x002f, 0x001f, 0x000f, 0x00ff, 0x00af, 0x005f, 0x000f,
+    0x00bf, 0x00af, 0x001f, 0x000f, 0x007f, 0x002f, 0x005f, 0x000f, 0x003f, 0x002f, 0x001f, 0x000f,
+    0x01ff, 0x002f, 0x01df, 0x000f, 0x003f, 0x002f, 0x001f, 0x000f, 0x007f, 0x002f, 0x005f, 0x000f,
+    0x003f, 0x002f, 0x001f, 0x000f, 0x00ff, 0x002f, 0x00df, 0x000f, 0x003f, 0x002f, 0x001f, 0x000f,
+    0x007f, 0x002f, 0x005f, 0x000f, 0x003f, 0x002f, 0x001f, 0x000f, 0x01ff, 0x000f, 0x001f, 0x000f,
+    0x003f, 0x000f, 0x001f, 0x000f, 0x007f, 0x000f, 0x001f, 0x000f, 0x003f, 0x000f, 0x001f, 0x000f,
+    0x00ff, 0x000f, 0x001f, 0x000f, 0x003f, 0x000f, 0x001f, 0x000f, 0x007f, 0x000f, 0x001f, 0x000f,
+    0x003f, 0x000f, 0x001f, 0x000f, 0x007f, 0x0003, 0x0007, 0x0003, 0x000f, 0x0003, 0x0007, 0x0003,
+    0x001f, 0x0003, 0x0007, 0x0003, 0x000f, 0x0003, 0x0007, 0x0003, 0x003f, 0x0003, 0x0007, 0x0003,
+    0x000f, 0x0003, 0x0007, 0x0003, 0x001f, 0x0003, 0x0007, 0x0003, 0x000f, 0x0003, 0x0007, 0x0003,
+    0x007f, 0x007e, 0x0007, 0x0006, 0x000f, 0x000e, 0x0007, 0x0006, 0x001f, 0x001e, 0x0007, 0x0006,
+    0x000f, 0x000e, 0x0007, 0x0006, 0x003f, 0x003e, 0x0007, 0x0006, 0x000f, 0x000e, 0x0007, 0x0006,
+    0x001f, 0x001e, 0x0007, 0x0006, 0x000f, 0x000e, 0x0007, 0x0006, 0x01ff, 0x01fe, 0x001f, 0x001e,
+    0x003f, 0x003e, 0x001f, 0x001e, 0x007f, 0x007e, 0x001f, 0x001e, 0x003f, 0x003e, 0x001f, 0x001e,
+    0x00ff, 0x00fe, 0x001f, 0x001e, 0x003f, 0x003e, 0x001f, 0x001e, 0x007f, 0x007e, 0x001f, 0x001e,
+    0x003f, 0x003e, 0x001f, 0x001e, 0x07ff, 0x07fe, 0x07fd, 0x07fc, 0x07bf, 0x07be, 0x07bd, 0x07bc,
+    0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c, 0x00ff, 0x00fe, 0x00fd, 0x00fc,
+    0x00bf, 0x00be, 0x00bd, 0x00bc, 0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01bf, 0x01be, 0x01bd, 0x01bc, 0x007f, 0x007e, 0x007d, 0x007c,
+    0x003f, 0x003e, 0x003d, 0x003c, 0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00bf, 0x00be, 0x00bd, 0x00bc,
+    0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c, 0x03ff, 0x03fe, 0x03fd, 0x03fc,
+    0x03bf, 0x03be, 0x03bd, 0x03bc, 0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00bf, 0x00be, 0x00bd, 0x00bc, 0x007f, 0x007e, 0x007d, 0x007c,
+    0x003f, 0x003e, 0x003d, 0x003c, 0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01bf, 0x01be, 0x01bd, 0x01bc,
+    0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c, 0x00ff, 0x00fe, 0x00fd, 0x00fc,
+    0x00bf, 0x00be, 0x00bd, 0x00bc, 0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x07ff, 0x07fe, 0x07fd, 0x07fc, 0x06bf, 0x06be, 0x06bd, 0x06bc, 0x017f, 0x017e, 0x017d, 0x017c,
+    0x003f, 0x003e, 0x003d, 0x003c, 0x06ff, 0x06fe, 0x06fd, 0x06fc, 0x06bf, 0x06be, 0x06bd, 0x06bc,
+    0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c, 0x01ff, 0x01fe, 0x01fd, 0x01fc,
+    0x00bf, 0x00be, 0x00bd, 0x00bc, 0x017f, 0x017e, 0x017d, 0x017c, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00bf, 0x00be, 0x00bd, 0x00bc, 0x007f, 0x007e, 0x007d, 0x007c,
+    0x003f, 0x003e, 0x003d, 0x003c, 0x03ff, 0x03fe, 0x03fd, 0x03fc, 0x02bf, 0x02be, 0x02bd, 0x02bc,
+    0x017f, 0x017e, 0x017d, 0x017c, 0x003f, 0x003e, 0x003d, 0x003c, 0x02ff, 0x02fe, 0x02fd, 0x02fc,
+    0x02bf, 0x02be, 0x02bd, 0x02bc, 0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x00bf, 0x00be, 0x00bd, 0x00bc, 0x017f, 0x017e, 0x017d, 0x017c,
+    0x003f, 0x003e, 0x003d, 0x003c, 0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00bf, 0x00be, 0x00bd, 0x00bc,
+    0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c, 0x07ff, 0x07fe, 0x07fd, 0x07fc,
+    0x02bf, 0x02be, 0x02bd, 0x02bc, 0x057f, 0x057e, 0x057d, 0x057c, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x02ff, 0x02fe, 0x02fd, 0x02fc, 0x02bf, 0x02be, 0x02bd, 0x02bc, 0x007f, 0x007e, 0x007d, 0x007c,
+    0x003f, 0x003e, 0x003d, 0x003c, 0x05ff, 0x05fe, 0x05fd, 0x05fc, 0x00bf, 0x00be, 0x00bd, 0x00bc,
+    0x057f, 0x057e, 0x057d, 0x057c, 0x003f, 0x003e, 0x003d, 0x003c, 0x00ff, 0x00fe, 0x00fd, 0x00fc,
+    0x00bf, 0x00be, 0x00bd, 0x00bc, 0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x03ff, 0x03fe, 0x03fd, 0x03fc, 0x02bf, 0x02be, 0x02bd, 0x02bc, 0x017f, 0x017e, 0x017d, 0x017c,
+    0x003f, 0x003e, 0x003d, 0x003c, 0x02ff, 0x02fe, 0x02fd, 0x02fc, 0x02bf, 0x02be, 0x02bd, 0x02bc,
+    0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c, 0x01ff, 0x01fe, 0x01fd, 0x01fc,
+    0x00bf, 0x00be, 0x00bd, 0x00bc, 0x017f, 0x017e, 0x017d, 0x017c, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00bf, 0x00be, 0x00bd, 0x00bc, 0x007f, 0x007e, 0x007d, 0x007c,
+    0x003f, 0x003e, 0x003d, 0x003c, 0x07ff, 0x07fe, 0x07fd, 0x07fc, 0x00bf, 0x00be, 0x00bd, 0x00bc,
+    0x077f, 0x077e, 0x077d, 0x077c, 0x003f, 0x003e, 0x003d, 0x003c, 0x00ff, 0x00fe, 0x00fd, 0x00fc,
+    0x00bf, 0x00be, 0x00bd, 0x00bc, 0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x00bf, 0x00be, 0x00bd, 0x00bc, 0x017f, 0x017e, 0x017d, 0x017c,
+    0x003f, 0x003e, 0x003d, 0x003c, 0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00bf, 0x00be, 0x00bd, 0x00bc,
+    0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c, 0x03ff, 0x03fe, 0x03fd, 0x03fc,
+    0x00bf, 0x00be, 0x00bd, 0x00bc, 0x037f, 0x037e, 0x037d, 0x037c, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00bf, 0x00be, 0x00bd, 0x00bc, 0x007f, 0x007e, 0x007d, 0x007c,
+    0x003f, 0x003e, 0x003d, 0x003c, 0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x00bf, 0x00be, 0x00bd, 0x00bc,
+    0x017f, 0x017e, 0x017d, 0x017c, 0x003f, 0x003e, 0x003d, 0x003c, 0x00ff, 0x00fe, 0x00fd, 0x00fc,
+    0x00bf, 0x00be, 0x00bd, 0x00bc, 0x007f, 0x007e, 0x007d, 0x007c, 0x003f, 0x003e, 0x003d, 0x003c,
+    0x01ff, 0x01fe, 0x001f, 0x001e, 0x003f, 0x003e, 0x001f, 0x001e, 0x007f, 0x007e, 0x001f, 0x001e,
+    0x003f, 0x003e, 0x001f, 0x001e, 0x00ff, 0x00fe, 0x001f, 0x001e, 0x003f, 0x003e, 0x001f, 0x001e,
+    0x007f, 0x007e, 0x001f, 0x001e, 0x003f, 0x003e, 0x001f, 0x001e, 0x007f, 0x007e, 0x0007, 0x0006,
+    0x000f, 0x000e, 0x0007, 0x0006, 0x001f, 0x001e, 0x0007, 0x0006, 0x000f, 0x000e, 0x0007, 0x0006,
+    0x003f, 0x003e, 0x0007, 0x0006, 0x000f, 0x000e, 0x0007, 0x0006, 0x001f, 0x001e, 0x0007, 0x0006,
+    0x000f, 0x000e, 0x0007, 0x0006, 0x007f, 0x007e, 0x007c, 0x007c, 0x000f, 0x000e, 0x000c, 0x000c,
+    0x001f, 0x001e, 0x001c, 0x001c, 0x000f, 0x000e, 0x000c, 0x000c, 0x003f, 0x003e, 0x003c, 0x003c,
+    0x000f, 0x000e, 0x000c, 0x000c, 0x001f, 0x001e, 0x001c, 0x001c, 0x000f, 0x000e, 0x000c, 0x000c,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x003f, 0x003e, 0x003c, 0x003c, 0x007f, 0x007e, 0x007c, 0x007c,
+    0x003f, 0x003e, 0x003c, 0x003c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x003f, 0x003e, 0x003c, 0x003c,
+    0x007f, 0x007e, 0x007c, 0x007c, 0x003f, 0x003e, 0x003c, 0x003c, 0x07ff, 0x07fe, 0x07fd, 0x07fc,
+    0x07fa, 0x07fa, 0x07f8, 0x07f8, 0x077f, 0x077e, 0x077d, 0x077c, 0x077a, 0x077a, 0x0778, 0x0778,
+    0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x007f, 0x007e, 0x007d, 0x007c,
+    0x007a, 0x007a, 0x0078, 0x0078, 0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01fa, 0x01fa, 0x01f8, 0x01f8,
+    0x017f, 0x017e, 0x017d, 0x017c, 0x017a, 0x017a, 0x0178, 0x0178, 0x00ff, 0x00fe, 0x00fd, 0x00fc,
+    0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x007f, 0x007e, 0x007d, 0x007c, 0x007a, 0x007a, 0x0078, 0x0078,
+    0x03ff, 0x03fe, 0x03fd, 0x03fc, 0x03fa, 0x03fa, 0x03f8, 0x03f8, 0x037f, 0x037e, 0x037d, 0x037c,
+    0x037a, 0x037a, 0x0378, 0x0378, 0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8,
+    0x007f, 0x007e, 0x007d, 0x007c, 0x007a, 0x007a, 0x0078, 0x0078, 0x01ff, 0x01fe, 0x01fd, 0x01fc,
+    0x01fa, 0x01fa, 0x01f8, 0x01f8, 0x017f, 0x017e, 0x017d, 0x017c, 0x017a, 0x017a, 0x0178, 0x0178,
+    0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x007f, 0x007e, 0x007d, 0x007c,
+    0x007a, 0x007a, 0x0078, 0x0078, 0x1fff, 0x1ffe, 0x1ffd, 0x1ffc, 0x1ffa, 0x1ffa, 0x1ff8, 0x1ff8,
+    0x1ff5, 0x1ff4, 0x1ff5, 0x1ff4, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1aff, 0x1afe, 0x1afd, 0x1afc,
+    0x1afa, 0x1afa, 0x1af8, 0x1af8, 0x1af5, 0x1af4, 0x1af5, 0x1af4, 0x1af0, 0x1af0, 0x1af0, 0x1af0,
+    0x05ff, 0x05fe, 0x05fd, 0x05fc, 0x05fa, 0x05fa, 0x05f8, 0x05f8, 0x05f5, 0x05f4, 0x05f5, 0x05f4,
+    0x05f0, 0x05f0, 0x05f0, 0x05f0, 0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8,
+    0x00f5, 0x00f4, 0x00f5, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x1bff, 0x1bfe, 0x1bfd, 0x1bfc,
+    0x1bfa, 0x1bfa, 0x1bf8, 0x1bf8, 0x1bf5, 0x1bf4, 0x1bf5, 0x1bf4, 0x1bf0, 0x1bf0, 0x1bf0, 0x1bf0,
+    0x1aff, 0x1afe, 0x1afd, 0x1afc, 0x1afa, 0x1afa, 0x1af8, 0x1af8, 0x1af5, 0x1af4, 0x1af5, 0x1af4,
+    0x1af0, 0x1af0, 0x1af0, 0x1af0, 0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01fa, 0x01fa, 0x01f8, 0x01f8,
+    0x01f5, 0x01f4, 0x01f5, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x00ff, 0x00fe, 0x00fd, 0x00fc,
+    0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x00f5, 0x00f4, 0x00f5, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x07ff, 0x07fe, 0x07fd, 0x07fc, 0x07fa, 0x07fa, 0x07f8, 0x07f8, 0x07f5, 0x07f4, 0x07f5, 0x07f4,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x02ff, 0x02fe, 0x02fd, 0x02fc, 0x02fa, 0x02fa, 0x02f8, 0x02f8,
+    0x02f5, 0x02f4, 0x02f5, 0x02f4, 0x02f0, 0x02f0, 0x02f0, 0x02f0, 0x05ff, 0x05fe, 0x05fd, 0x05fc,
+    0x05fa, 0x05fa, 0x05f8, 0x05f8, 0x05f5, 0x05f4, 0x05f5, 0x05f4, 0x05f0, 0x05f0, 0x05f0, 0x05f0,
+    0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x00f5, 0x00f4, 0x00f5, 0x00f4,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x03ff, 0x03fe, 0x03fd, 0x03fc, 0x03fa, 0x03fa, 0x03f8, 0x03f8,
+    0x03f5, 0x03f4, 0x03f5, 0x03f4, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x02ff, 0x02fe, 0x02fd, 0x02fc,
+    0x02fa, 0x02fa, 0x02f8, 0x02f8, 0x02f5, 0x02f4, 0x02f5, 0x02f4, 0x02f0, 0x02f0, 0x02f0, 0x02f0,
+    0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01fa, 0x01fa, 0x01f8, 0x01f8, 0x01f5, 0x01f4, 0x01f5, 0x01f4,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8,
+    0x00f5, 0x00f4, 0x00f5, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x0fff, 0x0ffe, 0x0ffd, 0x0ffc,
+    0x0ffa, 0x0ffa, 0x0ff8, 0x0ff8, 0x0ff5, 0x0ff4, 0x0ff5, 0x0ff4, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0aff, 0x0afe, 0x0afd, 0x0afc, 0x0afa, 0x0afa, 0x0af8, 0x0af8, 0x0af5, 0x0af4, 0x0af5, 0x0af4,
+    0x0af0, 0x0af0, 0x0af0, 0x0af0, 0x05ff, 0x05fe, 0x05fd, 0x05fc, 0x05fa, 0x05fa, 0x05f8, 0x05f8,
+    0x05f5, 0x05f4, 0x05f5, 0x05f4, 0x05f0, 0x05f0, 0x05f0, 0x05f0, 0x00ff, 0x00fe, 0x00fd, 0x00fc,
+    0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x00f5, 0x00f4, 0x00f5, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x0bff, 0x0bfe, 0x0bfd, 0x0bfc, 0x0bfa, 0x0bfa, 0x0bf8, 0x0bf8, 0x0bf5, 0x0bf4, 0x0bf5, 0x0bf4,
+    0x0bf0, 0x0bf0, 0x0bf0, 0x0bf0, 0x0aff, 0x0afe, 0x0afd, 0x0afc, 0x0afa, 0x0afa, 0x0af8, 0x0af8,
+    0x0af5, 0x0af4, 0x0af5, 0x0af4, 0x0af0, 0x0af0, 0x0af0, 0x0af0, 0x01ff, 0x01fe, 0x01fd, 0x01fc,
+    0x01fa, 0x01fa, 0x01f8, 0x01f8, 0x01f5, 0x01f4, 0x01f5, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x00f5, 0x00f4, 0x00f5, 0x00f4,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x07ff, 0x07fe, 0x07fd, 0x07fc, 0x07fa, 0x07fa, 0x07f8, 0x07f8,
+    0x07f5, 0x07f4, 0x07f5, 0x07f4, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x02ff, 0x02fe, 0x02fd, 0x02fc,
+    0x02fa, 0x02fa, 0x02f8, 0x02f8, 0x02f5, 0x02f4, 0x02f5, 0x02f4, 0x02f0, 0x02f0, 0x02f0, 0x02f0,
+    0x05ff, 0x05fe, 0x05fd, 0x05fc, 0x05fa, 0x05fa, 0x05f8, 0x05f8, 0x05f5, 0x05f4, 0x05f5, 0x05f4,
+    0x05f0, 0x05f0, 0x05f0, 0x05f0, 0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8,
+    0x00f5, 0x00f4, 0x00f5, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x03ff, 0x03fe, 0x03fd, 0x03fc,
+    0x03fa, 0x03fa, 0x03f8, 0x03f8, 0x03f5, 0x03f4, 0x03f5, 0x03f4, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x02ff, 0x02fe, 0x02fd, 0x02fc, 0x02fa, 0x02fa, 0x02f8, 0x02f8, 0x02f5, 0x02f4, 0x02f5, 0x02f4,
+    0x02f0, 0x02f0, 0x02f0, 0x02f0, 0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01fa, 0x01fa, 0x01f8, 0x01f8,
+    0x01f5, 0x01f4, 0x01f5, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x00ff, 0x00fe, 0x00fd, 0x00fc,
+    0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x00f5, 0x00f4, 0x00f5, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x1fff, 0x1ffe, 0x1ffd, 0x1ffc, 0x1ffa, 0x1ffa, 0x1ff8, 0x1ff8, 0x1ff5, 0x1ff4, 0x1ff5, 0x1ff4,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x0aff, 0x0afe, 0x0afd, 0x0afc, 0x0afa, 0x0afa, 0x0af8, 0x0af8,
+    0x0af5, 0x0af4, 0x0af5, 0x0af4, 0x0af0, 0x0af0, 0x0af0, 0x0af0, 0x15ff, 0x15fe, 0x15fd, 0x15fc,
+    0x15fa, 0x15fa, 0x15f8, 0x15f8, 0x15f5, 0x15f4, 0x15f5, 0x15f4, 0x15f0, 0x15f0, 0x15f0, 0x15f0,
+    0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x00f5, 0x00f4, 0x00f5, 0x00f4,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x0bff, 0x0bfe, 0x0bfd, 0x0bfc, 0x0bfa, 0x0bfa, 0x0bf8, 0x0bf8,
+    0x0bf5, 0x0bf4, 0x0bf5, 0x0bf4, 0x0bf0, 0x0bf0, 0x0bf0, 0x0bf0, 0x0aff, 0x0afe, 0x0afd, 0x0afc,
+    0x0afa, 0x0afa, 0x0af8, 0x0af8, 0x0af5, 0x0af4, 0x0af5, 0x0af4, 0x0af0, 0x0af0, 0x0af0, 0x0af0,
+    0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01fa, 0x01fa, 0x01f8, 0x01f8, 0x01f5, 0x01f4, 0x01f5, 0x01f4,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8,
+    0x00f5, 0x00f4, 0x00f5, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x17ff, 0x17fe, 0x17fd, 0x17fc,
+    0x17fa, 0x17fa, 0x17f8, 0x17f8, 0x17f5, 0x17f4, 0x17f5, 0x17f4, 0x17f0, 0x17f0, 0x17f0, 0x17f0,
+    0x02ff, 0x02fe, 0x02fd, 0x02fc, 0x02fa, 0x02fa, 0x02f8, 0x02f8, 0x02f5, 0x02f4, 0x02f5, 0x02f4,
+    0x02f0, 0x02f0, 0x02f0, 0x02f0, 0x15ff, 0x15fe, 0x15fd, 0x15fc, 0x15fa, 0x15fa, 0x15f8, 0x15f8,
+    0x15f5, 0x15f4, 0x15f5, 0x15f4, 0x15f0, 0x15f0, 0x15f0, 0x15f0, 0x00ff, 0x00fe, 0x00fd, 0x00fc,
+    0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x00f5, 0x00f4, 0x00f5, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x03ff, 0x03fe, 0x03fd, 0x03fc, 0x03fa, 0x03fa, 0x03f8, 0x03f8, 0x03f5, 0x03f4, 0x03f5, 0x03f4,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x02ff, 0x02fe, 0x02fd, 0x02fc, 0x02fa, 0x02fa, 0x02f8, 0x02f8,
+    0x02f5, 0x02f4, 0x02f5, 0x02f4, 0x02f0, 0x02f0, 0x02f0, 0x02f0, 0x01ff, 0x01fe, 0x01fd, 0x01fc,
+    0x01fa, 0x01fa, 0x01f8, 0x01f8, 0x01f5, 0x01f4, 0x01f5, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x00f5, 0x00f4, 0x00f5, 0x00f4,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x0fff, 0x0ffe, 0x0ffd, 0x0ffc, 0x0ffa, 0x0ffa, 0x0ff8, 0x0ff8,
+    0x0ff5, 0x0ff4, 0x0ff5, 0x0ff4, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0aff, 0x0afe, 0x0afd, 0x0afc,
+    0x0afa, 0x0afa, 0x0af8, 0x0af8, 0x0af5, 0x0af4, 0x0af5, 0x0af4, 0x0af0, 0x0af0, 0x0af0, 0x0af0,
+    0x05ff, 0x05fe, 0x05fd, 0x05fc, 0x05fa, 0x05fa, 0x05f8, 0x05f8, 0x05f5, 0x05f4, 0x05f5, 0x05f4,
+    0x05f0, 0x05f0, 0x05f0, 0x05f0, 0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8,
+    0x00f5, 0x00f4, 0x00f5, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x0bff, 0x0bfe, 0x0bfd, 0x0bfc,
+    0x0bfa, 0x0bfa, 0x0bf8, 0x0bf8, 0x0bf5, 0x0bf4, 0x0bf5, 0x0bf4, 0x0bf0, 0x0bf0, 0x0bf0, 0x0bf0,
+    0x0aff, 0x0afe, 0x0afd, 0x0afc, 0x0afa, 0x0afa, 0x0af8, 0x0af8, 0x0af5, 0x0af4, 0x0af5, 0x0af4,
+    0x0af0, 0x0af0, 0x0af0, 0x0af0, 0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01fa, 0x01fa, 0x01f8, 0x01f8,
+    0x01f5, 0x01f4, 0x01f5, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x00ff, 0x00fe, 0x00fd, 0x00fc,
+    0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x00f5, 0x00f4, 0x00f5, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x07ff, 0x07fe, 0x07fd, 0x07fc, 0x07fa, 0x07fa, 0x07f8, 0x07f8, 0x07f5, 0x07f4, 0x07f5, 0x07f4,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x02ff, 0x02fe, 0x02fd, 0x02fc, 0x02fa, 0x02fa, 0x02f8, 0x02f8,
+    0x02f5, 0x02f4, 0x02f5, 0x02f4, 0x02f0, 0x02f0, 0x02f0, 0x02f0, 0x05ff, 0x05fe, 0x05fd, 0x05fc,
+    0x05fa, 0x05fa, 0x05f8, 0x05f8, 0x05f5, 0x05f4, 0x05f5, 0x05f4, 0x05f0, 0x05f0, 0x05f0, 0x05f0,
+    0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8, 0x00f5, 0x00f4, 0x00f5, 0x00f4,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x03ff, 0x03fe, 0x03fd, 0x03fc, 0x03fa, 0x03fa, 0x03f8, 0x03f8,
+    0x03f5, 0x03f4, 0x03f5, 0x03f4, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x02ff, 0x02fe, 0x02fd, 0x02fc,
+    0x02fa, 0x02fa, 0x02f8, 0x02f8, 0x02f5, 0x02f4, 0x02f5, 0x02f4, 0x02f0, 0x02f0, 0x02f0, 0x02f0,
+    0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01fa, 0x01fa, 0x01f8, 0x01f8, 0x01f5, 0x01f4, 0x01f5, 0x01f4,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x00ff, 0x00fe, 0x00fd, 0x00fc, 0x00fa, 0x00fa, 0x00f8, 0x00f8,
+    0x00f5, 0x00f4, 0x00f5, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07fb, 0x07fa, 0x07f8, 0x07f8, 0x017f, 0x017e, 0x017c, 0x017c, 0x017b, 0x017a, 0x0178, 0x0178,
+    0x06ff, 0x06fe, 0x06fc, 0x06fc, 0x06fb, 0x06fa, 0x06f8, 0x06f8, 0x007f, 0x007e, 0x007c, 0x007c,
+    0x007b, 0x007a, 0x0078, 0x0078, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01fb, 0x01fa, 0x01f8, 0x01f8,
+    0x017f, 0x017e, 0x017c, 0x017c, 0x017b, 0x017a, 0x0178, 0x0178, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00fb, 0x00fa, 0x00f8, 0x00f8, 0x007f, 0x007e, 0x007c, 0x007c, 0x007b, 0x007a, 0x0078, 0x0078,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03fb, 0x03fa, 0x03f8, 0x03f8, 0x017f, 0x017e, 0x017c, 0x017c,
+    0x017b, 0x017a, 0x0178, 0x0178, 0x02ff, 0x02fe, 0x02fc, 0x02fc, 0x02fb, 0x02fa, 0x02f8, 0x02f8,
+    0x007f, 0x007e, 0x007c, 0x007c, 0x007b, 0x007a, 0x0078, 0x0078, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01fb, 0x01fa, 0x01f8, 0x01f8, 0x017f, 0x017e, 0x017c, 0x017c, 0x017b, 0x017a, 0x0178, 0x0178,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00fb, 0x00fa, 0x00f8, 0x00f8, 0x007f, 0x007e, 0x007c, 0x007c,
+    0x007b, 0x007a, 0x0078, 0x0078, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x003f, 0x003e, 0x003c, 0x003c,
+    0x007f, 0x007e, 0x007c, 0x007c, 0x003f, 0x003e, 0x003c, 0x003c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x003f, 0x003e, 0x003c, 0x003c, 0x007f, 0x007e, 0x007c, 0x007c, 0x003f, 0x003e, 0x003c, 0x003c,
+    0x007f, 0x007e, 0x007c, 0x007c, 0x000f, 0x000e, 0x000c, 0x000c, 0x001f, 0x001e, 0x001c, 0x001c,
+    0x000f, 0x000e, 0x000c, 0x000c, 0x003f, 0x003e, 0x003c, 0x003c, 0x000f, 0x000e, 0x000c, 0x000c,
+    0x001f, 0x001e, 0x001c, 0x001c, 0x000f, 0x000e, 0x000c, 0x000c, 0x007f, 0x007e, 0x007c, 0x007c,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x001f, 0x001e, 0x001c, 0x001c, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x003f, 0x003e, 0x003c, 0x003c, 0x0038, 0x0038, 0x0038, 0x0038, 0x001f, 0x001e, 0x001c, 0x001c,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x007f, 0x007e, 0x007c, 0x007c, 0x0078, 0x0078, 0x0078, 0x0078, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x007f, 0x007e, 0x007c, 0x007c, 0x0078, 0x0078, 0x0078, 0x0078,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07fb, 0x07fa, 0x07f8, 0x07f8, 0x07f4, 0x07f4, 0x07f4, 0x07f4,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x06ff, 0x06fe, 0x06fc, 0x06fc, 0x06fb, 0x06fa, 0x06f8, 0x06f8,
+    0x06f4, 0x06f4, 0x06f4, 0x06f4, 0x06f0, 0x06f0, 0x06f0, 0x06f0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01fb, 0x01fa, 0x01f8, 0x01f8, 0x01f4, 0x01f4, 0x01f4, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00fb, 0x00fa, 0x00f8, 0x00f8, 0x00f4, 0x00f4, 0x00f4, 0x00f4,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03fb, 0x03fa, 0x03f8, 0x03f8,
+    0x03f4, 0x03f4, 0x03f4, 0x03f4, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x02ff, 0x02fe, 0x02fc, 0x02fc,
+    0x02fb, 0x02fa, 0x02f8, 0x02f8, 0x02f4, 0x02f4, 0x02f4, 0x02f4, 0x02f0, 0x02f0, 0x02f0, 0x02f0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01fb, 0x01fa, 0x01f8, 0x01f8, 0x01f4, 0x01f4, 0x01f4, 0x01f4,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00fb, 0x00fa, 0x00f8, 0x00f8,
+    0x00f4, 0x00f4, 0x00f4, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x1fff, 0x1ffe, 0x1ffd, 0x1ffc,
+    0x1ffa, 0x1ffa, 0x1ff8, 0x1ff8, 0x1ff5, 0x1ff4, 0x1ff5, 0x1ff4, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0,
+    0x1fea, 0x1fea, 0x1fe8, 0x1fe8, 0x1fea, 0x1fea, 0x1fe8, 0x1fe8, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x15ff, 0x15fe, 0x15fd, 0x15fc, 0x15fa, 0x15fa, 0x15f8, 0x15f8,
+    0x15f5, 0x15f4, 0x15f5, 0x15f4, 0x15f0, 0x15f0, 0x15f0, 0x15f0, 0x15ea, 0x15ea, 0x15e8, 0x15e8,
+    0x15ea, 0x15ea, 0x15e8, 0x15e8, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0,
+    0x0bff, 0x0bfe, 0x0bfd, 0x0bfc, 0x0bfa, 0x0bfa, 0x0bf8, 0x0bf8, 0x0bf5, 0x0bf4, 0x0bf5, 0x0bf4,
+    0x0bf0, 0x0bf0, 0x0bf0, 0x0bf0, 0x0bea, 0x0bea, 0x0be8, 0x0be8, 0x0bea, 0x0bea, 0x0be8, 0x0be8,
+    0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x01ff, 0x01fe, 0x01fd, 0x01fc,
+    0x01fa, 0x01fa, 0x01f8, 0x01f8, 0x01f5, 0x01f4, 0x01f5, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01ea, 0x01ea, 0x01e8, 0x01e8, 0x01ea, 0x01ea, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x17ff, 0x17fe, 0x17fd, 0x17fc, 0x17fa, 0x17fa, 0x17f8, 0x17f8,
+    0x17f5, 0x17f4, 0x17f5, 0x17f4, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17ea, 0x17ea, 0x17e8, 0x17e8,
+    0x17ea, 0x17ea, 0x17e8, 0x17e8, 0x17e0, 0x17e0, 0x17e0, 0x17e0, 0x17e0, 0x17e0, 0x17e0, 0x17e0,
+    0x15ff, 0x15fe, 0x15fd, 0x15fc, 0x15fa, 0x15fa, 0x15f8, 0x15f8, 0x15f5, 0x15f4, 0x15f5, 0x15f4,
+    0x15f0, 0x15f0, 0x15f0, 0x15f0, 0x15ea, 0x15ea, 0x15e8, 0x15e8, 0x15ea, 0x15ea, 0x15e8, 0x15e8,
+    0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x03ff, 0x03fe, 0x03fd, 0x03fc,
+    0x03fa, 0x03fa, 0x03f8, 0x03f8, 0x03f5, 0x03f4, 0x03f5, 0x03f4, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03ea, 0x03ea, 0x03e8, 0x03e8, 0x03ea, 0x03ea, 0x03e8, 0x03e8, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01fa, 0x01fa, 0x01f8, 0x01f8,
+    0x01f5, 0x01f4, 0x01f5, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01ea, 0x01ea, 0x01e8, 0x01e8,
+    0x01ea, 0x01ea, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x0fff, 0x0ffe, 0x0ffd, 0x0ffc, 0x0ffa, 0x0ffa, 0x0ff8, 0x0ff8, 0x0ff5, 0x0ff4, 0x0ff5, 0x0ff4,
+    0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0fea, 0x0fea, 0x0fe8, 0x0fe8, 0x0fea, 0x0fea, 0x0fe8, 0x0fe8,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x05ff, 0x05fe, 0x05fd, 0x05fc,
+    0x05fa, 0x05fa, 0x05f8, 0x05f8, 0x05f5, 0x05f4, 0x05f5, 0x05f4, 0x05f0, 0x05f0, 0x05f0, 0x05f0,
+    0x05ea, 0x05ea, 0x05e8, 0x05e8, 0x05ea, 0x05ea, 0x05e8, 0x05e8, 0x05e0, 0x05e0, 0x05e0, 0x05e0,
+    0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0bff, 0x0bfe, 0x0bfd, 0x0bfc, 0x0bfa, 0x0bfa, 0x0bf8, 0x0bf8,
+    0x0bf5, 0x0bf4, 0x0bf5, 0x0bf4, 0x0bf0, 0x0bf0, 0x0bf0, 0x0bf0, 0x0bea, 0x0bea, 0x0be8, 0x0be8,
+    0x0bea, 0x0bea, 0x0be8, 0x0be8, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0,
+    0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01fa, 0x01fa, 0x01f8, 0x01f8, 0x01f5, 0x01f4, 0x01f5, 0x01f4,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01ea, 0x01ea, 0x01e8, 0x01e8, 0x01ea, 0x01ea, 0x01e8, 0x01e8,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x07ff, 0x07fe, 0x07fd, 0x07fc,
+    0x07fa, 0x07fa, 0x07f8, 0x07f8, 0x07f5, 0x07f4, 0x07f5, 0x07f4, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07ea, 0x07ea, 0x07e8, 0x07e8, 0x07ea, 0x07ea, 0x07e8, 0x07e8, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x05ff, 0x05fe, 0x05fd, 0x05fc, 0x05fa, 0x05fa, 0x05f8, 0x05f8,
+    0x05f5, 0x05f4, 0x05f5, 0x05f4, 0x05f0, 0x05f0, 0x05f0, 0x05f0, 0x05ea, 0x05ea, 0x05e8, 0x05e8,
+    0x05ea, 0x05ea, 0x05e8, 0x05e8, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0,
+    0x03ff, 0x03fe, 0x03fd, 0x03fc, 0x03fa, 0x03fa, 0x03f8, 0x03f8, 0x03f5, 0x03f4, 0x03f5, 0x03f4,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03ea, 0x03ea, 0x03e8, 0x03e8, 0x03ea, 0x03ea, 0x03e8, 0x03e8,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x01ff, 0x01fe, 0x01fd, 0x01fc,
+    0x01fa, 0x01fa, 0x01f8, 0x01f8, 0x01f5, 0x01f4, 0x01f5, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01ea, 0x01ea, 0x01e8, 0x01e8, 0x01ea, 0x01ea, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ffb, 0x1ffa, 0x1ff8, 0x1ff8,
+    0x1ff4, 0x1ff4, 0x1ff4, 0x1ff4, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1feb, 0x1fea, 0x1fe8, 0x1fe8,
+    0x1feb, 0x1fea, 0x1fe8, 0x1fe8, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x15ff, 0x15fe, 0x15fc, 0x15fc, 0x15fb, 0x15fa, 0x15f8, 0x15f8, 0x15f4, 0x15f4, 0x15f4, 0x15f4,
+    0x15f0, 0x15f0, 0x15f0, 0x15f0, 0x15eb, 0x15ea, 0x15e8, 0x15e8, 0x15eb, 0x15ea, 0x15e8, 0x15e8,
+    0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x0bff, 0x0bfe, 0x0bfc, 0x0bfc,
+    0x0bfb, 0x0bfa, 0x0bf8, 0x0bf8, 0x0bf4, 0x0bf4, 0x0bf4, 0x0bf4, 0x0bf0, 0x0bf0, 0x0bf0, 0x0bf0,
+    0x0beb, 0x0bea, 0x0be8, 0x0be8, 0x0beb, 0x0bea, 0x0be8, 0x0be8, 0x0be0, 0x0be0, 0x0be0, 0x0be0,
+    0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01fb, 0x01fa, 0x01f8, 0x01f8,
+    0x01f4, 0x01f4, 0x01f4, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01eb, 0x01ea, 0x01e8, 0x01e8,
+    0x01eb, 0x01ea, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x17ff, 0x17fe, 0x17fc, 0x17fc, 0x17fb, 0x17fa, 0x17f8, 0x17f8, 0x17f4, 0x17f4, 0x17f4, 0x17f4,
+    0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17eb, 0x17ea, 0x17e8, 0x17e8, 0x17eb, 0x17ea, 0x17e8, 0x17e8,
+    0x17e0, 0x17e0, 0x17e0, 0x17e0, 0x17e0, 0x17e0, 0x17e0, 0x17e0, 0x15ff, 0x15fe, 0x15fc, 0x15fc,
+    0x15fb, 0x15fa, 0x15f8, 0x15f8, 0x15f4, 0x15f4, 0x15f4, 0x15f4, 0x15f0, 0x15f0, 0x15f0, 0x15f0,
+    0x15eb, 0x15ea, 0x15e8, 0x15e8, 0x15eb, 0x15ea, 0x15e8, 0x15e8, 0x15e0, 0x15e0, 0x15e0, 0x15e0,
+    0x15e0, 0x15e0, 0x15e0, 0x15e0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03fb, 0x03fa, 0x03f8, 0x03f8,
+    0x03f4, 0x03f4, 0x03f4, 0x03f4, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03eb, 0x03ea, 0x03e8, 0x03e8,
+    0x03eb, 0x03ea, 0x03e8, 0x03e8, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01fb, 0x01fa, 0x01f8, 0x01f8, 0x01f4, 0x01f4, 0x01f4, 0x01f4,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01eb, 0x01ea, 0x01e8, 0x01e8, 0x01eb, 0x01ea, 0x01e8, 0x01e8,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ffb, 0x0ffa, 0x0ff8, 0x0ff8, 0x0ff4, 0x0ff4, 0x0ff4, 0x0ff4, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0feb, 0x0fea, 0x0fe8, 0x0fe8, 0x0feb, 0x0fea, 0x0fe8, 0x0fe8, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05fb, 0x05fa, 0x05f8, 0x05f8,
+    0x05f4, 0x05f4, 0x05f4, 0x05f4, 0x05f0, 0x05f0, 0x05f0, 0x05f0, 0x05eb, 0x05ea, 0x05e8, 0x05e8,
+    0x05eb, 0x05ea, 0x05e8, 0x05e8, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0,
+    0x0bff, 0x0bfe, 0x0bfc, 0x0bfc, 0x0bfb, 0x0bfa, 0x0bf8, 0x0bf8, 0x0bf4, 0x0bf4, 0x0bf4, 0x0bf4,
+    0x0bf0, 0x0bf0, 0x0bf0, 0x0bf0, 0x0beb, 0x0bea, 0x0be8, 0x0be8, 0x0beb, 0x0bea, 0x0be8, 0x0be8,
+    0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x0be0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01fb, 0x01fa, 0x01f8, 0x01f8, 0x01f4, 0x01f4, 0x01f4, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01eb, 0x01ea, 0x01e8, 0x01e8, 0x01eb, 0x01ea, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07fb, 0x07fa, 0x07f8, 0x07f8,
+    0x07f4, 0x07f4, 0x07f4, 0x07f4, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07eb, 0x07ea, 0x07e8, 0x07e8,
+    0x07eb, 0x07ea, 0x07e8, 0x07e8, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05fb, 0x05fa, 0x05f8, 0x05f8, 0x05f4, 0x05f4, 0x05f4, 0x05f4,
+    0x05f0, 0x05f0, 0x05f0, 0x05f0, 0x05eb, 0x05ea, 0x05e8, 0x05e8, 0x05eb, 0x05ea, 0x05e8, 0x05e8,
+    0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03fb, 0x03fa, 0x03f8, 0x03f8, 0x03f4, 0x03f4, 0x03f4, 0x03f4, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03eb, 0x03ea, 0x03e8, 0x03e8, 0x03eb, 0x03ea, 0x03e8, 0x03e8, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01fb, 0x01fa, 0x01f8, 0x01f8,
+    0x01f4, 0x01f4, 0x01f4, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01eb, 0x01ea, 0x01e8, 0x01e8,
+    0x01eb, 0x01ea, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f7, 0x07f6, 0x07f4, 0x07f4,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x02ff, 0x02fe, 0x02fc, 0x02fc, 0x02f8, 0x02f8, 0x02f8, 0x02f8,
+    0x02f7, 0x02f6, 0x02f4, 0x02f4, 0x02f0, 0x02f0, 0x02f0, 0x02f0, 0x05ff, 0x05fe, 0x05fc, 0x05fc,
+    0x05f8, 0x05f8, 0x05f8, 0x05f8, 0x05f7, 0x05f6, 0x05f4, 0x05f4, 0x05f0, 0x05f0, 0x05f0, 0x05f0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f7, 0x00f6, 0x00f4, 0x00f4,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f7, 0x03f6, 0x03f4, 0x03f4, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x02ff, 0x02fe, 0x02fc, 0x02fc,
+    0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x02f7, 0x02f6, 0x02f4, 0x02f4, 0x02f0, 0x02f0, 0x02f0, 0x02f0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f7, 0x01f6, 0x01f4, 0x01f4,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f7, 0x00f6, 0x00f4, 0x00f4, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x007f, 0x007e, 0x007c, 0x007c, 0x0078, 0x0078, 0x0078, 0x0078,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x007f, 0x007e, 0x007c, 0x007c,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x007f, 0x007e, 0x007c, 0x007c, 0x0078, 0x0078, 0x0078, 0x0078,
+    0x001f, 0x001e, 0x001c, 0x001c, 0x0018, 0x0018, 0x0018, 0x0018, 0x003f, 0x003e, 0x003c, 0x003c,
+    0x0038, 0x0038, 0x0038, 0x0038, 0x001f, 0x001e, 0x001c, 0x001c, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x007f, 0x007e, 0x007c, 0x007c, 0x0078, 0x0078, 0x0078, 0x0078, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x003f, 0x003e, 0x003c, 0x003c, 0x0038, 0x0038, 0x0038, 0x0038,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e8, 0x07e8, 0x07e8, 0x07e8,
+    0x07e8, 0x07e8, 0x07e8, 0x07e8, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f8, 0x05f8, 0x05f8, 0x05f8, 0x05f7, 0x05f6, 0x05f4, 0x05f4,
+    0x05f0, 0x05f0, 0x05f0, 0x05f0, 0x05e8, 0x05e8, 0x05e8, 0x05e8, 0x05e8, 0x05e8, 0x05e8, 0x05e8,
+    0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f7, 0x03f6, 0x03f4, 0x03f4, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e8, 0x03e8, 0x03e8, 0x03e8, 0x03e8, 0x03e8, 0x03e8, 0x03e8, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f7, 0x01f6, 0x01f4, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e8, 0x01e8, 0x01e8, 0x01e8,
+    0x01e8, 0x01e8, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x07ff, 0x07fe, 0x07fd, 0x07fc, 0x07fa, 0x07fa, 0x07f8, 0x07f8, 0x07f5, 0x07f4, 0x07f5, 0x07f4,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07ea, 0x07ea, 0x07e8, 0x07e8, 0x07ea, 0x07ea, 0x07e8, 0x07e8,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x05ff, 0x05fe, 0x05fd, 0x05fc,
+    0x05fa, 0x05fa, 0x05f8, 0x05f8, 0x05f5, 0x05f4, 0x05f5, 0x05f4, 0x05f0, 0x05f0, 0x05f0, 0x05f0,
+    0x05ea, 0x05ea, 0x05e8, 0x05e8, 0x05ea, 0x05ea, 0x05e8, 0x05e8, 0x05e0, 0x05e0, 0x05e0, 0x05e0,
+    0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x03ff, 0x03fe, 0x03fd, 0x03fc, 0x03fa, 0x03fa, 0x03f8, 0x03f8,
+    0x03f5, 0x03f4, 0x03f5, 0x03f4, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03ea, 0x03ea, 0x03e8, 0x03e8,
+    0x03ea, 0x03ea, 0x03e8, 0x03e8, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01fa, 0x01fa, 0x01f8, 0x01f8, 0x01f5, 0x01f4, 0x01f5, 0x01f4,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01ea, 0x01ea, 0x01e8, 0x01e8, 0x01ea, 0x01ea, 0x01e8, 0x01e8,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07fb, 0x07fa, 0x07f8, 0x07f8, 0x07f4, 0x07f4, 0x07f4, 0x07f4, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07eb, 0x07ea, 0x07e8, 0x07e8, 0x07eb, 0x07ea, 0x07e8, 0x07e8, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05fb, 0x05fa, 0x05f8, 0x05f8,
+    0x05f4, 0x05f4, 0x05f4, 0x05f4, 0x05f0, 0x05f0, 0x05f0, 0x05f0, 0x05eb, 0x05ea, 0x05e8, 0x05e8,
+    0x05eb, 0x05ea, 0x05e8, 0x05e8, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03fb, 0x03fa, 0x03f8, 0x03f8, 0x03f4, 0x03f4, 0x03f4, 0x03f4,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03eb, 0x03ea, 0x03e8, 0x03e8, 0x03eb, 0x03ea, 0x03e8, 0x03e8,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01fb, 0x01fa, 0x01f8, 0x01f8, 0x01f4, 0x01f4, 0x01f4, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01eb, 0x01ea, 0x01e8, 0x01e8, 0x01eb, 0x01ea, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07ef, 0x07ee, 0x07ec, 0x07ec,
+    0x07e8, 0x07e8, 0x07e8, 0x07e8, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f8, 0x05f8, 0x05f8, 0x05f8, 0x05f0, 0x05f0, 0x05f0, 0x05f0,
+    0x05f0, 0x05f0, 0x05f0, 0x05f0, 0x05ef, 0x05ee, 0x05ec, 0x05ec, 0x05e8, 0x05e8, 0x05e8, 0x05e8,
+    0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03ef, 0x03ee, 0x03ec, 0x03ec, 0x03e8, 0x03e8, 0x03e8, 0x03e8, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01ef, 0x01ee, 0x01ec, 0x01ec,
+    0x01e8, 0x01e8, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x007f, 0x007e, 0x007c, 0x007c,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x003f, 0x003e, 0x003c, 0x003c, 0x0038, 0x0038, 0x0038, 0x0038, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x007f, 0x007e, 0x007c, 0x007c, 0x0078, 0x0078, 0x0078, 0x0078,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f7, 0x01f6, 0x01f4, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e8, 0x01e8, 0x01e8, 0x01e8, 0x01e8, 0x01e8, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01ff, 0x01fe, 0x01fd, 0x01fc, 0x01fa, 0x01fa, 0x01f8, 0x01f8,
+    0x01f5, 0x01f4, 0x01f5, 0x01f4, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01ea, 0x01ea, 0x01e8, 0x01e8,
+    0x01ea, 0x01ea, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01fb, 0x01fa, 0x01f8, 0x01f8, 0x01f4, 0x01f4, 0x01f4, 0x01f4,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01eb, 0x01ea, 0x01e8, 0x01e8, 0x01eb, 0x01ea, 0x01e8, 0x01e8,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01ef, 0x01ee, 0x01ec, 0x01ec, 0x01e8, 0x01e8, 0x01e8, 0x01e8, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x007f, 0x007e, 0x007c, 0x007c, 0x0078, 0x0078, 0x0078, 0x0078, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x007f, 0x007e, 0x007c, 0x007c,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x007f, 0x007e, 0x007c, 0x007c, 0x0078, 0x0078, 0x0078, 0x0078, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x007f, 0x007e, 0x007c, 0x007c,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x0077, 0x0076, 0x0074, 0x0074, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x007f, 0x007e, 0x007d, 0x007c, 0x007a, 0x007a, 0x0078, 0x0078,
+    0x0075, 0x0074, 0x0075, 0x0074, 0x0070, 0x0070, 0x0070, 0x0070, 0x006a, 0x006a, 0x0068, 0x0068,
+    0x006a, 0x006a, 0x0068, 0x0068, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x007f, 0x007e, 0x007c, 0x007c, 0x007b, 0x007a, 0x0078, 0x0078, 0x0074, 0x0074, 0x0074, 0x0074,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x006b, 0x006a, 0x0068, 0x0068, 0x006b, 0x006a, 0x0068, 0x0068,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x007f, 0x007e, 0x007c, 0x007c,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x006f, 0x006e, 0x006c, 0x006c, 0x0068, 0x0068, 0x0068, 0x0068, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x007f, 0x007e, 0x007c, 0x007c, 0x0078, 0x0078, 0x0078, 0x0078,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x007f, 0x007e, 0x007c, 0x007c, 0x0078, 0x0078, 0x0078, 0x0078, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040,
+};
+
+const uint16_t RookPextAttacks[102400] = {
+    0x3fff, 0x3f81, 0x3f83, 0x3f81, 0x3f87, 0x3f81, 0x3f83, 0x3f81, 0x3f8f, 0x3f81, 0x3f83, 0x3f81,
+    0x3f87, 0x3f81, 0x3f83, 0x3f81, 0x3f9f, 0x3f81, 0x3f83, 0x3f81, 0x3f87, 0x3f81, 0x3f83, 0x3f81,
+    0x3f8f, 0x3f81, 0x3f83, 0x3f81, 0x3f87, 0x3f81, 0x3f83, 0x3f81, 0x3fbf, 0x3f81, 0x3f83, 0x3f81,
+    0x3f87, 0x3f81, 0x3f83, 0x3f81, 0x3f8f, 0x3f81, 0x3f83, 0x3f81, 0x3f87, 0x3f81, 0x3f83, 0x3f81,
+    0x3f9f, 0x3f81, 0x3f83, 0x3f81, 0x3f87, 0x3f81, 0x3f83, 0x3f81, 0x3f8f, 0x3f81, 0x3f83, 0x3f81,
+    0x3f87, 0x3f81, 0x3f83, 0x3f81, 0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x01ff, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x01bf, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x03ff, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x039f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x03bf, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x039f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x00ff, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x01ff, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x01bf, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x07ff, 0x0781, 0x0783, 0x0781,
+    0x0787, 0x0781, 0x0783, 0x0781, 0x078f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781,
+    0x079f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781, 0x078f, 0x0781, 0x0783, 0x0781,
+    0x0787, 0x0781, 0x0783, 0x0781, 0x07bf, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781,
+    0x078f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781, 0x079f, 0x0781, 0x0783, 0x0781,
+    0x0787, 0x0781, 0x0783, 0x0781, 0x078f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781,
+    0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x01ff, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x01bf, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x00ff, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x03ff, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x039f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x03bf, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x039f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x01ff, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x01bf, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x0fff, 0x0f81, 0x0f83, 0x0f81, 0x0f87, 0x0f81, 0x0f83, 0x0f81,
+    0x0f8f, 0x0f81, 0x0f83, 0x0f81, 0x0f87, 0x0f81, 0x0f83, 0x0f81, 0x0f9f, 0x0f81, 0x0f83, 0x0f81,
+    0x0f87, 0x0f81, 0x0f83, 0x0f81, 0x0f8f, 0x0f81, 0x0f83, 0x0f81, 0x0f87, 0x0f81, 0x0f83, 0x0f81,
+    0x0fbf, 0x0f81, 0x0f83, 0x0f81, 0x0f87, 0x0f81, 0x0f83, 0x0f81, 0x0f8f, 0x0f81, 0x0f83, 0x0f81,
+    0x0f87, 0x0f81, 0x0f83, 0x0f81, 0x0f9f, 0x0f81, 0x0f83, 0x0f81, 0x0f87, 0x0f81, 0x0f83, 0x0f81,
+    0x0f8f, 0x0f81, 0x0f83, 0x0f81, 0x0f87, 0x0f81, 0x0f83, 0x0f81, 0x00ff, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x01ff, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x01bf, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x03ff, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x039f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x03bf, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x039f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x01ff, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x01bf, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x00ff, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x07ff, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781, 0x078f, 0x0781, 0x0783, 0x0781,
+    0x0787, 0x0781, 0x0783, 0x0781, 0x079f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781,
+    0x078f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781, 0x07bf, 0x0781, 0x0783, 0x0781,
+    0x0787, 0x0781, 0x0783, 0x0781, 0x078f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781,
+    0x079f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781, 0x078f, 0x0781, 0x0783, 0x0781,
+    0x0787, 0x0781, 0x0783, 0x0781, 0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x01ff, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x01bf, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x03ff, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x039f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x03bf, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x039f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x00ff, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x01ff, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x01bf, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x1fff, 0x1f81, 0x1f83, 0x1f81,
+    0x1f87, 0x1f81, 0x1f83, 0x1f81, 0x1f8f, 0x1f81, 0x1f83, 0x1f81, 0x1f87, 0x1f81, 0x1f83, 0x1f81,
+    0x1f9f, 0x1f81, 0x1f83, 0x1f81, 0x1f87, 0x1f81, 0x1f83, 0x1f81, 0x1f8f, 0x1f81, 0x1f83, 0x1f81,
+    0x1f87, 0x1f81, 0x1f83, 0x1f81, 0x1fbf, 0x1f81, 0x1f83, 0x1f81, 0x1f87, 0x1f81, 0x1f83, 0x1f81,
+    0x1f8f, 0x1f81, 0x1f83, 0x1f81, 0x1f87, 0x1f81, 0x1f83, 0x1f81, 0x1f9f, 0x1f81, 0x1f83, 0x1f81,
+    0x1f87, 0x1f81, 0x1f83, 0x1f81, 0x1f8f, 0x1f81, 0x1f83, 0x1f81, 0x1f87, 0x1f81, 0x1f83, 0x1f81,
+    0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x01ff, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x01bf, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x00ff, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x03ff, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x039f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x03bf, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x039f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x01ff, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x01bf, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x07ff, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781,
+    0x078f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781, 0x079f, 0x0781, 0x0783, 0x0781,
+    0x0787, 0x0781, 0x0783, 0x0781, 0x078f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781,
+    0x07bf, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781, 0x078f, 0x0781, 0x0783, 0x0781,
+    0x0787, 0x0781, 0x0783, 0x0781, 0x079f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781,
+    0x078f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781, 0x00ff, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x01ff, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x01bf, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x03ff, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x039f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x03bf, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x039f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x01ff, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x01bf, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x00ff, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x0fff, 0x0f81, 0x0f83, 0x0f81, 0x0f87, 0x0f81, 0x0f83, 0x0f81, 0x0f8f, 0x0f81, 0x0f83, 0x0f81,
+    0x0f87, 0x0f81, 0x0f83, 0x0f81, 0x0f9f, 0x0f81, 0x0f83, 0x0f81, 0x0f87, 0x0f81, 0x0f83, 0x0f81,
+    0x0f8f, 0x0f81, 0x0f83, 0x0f81, 0x0f87, 0x0f81, 0x0f83, 0x0f81, 0x0fbf, 0x0f81, 0x0f83, 0x0f81,
+    0x0f87, 0x0f81, 0x0f83, 0x0f81, 0x0f8f, 0x0f81, 0x0f83, 0x0f81, 0x0f87, 0x0f81, 0x0f83, 0x0f81,
+    0x0f9f, 0x0f81, 0x0f83, 0x0f81, 0x0f87, 0x0f81, 0x0f83, 0x0f81, 0x0f8f, 0x0f81, 0x0f83, 0x0f81,
+    0x0f87, 0x0f81, 0x0f83, 0x0f81, 0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x01ff, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x01bf, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x03ff, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x039f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x03bf, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x039f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x00ff, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x01ff, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x01bf, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x07ff, 0x0781, 0x0783, 0x0781,
+    0x0787, 0x0781, 0x0783, 0x0781, 0x078f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781,
+    0x079f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781, 0x078f, 0x0781, 0x0783, 0x0781,
+    0x0787, 0x0781, 0x0783, 0x0781, 0x07bf, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781,
+    0x078f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781, 0x079f, 0x0781, 0x0783, 0x0781,
+    0x0787, 0x0781, 0x0783, 0x0781, 0x078f, 0x0781, 0x0783, 0x0781, 0x0787, 0x0781, 0x0783, 0x0781,
+    0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x01ff, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x01bf, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x00ff, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x03ff, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x039f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x03bf, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381,
+    0x039f, 0x0381, 0x0383, 0x0381, 0x0387, 0x0381, 0x0383, 0x0381, 0x038f, 0x0381, 0x0383, 0x0381,
+    0x0387, 0x0381, 0x0383, 0x0381, 0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x00bf, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x01ff, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x019f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x01bf, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181, 0x019f, 0x0181, 0x0183, 0x0181,
+    0x0187, 0x0181, 0x0183, 0x0181, 0x018f, 0x0181, 0x0183, 0x0181, 0x0187, 0x0181, 0x0183, 0x0181,
+    0x00ff, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x00bf, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081,
+    0x009f, 0x0081, 0x0083, 0x0081, 0x0087, 0x0081, 0x0083, 0x0081, 0x008f, 0x0081, 0x0083, 0x0081,
+    0x0087, 0x0081, 0x0083, 0x0081, 0x3fff, 0x3f83, 0x3f87, 0x3f83, 0x3f8f, 0x3f83, 0x3f87, 0x3f83,
+    0x3f9f, 0x3f83, 0x3f87, 0x3f83, 0x3f8f, 0x3f83, 0x3f87, 0x3f83, 0x3fbf, 0x3f83, 0x3f87, 0x3f83,
+    0x3f8f, 0x3f83, 0x3f87, 0x3f83, 0x3f9f, 0x3f83, 0x3f87, 0x3f83, 0x3f8f, 0x3f83, 0x3f87, 0x3f83,
+    0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x01ff, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x01bf, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x03ff, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383, 0x039f, 0x0383, 0x0387, 0x0383,
+    0x038f, 0x0383, 0x0387, 0x0383, 0x03bf, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383,
+    0x039f, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383, 0x00ff, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x01ff, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x01bf, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x07ff, 0x0783, 0x0787, 0x0783,
+    0x078f, 0x0783, 0x0787, 0x0783, 0x079f, 0x0783, 0x0787, 0x0783, 0x078f, 0x0783, 0x0787, 0x0783,
+    0x07bf, 0x0783, 0x0787, 0x0783, 0x078f, 0x0783, 0x0787, 0x0783, 0x079f, 0x0783, 0x0787, 0x0783,
+    0x078f, 0x0783, 0x0787, 0x0783, 0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x01ff, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x01bf, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x00ff, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x03ff, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383,
+    0x039f, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383, 0x03bf, 0x0383, 0x0387, 0x0383,
+    0x038f, 0x0383, 0x0387, 0x0383, 0x039f, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383,
+    0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x01ff, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x01bf, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x0fff, 0x0f83, 0x0f87, 0x0f83, 0x0f8f, 0x0f83, 0x0f87, 0x0f83, 0x0f9f, 0x0f83, 0x0f87, 0x0f83,
+    0x0f8f, 0x0f83, 0x0f87, 0x0f83, 0x0fbf, 0x0f83, 0x0f87, 0x0f83, 0x0f8f, 0x0f83, 0x0f87, 0x0f83,
+    0x0f9f, 0x0f83, 0x0f87, 0x0f83, 0x0f8f, 0x0f83, 0x0f87, 0x0f83, 0x00ff, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x01ff, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x01bf, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x03ff, 0x0383, 0x0387, 0x0383,
+    0x038f, 0x0383, 0x0387, 0x0383, 0x039f, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383,
+    0x03bf, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383, 0x039f, 0x0383, 0x0387, 0x0383,
+    0x038f, 0x0383, 0x0387, 0x0383, 0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x01ff, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x01bf, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x00ff, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x07ff, 0x0783, 0x0787, 0x0783, 0x078f, 0x0783, 0x0787, 0x0783,
+    0x079f, 0x0783, 0x0787, 0x0783, 0x078f, 0x0783, 0x0787, 0x0783, 0x07bf, 0x0783, 0x0787, 0x0783,
+    0x078f, 0x0783, 0x0787, 0x0783, 0x079f, 0x0783, 0x0787, 0x0783, 0x078f, 0x0783, 0x0787, 0x0783,
+    0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x01ff, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x01bf, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x03ff, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383, 0x039f, 0x0383, 0x0387, 0x0383,
+    0x038f, 0x0383, 0x0387, 0x0383, 0x03bf, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383,
+    0x039f, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383, 0x00ff, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x01ff, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x01bf, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x1fff, 0x1f83, 0x1f87, 0x1f83,
+    0x1f8f, 0x1f83, 0x1f87, 0x1f83, 0x1f9f, 0x1f83, 0x1f87, 0x1f83, 0x1f8f, 0x1f83, 0x1f87, 0x1f83,
+    0x1fbf, 0x1f83, 0x1f87, 0x1f83, 0x1f8f, 0x1f83, 0x1f87, 0x1f83, 0x1f9f, 0x1f83, 0x1f87, 0x1f83,
+    0x1f8f, 0x1f83, 0x1f87, 0x1f83, 0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x01ff, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x01bf, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x00ff, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x03ff, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383,
+    0x039f, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383, 0x03bf, 0x0383, 0x0387, 0x0383,
+    0x038f, 0x0383, 0x0387, 0x0383, 0x039f, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383,
+    0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x01ff, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x01bf, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x07ff, 0x0783, 0x0787, 0x0783, 0x078f, 0x0783, 0x0787, 0x0783, 0x079f, 0x0783, 0x0787, 0x0783,
+    0x078f, 0x0783, 0x0787, 0x0783, 0x07bf, 0x0783, 0x0787, 0x0783, 0x078f, 0x0783, 0x0787, 0x0783,
+    0x079f, 0x0783, 0x0787, 0x0783, 0x078f, 0x0783, 0x0787, 0x0783, 0x00ff, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x01ff, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x01bf, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x03ff, 0x0383, 0x0387, 0x0383,
+    0x038f, 0x0383, 0x0387, 0x0383, 0x039f, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383,
+    0x03bf, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383, 0x039f, 0x0383, 0x0387, 0x0383,
+    0x038f, 0x0383, 0x0387, 0x0383, 0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x01ff, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x01bf, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x00ff, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x0fff, 0x0f83, 0x0f87, 0x0f83, 0x0f8f, 0x0f83, 0x0f87, 0x0f83,
+    0x0f9f, 0x0f83, 0x0f87, 0x0f83, 0x0f8f, 0x0f83, 0x0f87, 0x0f83, 0x0fbf, 0x0f83, 0x0f87, 0x0f83,
+    0x0f8f, 0x0f83, 0x0f87, 0x0f83, 0x0f9f, 0x0f83, 0x0f87, 0x0f83, 0x0f8f, 0x0f83, 0x0f87, 0x0f83,
+    0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x01ff, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x01bf, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x03ff, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383, 0x039f, 0x0383, 0x0387, 0x0383,
+    0x038f, 0x0383, 0x0387, 0x0383, 0x03bf, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383,
+    0x039f, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383, 0x00ff, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x01ff, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x01bf, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x07ff, 0x0783, 0x0787, 0x0783,
+    0x078f, 0x0783, 0x0787, 0x0783, 0x079f, 0x0783, 0x0787, 0x0783, 0x078f, 0x0783, 0x0787, 0x0783,
+    0x07bf, 0x0783, 0x0787, 0x0783, 0x078f, 0x0783, 0x0787, 0x0783, 0x079f, 0x0783, 0x0787, 0x0783,
+    0x078f, 0x0783, 0x0787, 0x0783, 0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x01ff, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x01bf, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x00ff, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x03ff, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383,
+    0x039f, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383, 0x03bf, 0x0383, 0x0387, 0x0383,
+    0x038f, 0x0383, 0x0387, 0x0383, 0x039f, 0x0383, 0x0387, 0x0383, 0x038f, 0x0383, 0x0387, 0x0383,
+    0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x01ff, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183,
+    0x01bf, 0x0183, 0x0187, 0x0183, 0x018f, 0x0183, 0x0187, 0x0183, 0x019f, 0x0183, 0x0187, 0x0183,
+    0x018f, 0x0183, 0x0187, 0x0183, 0x00ff, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083, 0x00bf, 0x0083, 0x0087, 0x0083,
+    0x008f, 0x0083, 0x0087, 0x0083, 0x009f, 0x0083, 0x0087, 0x0083, 0x008f, 0x0083, 0x0087, 0x0083,
+    0x3fff, 0x3ffe, 0x3f87, 0x3f86, 0x3f8f, 0x3f8e, 0x3f87, 0x3f86, 0x3f9f, 0x3f9e, 0x3f87, 0x3f86,
+    0x3f8f, 0x3f8e, 0x3f87, 0x3f86, 0x3fbf, 0x3fbe, 0x3f87, 0x3f86, 0x3f8f, 0x3f8e, 0x3f87, 0x3f86,
+    0x3f9f, 0x3f9e, 0x3f87, 0x3f86, 0x3f8f, 0x3f8e, 0x3f87, 0x3f86, 0x00ff, 0x00fe, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x01ff, 0x01fe, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x01bf, 0x01be, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x03ff, 0x03fe, 0x0387, 0x0386,
+    0x038f, 0x038e, 0x0387, 0x0386, 0x039f, 0x039e, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386,
+    0x03bf, 0x03be, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386, 0x039f, 0x039e, 0x0387, 0x0386,
+    0x038f, 0x038e, 0x0387, 0x0386, 0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x01ff, 0x01fe, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x01bf, 0x01be, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x00ff, 0x00fe, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x07ff, 0x07fe, 0x0787, 0x0786, 0x078f, 0x078e, 0x0787, 0x0786,
+    0x079f, 0x079e, 0x0787, 0x0786, 0x078f, 0x078e, 0x0787, 0x0786, 0x07bf, 0x07be, 0x0787, 0x0786,
+    0x078f, 0x078e, 0x0787, 0x0786, 0x079f, 0x079e, 0x0787, 0x0786, 0x078f, 0x078e, 0x0787, 0x0786,
+    0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x01ff, 0x01fe, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x01bf, 0x01be, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x03ff, 0x03fe, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386, 0x039f, 0x039e, 0x0387, 0x0386,
+    0x038f, 0x038e, 0x0387, 0x0386, 0x03bf, 0x03be, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386,
+    0x039f, 0x039e, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386, 0x00ff, 0x00fe, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x01ff, 0x01fe, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x01bf, 0x01be, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x0fff, 0x0ffe, 0x0f87, 0x0f86,
+    0x0f8f, 0x0f8e, 0x0f87, 0x0f86, 0x0f9f, 0x0f9e, 0x0f87, 0x0f86, 0x0f8f, 0x0f8e, 0x0f87, 0x0f86,
+    0x0fbf, 0x0fbe, 0x0f87, 0x0f86, 0x0f8f, 0x0f8e, 0x0f87, 0x0f86, 0x0f9f, 0x0f9e, 0x0f87, 0x0f86,
+    0x0f8f, 0x0f8e, 0x0f87, 0x0f86, 0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x01ff, 0x01fe, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x01bf, 0x01be, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x00ff, 0x00fe, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x03ff, 0x03fe, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386,
+    0x039f, 0x039e, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386, 0x03bf, 0x03be, 0x0387, 0x0386,
+    0x038f, 0x038e, 0x0387, 0x0386, 0x039f, 0x039e, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386,
+    0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x01ff, 0x01fe, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x01bf, 0x01be, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x07ff, 0x07fe, 0x0787, 0x0786, 0x078f, 0x078e, 0x0787, 0x0786, 0x079f, 0x079e, 0x0787, 0x0786,
+    0x078f, 0x078e, 0x0787, 0x0786, 0x07bf, 0x07be, 0x0787, 0x0786, 0x078f, 0x078e, 0x0787, 0x0786,
+    0x079f, 0x079e, 0x0787, 0x0786, 0x078f, 0x078e, 0x0787, 0x0786, 0x00ff, 0x00fe, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x01ff, 0x01fe, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x01bf, 0x01be, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x03ff, 0x03fe, 0x0387, 0x0386,
+    0x038f, 0x038e, 0x0387, 0x0386, 0x039f, 0x039e, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386,
+    0x03bf, 0x03be, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386, 0x039f, 0x039e, 0x0387, 0x0386,
+    0x038f, 0x038e, 0x0387, 0x0386, 0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x01ff, 0x01fe, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x01bf, 0x01be, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x00ff, 0x00fe, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x1fff, 0x1ffe, 0x1f87, 0x1f86, 0x1f8f, 0x1f8e, 0x1f87, 0x1f86,
+    0x1f9f, 0x1f9e, 0x1f87, 0x1f86, 0x1f8f, 0x1f8e, 0x1f87, 0x1f86, 0x1fbf, 0x1fbe, 0x1f87, 0x1f86,
+    0x1f8f, 0x1f8e, 0x1f87, 0x1f86, 0x1f9f, 0x1f9e, 0x1f87, 0x1f86, 0x1f8f, 0x1f8e, 0x1f87, 0x1f86,
+    0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x01ff, 0x01fe, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x01bf, 0x01be, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x03ff, 0x03fe, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386, 0x039f, 0x039e, 0x0387, 0x0386,
+    0x038f, 0x038e, 0x0387, 0x0386, 0x03bf, 0x03be, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386,
+    0x039f, 0x039e, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386, 0x00ff, 0x00fe, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x01ff, 0x01fe, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x01bf, 0x01be, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x07ff, 0x07fe, 0x0787, 0x0786,
+    0x078f, 0x078e, 0x0787, 0x0786, 0x079f, 0x079e, 0x0787, 0x0786, 0x078f, 0x078e, 0x0787, 0x0786,
+    0x07bf, 0x07be, 0x0787, 0x0786, 0x078f, 0x078e, 0x0787, 0x0786, 0x079f, 0x079e, 0x0787, 0x0786,
+    0x078f, 0x078e, 0x0787, 0x0786, 0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x01ff, 0x01fe, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x01bf, 0x01be, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x00ff, 0x00fe, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x03ff, 0x03fe, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386,
+    0x039f, 0x039e, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386, 0x03bf, 0x03be, 0x0387, 0x0386,
+    0x038f, 0x038e, 0x0387, 0x0386, 0x039f, 0x039e, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386,
+    0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x01ff, 0x01fe, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x01bf, 0x01be, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x0fff, 0x0ffe, 0x0f87, 0x0f86, 0x0f8f, 0x0f8e, 0x0f87, 0x0f86, 0x0f9f, 0x0f9e, 0x0f87, 0x0f86,
+    0x0f8f, 0x0f8e, 0x0f87, 0x0f86, 0x0fbf, 0x0fbe, 0x0f87, 0x0f86, 0x0f8f, 0x0f8e, 0x0f87, 0x0f86,
+    0x0f9f, 0x0f9e, 0x0f87, 0x0f86, 0x0f8f, 0x0f8e, 0x0f87, 0x0f86, 0x00ff, 0x00fe, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x01ff, 0x01fe, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x01bf, 0x01be, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x03ff, 0x03fe, 0x0387, 0x0386,
+    0x038f, 0x038e, 0x0387, 0x0386, 0x039f, 0x039e, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386,
+    0x03bf, 0x03be, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386, 0x039f, 0x039e, 0x0387, 0x0386,
+    0x038f, 0x038e, 0x0387, 0x0386, 0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x01ff, 0x01fe, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x01bf, 0x01be, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x00ff, 0x00fe, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x07ff, 0x07fe, 0x0787, 0x0786, 0x078f, 0x078e, 0x0787, 0x0786,
+    0x079f, 0x079e, 0x0787, 0x0786, 0x078f, 0x078e, 0x0787, 0x0786, 0x07bf, 0x07be, 0x0787, 0x0786,
+    0x078f, 0x078e, 0x0787, 0x0786, 0x079f, 0x079e, 0x0787, 0x0786, 0x078f, 0x078e, 0x0787, 0x0786,
+    0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x01ff, 0x01fe, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x01bf, 0x01be, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x03ff, 0x03fe, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386, 0x039f, 0x039e, 0x0387, 0x0386,
+    0x038f, 0x038e, 0x0387, 0x0386, 0x03bf, 0x03be, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386,
+    0x039f, 0x039e, 0x0387, 0x0386, 0x038f, 0x038e, 0x0387, 0x0386, 0x00ff, 0x00fe, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x01ff, 0x01fe, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186, 0x01bf, 0x01be, 0x0187, 0x0186,
+    0x018f, 0x018e, 0x0187, 0x0186, 0x019f, 0x019e, 0x0187, 0x0186, 0x018f, 0x018e, 0x0187, 0x0186,
+    0x00ff, 0x00fe, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x009f, 0x009e, 0x0087, 0x0086,
+    0x008f, 0x008e, 0x0087, 0x0086, 0x00bf, 0x00be, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086,
+    0x009f, 0x009e, 0x0087, 0x0086, 0x008f, 0x008e, 0x0087, 0x0086, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c,
+    0x3fbf, 0x3fbe, 0x3fbc, 0x3fbc, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c,
+    0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x038f, 0x038e, 0x038c, 0x038c,
+    0x039f, 0x039e, 0x039c, 0x039c, 0x038f, 0x038e, 0x038c, 0x038c, 0x03bf, 0x03be, 0x03bc, 0x03bc,
+    0x038f, 0x038e, 0x038c, 0x038c, 0x039f, 0x039e, 0x039c, 0x039c, 0x038f, 0x038e, 0x038c, 0x038c,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x078f, 0x078e, 0x078c, 0x078c, 0x079f, 0x079e, 0x079c, 0x079c,
+    0x078f, 0x078e, 0x078c, 0x078c, 0x07bf, 0x07be, 0x07bc, 0x07bc, 0x078f, 0x078e, 0x078c, 0x078c,
+    0x079f, 0x079e, 0x079c, 0x079c, 0x078f, 0x078e, 0x078c, 0x078c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x038f, 0x038e, 0x038c, 0x038c, 0x039f, 0x039e, 0x039c, 0x039c, 0x038f, 0x038e, 0x038c, 0x038c,
+    0x03bf, 0x03be, 0x03bc, 0x03bc, 0x038f, 0x038e, 0x038c, 0x038c, 0x039f, 0x039e, 0x039c, 0x039c,
+    0x038f, 0x038e, 0x038c, 0x038c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f9f, 0x0f9e, 0x0f9c, 0x0f9c, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0fbf, 0x0fbe, 0x0fbc, 0x0fbc,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f9f, 0x0f9e, 0x0f9c, 0x0f9c, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x038f, 0x038e, 0x038c, 0x038c, 0x039f, 0x039e, 0x039c, 0x039c,
+    0x038f, 0x038e, 0x038c, 0x038c, 0x03bf, 0x03be, 0x03bc, 0x03bc, 0x038f, 0x038e, 0x038c, 0x038c,
+    0x039f, 0x039e, 0x039c, 0x039c, 0x038f, 0x038e, 0x038c, 0x038c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x078f, 0x078e, 0x078c, 0x078c, 0x079f, 0x079e, 0x079c, 0x079c, 0x078f, 0x078e, 0x078c, 0x078c,
+    0x07bf, 0x07be, 0x07bc, 0x07bc, 0x078f, 0x078e, 0x078c, 0x078c, 0x079f, 0x079e, 0x079c, 0x079c,
+    0x078f, 0x078e, 0x078c, 0x078c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x038f, 0x038e, 0x038c, 0x038c,
+    0x039f, 0x039e, 0x039c, 0x039c, 0x038f, 0x038e, 0x038c, 0x038c, 0x03bf, 0x03be, 0x03bc, 0x03bc,
+    0x038f, 0x038e, 0x038c, 0x038c, 0x039f, 0x039e, 0x039c, 0x039c, 0x038f, 0x038e, 0x038c, 0x038c,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c,
+    0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1fbf, 0x1fbe, 0x1fbc, 0x1fbc, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c,
+    0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x038f, 0x038e, 0x038c, 0x038c, 0x039f, 0x039e, 0x039c, 0x039c, 0x038f, 0x038e, 0x038c, 0x038c,
+    0x03bf, 0x03be, 0x03bc, 0x03bc, 0x038f, 0x038e, 0x038c, 0x038c, 0x039f, 0x039e, 0x039c, 0x039c,
+    0x038f, 0x038e, 0x038c, 0x038c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x078f, 0x078e, 0x078c, 0x078c,
+    0x079f, 0x079e, 0x079c, 0x079c, 0x078f, 0x078e, 0x078c, 0x078c, 0x07bf, 0x07be, 0x07bc, 0x07bc,
+    0x078f, 0x078e, 0x078c, 0x078c, 0x079f, 0x079e, 0x079c, 0x079c, 0x078f, 0x078e, 0x078c, 0x078c,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x038f, 0x038e, 0x038c, 0x038c, 0x039f, 0x039e, 0x039c, 0x039c,
+    0x038f, 0x038e, 0x038c, 0x038c, 0x03bf, 0x03be, 0x03bc, 0x03bc, 0x038f, 0x038e, 0x038c, 0x038c,
+    0x039f, 0x039e, 0x039c, 0x039c, 0x038f, 0x038e, 0x038c, 0x038c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f9f, 0x0f9e, 0x0f9c, 0x0f9c, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0fbf, 0x0fbe, 0x0fbc, 0x0fbc, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f9f, 0x0f9e, 0x0f9c, 0x0f9c,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x038f, 0x038e, 0x038c, 0x038c,
+    0x039f, 0x039e, 0x039c, 0x039c, 0x038f, 0x038e, 0x038c, 0x038c, 0x03bf, 0x03be, 0x03bc, 0x03bc,
+    0x038f, 0x038e, 0x038c, 0x038c, 0x039f, 0x039e, 0x039c, 0x039c, 0x038f, 0x038e, 0x038c, 0x038c,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x078f, 0x078e, 0x078c, 0x078c, 0x079f, 0x079e, 0x079c, 0x079c,
+    0x078f, 0x078e, 0x078c, 0x078c, 0x07bf, 0x07be, 0x07bc, 0x07bc, 0x078f, 0x078e, 0x078c, 0x078c,
+    0x079f, 0x079e, 0x079c, 0x079c, 0x078f, 0x078e, 0x078c, 0x078c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x038f, 0x038e, 0x038c, 0x038c, 0x039f, 0x039e, 0x039c, 0x039c, 0x038f, 0x038e, 0x038c, 0x038c,
+    0x03bf, 0x03be, 0x03bc, 0x03bc, 0x038f, 0x038e, 0x038c, 0x038c, 0x039f, 0x039e, 0x039c, 0x039c,
+    0x038f, 0x038e, 0x038c, 0x038c, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x018f, 0x018e, 0x018c, 0x018c, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x018f, 0x018e, 0x018c, 0x018c, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x018f, 0x018e, 0x018c, 0x018c,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x018f, 0x018e, 0x018c, 0x018c, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c, 0x008f, 0x008e, 0x008c, 0x008c,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x008f, 0x008e, 0x008c, 0x008c, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x008f, 0x008e, 0x008c, 0x008c, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c, 0x3f98, 0x3f98, 0x3f98, 0x3f98, 0x3fbf, 0x3fbe, 0x3fbc, 0x3fbc,
+    0x3fb8, 0x3fb8, 0x3fb8, 0x3fb8, 0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c, 0x3f98, 0x3f98, 0x3f98, 0x3f98,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x039f, 0x039e, 0x039c, 0x039c,
+    0x0398, 0x0398, 0x0398, 0x0398, 0x03bf, 0x03be, 0x03bc, 0x03bc, 0x03b8, 0x03b8, 0x03b8, 0x03b8,
+    0x039f, 0x039e, 0x039c, 0x039c, 0x0398, 0x0398, 0x0398, 0x0398, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x079f, 0x079e, 0x079c, 0x079c, 0x0798, 0x0798, 0x0798, 0x0798,
+    0x07bf, 0x07be, 0x07bc, 0x07bc, 0x07b8, 0x07b8, 0x07b8, 0x07b8, 0x079f, 0x079e, 0x079c, 0x079c,
+    0x0798, 0x0798, 0x0798, 0x0798, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x039f, 0x039e, 0x039c, 0x039c, 0x0398, 0x0398, 0x0398, 0x0398, 0x03bf, 0x03be, 0x03bc, 0x03bc,
+    0x03b8, 0x03b8, 0x03b8, 0x03b8, 0x039f, 0x039e, 0x039c, 0x039c, 0x0398, 0x0398, 0x0398, 0x0398,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0f9f, 0x0f9e, 0x0f9c, 0x0f9c,
+    0x0f98, 0x0f98, 0x0f98, 0x0f98, 0x0fbf, 0x0fbe, 0x0fbc, 0x0fbc, 0x0fb8, 0x0fb8, 0x0fb8, 0x0fb8,
+    0x0f9f, 0x0f9e, 0x0f9c, 0x0f9c, 0x0f98, 0x0f98, 0x0f98, 0x0f98, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x039f, 0x039e, 0x039c, 0x039c, 0x0398, 0x0398, 0x0398, 0x0398,
+    0x03bf, 0x03be, 0x03bc, 0x03bc, 0x03b8, 0x03b8, 0x03b8, 0x03b8, 0x039f, 0x039e, 0x039c, 0x039c,
+    0x0398, 0x0398, 0x0398, 0x0398, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x079f, 0x079e, 0x079c, 0x079c, 0x0798, 0x0798, 0x0798, 0x0798, 0x07bf, 0x07be, 0x07bc, 0x07bc,
+    0x07b8, 0x07b8, 0x07b8, 0x07b8, 0x079f, 0x079e, 0x079c, 0x079c, 0x0798, 0x0798, 0x0798, 0x0798,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x039f, 0x039e, 0x039c, 0x039c,
+    0x0398, 0x0398, 0x0398, 0x0398, 0x03bf, 0x03be, 0x03bc, 0x03bc, 0x03b8, 0x03b8, 0x03b8, 0x03b8,
+    0x039f, 0x039e, 0x039c, 0x039c, 0x0398, 0x0398, 0x0398, 0x0398, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc,
+    0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c, 0x1f98, 0x1f98, 0x1f98, 0x1f98,
+    0x1fbf, 0x1fbe, 0x1fbc, 0x1fbc, 0x1fb8, 0x1fb8, 0x1fb8, 0x1fb8, 0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c,
+    0x1f98, 0x1f98, 0x1f98, 0x1f98, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x039f, 0x039e, 0x039c, 0x039c, 0x0398, 0x0398, 0x0398, 0x0398, 0x03bf, 0x03be, 0x03bc, 0x03bc,
+    0x03b8, 0x03b8, 0x03b8, 0x03b8, 0x039f, 0x039e, 0x039c, 0x039c, 0x0398, 0x0398, 0x0398, 0x0398,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x079f, 0x079e, 0x079c, 0x079c,
+    0x0798, 0x0798, 0x0798, 0x0798, 0x07bf, 0x07be, 0x07bc, 0x07bc, 0x07b8, 0x07b8, 0x07b8, 0x07b8,
+    0x079f, 0x079e, 0x079c, 0x079c, 0x0798, 0x0798, 0x0798, 0x0798, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x039f, 0x039e, 0x039c, 0x039c, 0x0398, 0x0398, 0x0398, 0x0398,
+    0x03bf, 0x03be, 0x03bc, 0x03bc, 0x03b8, 0x03b8, 0x03b8, 0x03b8, 0x039f, 0x039e, 0x039c, 0x039c,
+    0x0398, 0x0398, 0x0398, 0x0398, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8,
+    0x0f9f, 0x0f9e, 0x0f9c, 0x0f9c, 0x0f98, 0x0f98, 0x0f98, 0x0f98, 0x0fbf, 0x0fbe, 0x0fbc, 0x0fbc,
+    0x0fb8, 0x0fb8, 0x0fb8, 0x0fb8, 0x0f9f, 0x0f9e, 0x0f9c, 0x0f9c, 0x0f98, 0x0f98, 0x0f98, 0x0f98,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x039f, 0x039e, 0x039c, 0x039c,
+    0x0398, 0x0398, 0x0398, 0x0398, 0x03bf, 0x03be, 0x03bc, 0x03bc, 0x03b8, 0x03b8, 0x03b8, 0x03b8,
+    0x039f, 0x039e, 0x039c, 0x039c, 0x0398, 0x0398, 0x0398, 0x0398, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x079f, 0x079e, 0x079c, 0x079c, 0x0798, 0x0798, 0x0798, 0x0798,
+    0x07bf, 0x07be, 0x07bc, 0x07bc, 0x07b8, 0x07b8, 0x07b8, 0x07b8, 0x079f, 0x079e, 0x079c, 0x079c,
+    0x0798, 0x0798, 0x0798, 0x0798, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8,
+    0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x039f, 0x039e, 0x039c, 0x039c, 0x0398, 0x0398, 0x0398, 0x0398, 0x03bf, 0x03be, 0x03bc, 0x03bc,
+    0x03b8, 0x03b8, 0x03b8, 0x03b8, 0x039f, 0x039e, 0x039c, 0x039c, 0x0398, 0x0398, 0x0398, 0x0398,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x009f, 0x009e, 0x009c, 0x009c,
+    0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x019f, 0x019e, 0x019c, 0x019c, 0x0198, 0x0198, 0x0198, 0x0198,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x019f, 0x019e, 0x019c, 0x019c,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x009f, 0x009e, 0x009c, 0x009c, 0x0098, 0x0098, 0x0098, 0x0098,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fbf, 0x3fbe, 0x3fbc, 0x3fbc, 0x3fb8, 0x3fb8, 0x3fb8, 0x3fb8,
+    0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03bf, 0x03be, 0x03bc, 0x03bc, 0x03b8, 0x03b8, 0x03b8, 0x03b8, 0x03b0, 0x03b0, 0x03b0, 0x03b0,
+    0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8,
+    0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07bf, 0x07be, 0x07bc, 0x07bc,
+    0x07b8, 0x07b8, 0x07b8, 0x07b8, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x01b0, 0x01b0, 0x01b0, 0x01b0,
+    0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03bf, 0x03be, 0x03bc, 0x03bc, 0x03b8, 0x03b8, 0x03b8, 0x03b8,
+    0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0fbf, 0x0fbe, 0x0fbc, 0x0fbc, 0x0fb8, 0x0fb8, 0x0fb8, 0x0fb8, 0x0fb0, 0x0fb0, 0x0fb0, 0x0fb0,
+    0x0fb0, 0x0fb0, 0x0fb0, 0x0fb0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8,
+    0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03bf, 0x03be, 0x03bc, 0x03bc,
+    0x03b8, 0x03b8, 0x03b8, 0x03b8, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x01b0, 0x01b0, 0x01b0, 0x01b0,
+    0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07bf, 0x07be, 0x07bc, 0x07bc, 0x07b8, 0x07b8, 0x07b8, 0x07b8,
+    0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03bf, 0x03be, 0x03bc, 0x03bc, 0x03b8, 0x03b8, 0x03b8, 0x03b8, 0x03b0, 0x03b0, 0x03b0, 0x03b0,
+    0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8,
+    0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fbf, 0x1fbe, 0x1fbc, 0x1fbc,
+    0x1fb8, 0x1fb8, 0x1fb8, 0x1fb8, 0x1fb0, 0x1fb0, 0x1fb0, 0x1fb0, 0x1fb0, 0x1fb0, 0x1fb0, 0x1fb0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x01b0, 0x01b0, 0x01b0, 0x01b0,
+    0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03bf, 0x03be, 0x03bc, 0x03bc, 0x03b8, 0x03b8, 0x03b8, 0x03b8,
+    0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07bf, 0x07be, 0x07bc, 0x07bc, 0x07b8, 0x07b8, 0x07b8, 0x07b8, 0x07b0, 0x07b0, 0x07b0, 0x07b0,
+    0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8,
+    0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03bf, 0x03be, 0x03bc, 0x03bc,
+    0x03b8, 0x03b8, 0x03b8, 0x03b8, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x01b0, 0x01b0, 0x01b0, 0x01b0,
+    0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0fbf, 0x0fbe, 0x0fbc, 0x0fbc, 0x0fb8, 0x0fb8, 0x0fb8, 0x0fb8,
+    0x0fb0, 0x0fb0, 0x0fb0, 0x0fb0, 0x0fb0, 0x0fb0, 0x0fb0, 0x0fb0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03bf, 0x03be, 0x03bc, 0x03bc, 0x03b8, 0x03b8, 0x03b8, 0x03b8, 0x03b0, 0x03b0, 0x03b0, 0x03b0,
+    0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8,
+    0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07bf, 0x07be, 0x07bc, 0x07bc,
+    0x07b8, 0x07b8, 0x07b8, 0x07b8, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0, 0x07b0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01bf, 0x01be, 0x01bc, 0x01bc, 0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x01b0, 0x01b0, 0x01b0, 0x01b0,
+    0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc,
+    0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03bf, 0x03be, 0x03bc, 0x03bc, 0x03b8, 0x03b8, 0x03b8, 0x03b8,
+    0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x03b0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01bf, 0x01be, 0x01bc, 0x01bc,
+    0x01b8, 0x01b8, 0x01b8, 0x01b8, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0, 0x01b0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00bf, 0x00be, 0x00bc, 0x00bc, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+    0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8,
+    0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8,
+    0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x3fff, 0x3f03, 0x3f07, 0x3f03,
+    0x3f0f, 0x3f03, 0x3f07, 0x3f03, 0x3f1f, 0x3f03, 0x3f07, 0x3f03, 0x3f0f, 0x3f03, 0x3f07, 0x3f03,
+    0x3f3f, 0x3f03, 0x3f07, 0x3f03, 0x3f0f, 0x3f03, 0x3f07, 0x3f03, 0x3f1f, 0x3f03, 0x3f07, 0x3f03,
+    0x3f0f, 0x3f03, 0x3f07, 0x3f03, 0x3f7f, 0x3f03, 0x3f07, 0x3f03, 0x3f0f, 0x3f03, 0x3f07, 0x3f03,
+    0x3f1f, 0x3f03, 0x3f07, 0x3f03, 0x3f0f, 0x3f03, 0x3f07, 0x3f03, 0x3f3f, 0x3f03, 0x3f07, 0x3f03,
+    0x3f0f, 0x3f03, 0x3f07, 0x3f03, 0x3f1f, 0x3f03, 0x3f07, 0x3f03, 0x3f0f, 0x3f03, 0x3f07, 0x3f03,
+    0x01ff, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x017f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x03ff, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x033f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x037f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x033f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x01ff, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x017f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x07ff, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703, 0x071f, 0x0703, 0x0707, 0x0703,
+    0x070f, 0x0703, 0x0707, 0x0703, 0x073f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703,
+    0x071f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703, 0x077f, 0x0703, 0x0707, 0x0703,
+    0x070f, 0x0703, 0x0707, 0x0703, 0x071f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703,
+    0x073f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703, 0x071f, 0x0703, 0x0707, 0x0703,
+    0x070f, 0x0703, 0x0707, 0x0703, 0x01ff, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x017f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x03ff, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x033f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x037f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x033f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x01ff, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x017f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x0fff, 0x0f03, 0x0f07, 0x0f03, 0x0f0f, 0x0f03, 0x0f07, 0x0f03,
+    0x0f1f, 0x0f03, 0x0f07, 0x0f03, 0x0f0f, 0x0f03, 0x0f07, 0x0f03, 0x0f3f, 0x0f03, 0x0f07, 0x0f03,
+    0x0f0f, 0x0f03, 0x0f07, 0x0f03, 0x0f1f, 0x0f03, 0x0f07, 0x0f03, 0x0f0f, 0x0f03, 0x0f07, 0x0f03,
+    0x0f7f, 0x0f03, 0x0f07, 0x0f03, 0x0f0f, 0x0f03, 0x0f07, 0x0f03, 0x0f1f, 0x0f03, 0x0f07, 0x0f03,
+    0x0f0f, 0x0f03, 0x0f07, 0x0f03, 0x0f3f, 0x0f03, 0x0f07, 0x0f03, 0x0f0f, 0x0f03, 0x0f07, 0x0f03,
+    0x0f1f, 0x0f03, 0x0f07, 0x0f03, 0x0f0f, 0x0f03, 0x0f07, 0x0f03, 0x01ff, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x017f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x03ff, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x033f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x037f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x033f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x01ff, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x017f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x07ff, 0x0703, 0x0707, 0x0703,
+    0x070f, 0x0703, 0x0707, 0x0703, 0x071f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703,
+    0x073f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703, 0x071f, 0x0703, 0x0707, 0x0703,
+    0x070f, 0x0703, 0x0707, 0x0703, 0x077f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703,
+    0x071f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703, 0x073f, 0x0703, 0x0707, 0x0703,
+    0x070f, 0x0703, 0x0707, 0x0703, 0x071f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703,
+    0x01ff, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x017f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x03ff, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x033f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x037f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x033f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x01ff, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x017f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x1fff, 0x1f03, 0x1f07, 0x1f03, 0x1f0f, 0x1f03, 0x1f07, 0x1f03, 0x1f1f, 0x1f03, 0x1f07, 0x1f03,
+    0x1f0f, 0x1f03, 0x1f07, 0x1f03, 0x1f3f, 0x1f03, 0x1f07, 0x1f03, 0x1f0f, 0x1f03, 0x1f07, 0x1f03,
+    0x1f1f, 0x1f03, 0x1f07, 0x1f03, 0x1f0f, 0x1f03, 0x1f07, 0x1f03, 0x1f7f, 0x1f03, 0x1f07, 0x1f03,
+    0x1f0f, 0x1f03, 0x1f07, 0x1f03, 0x1f1f, 0x1f03, 0x1f07, 0x1f03, 0x1f0f, 0x1f03, 0x1f07, 0x1f03,
+    0x1f3f, 0x1f03, 0x1f07, 0x1f03, 0x1f0f, 0x1f03, 0x1f07, 0x1f03, 0x1f1f, 0x1f03, 0x1f07, 0x1f03,
+    0x1f0f, 0x1f03, 0x1f07, 0x1f03, 0x01ff, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x017f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x03ff, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x033f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x037f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x033f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x01ff, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x017f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x07ff, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703,
+    0x071f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703, 0x073f, 0x0703, 0x0707, 0x0703,
+    0x070f, 0x0703, 0x0707, 0x0703, 0x071f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703,
+    0x077f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703, 0x071f, 0x0703, 0x0707, 0x0703,
+    0x070f, 0x0703, 0x0707, 0x0703, 0x073f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703,
+    0x071f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703, 0x01ff, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x017f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x03ff, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x033f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x037f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x033f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x01ff, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x017f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x0fff, 0x0f03, 0x0f07, 0x0f03,
+    0x0f0f, 0x0f03, 0x0f07, 0x0f03, 0x0f1f, 0x0f03, 0x0f07, 0x0f03, 0x0f0f, 0x0f03, 0x0f07, 0x0f03,
+    0x0f3f, 0x0f03, 0x0f07, 0x0f03, 0x0f0f, 0x0f03, 0x0f07, 0x0f03, 0x0f1f, 0x0f03, 0x0f07, 0x0f03,
+    0x0f0f, 0x0f03, 0x0f07, 0x0f03, 0x0f7f, 0x0f03, 0x0f07, 0x0f03, 0x0f0f, 0x0f03, 0x0f07, 0x0f03,
+    0x0f1f, 0x0f03, 0x0f07, 0x0f03, 0x0f0f, 0x0f03, 0x0f07, 0x0f03, 0x0f3f, 0x0f03, 0x0f07, 0x0f03,
+    0x0f0f, 0x0f03, 0x0f07, 0x0f03, 0x0f1f, 0x0f03, 0x0f07, 0x0f03, 0x0f0f, 0x0f03, 0x0f07, 0x0f03,
+    0x01ff, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x017f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x03ff, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x033f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x037f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x033f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x01ff, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x017f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x07ff, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703, 0x071f, 0x0703, 0x0707, 0x0703,
+    0x070f, 0x0703, 0x0707, 0x0703, 0x073f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703,
+    0x071f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703, 0x077f, 0x0703, 0x0707, 0x0703,
+    0x070f, 0x0703, 0x0707, 0x0703, 0x071f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703,
+    0x073f, 0x0703, 0x0707, 0x0703, 0x070f, 0x0703, 0x0707, 0x0703, 0x071f, 0x0703, 0x0707, 0x0703,
+    0x070f, 0x0703, 0x0707, 0x0703, 0x01ff, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x017f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x03ff, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x033f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x037f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303, 0x033f, 0x0303, 0x0307, 0x0303,
+    0x030f, 0x0303, 0x0307, 0x0303, 0x031f, 0x0303, 0x0307, 0x0303, 0x030f, 0x0303, 0x0307, 0x0303,
+    0x01ff, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x017f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103,
+    0x013f, 0x0103, 0x0107, 0x0103, 0x010f, 0x0103, 0x0107, 0x0103, 0x011f, 0x0103, 0x0107, 0x0103,
+    0x010f, 0x0103, 0x0107, 0x0103, 0x3fff, 0x3f07, 0x3f0f, 0x3f07, 0x3f1f, 0x3f07, 0x3f0f, 0x3f07,
+    0x3f3f, 0x3f07, 0x3f0f, 0x3f07, 0x3f1f, 0x3f07, 0x3f0f, 0x3f07, 0x3f7f, 0x3f07, 0x3f0f, 0x3f07,
+    0x3f1f, 0x3f07, 0x3f0f, 0x3f07, 0x3f3f, 0x3f07, 0x3f0f, 0x3f07, 0x3f1f, 0x3f07, 0x3f0f, 0x3f07,
+    0x01ff, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x017f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x03ff, 0x0307, 0x030f, 0x0307,
+    0x031f, 0x0307, 0x030f, 0x0307, 0x033f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307,
+    0x037f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307, 0x033f, 0x0307, 0x030f, 0x0307,
+    0x031f, 0x0307, 0x030f, 0x0307, 0x01ff, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x017f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x07ff, 0x0707, 0x070f, 0x0707, 0x071f, 0x0707, 0x070f, 0x0707, 0x073f, 0x0707, 0x070f, 0x0707,
+    0x071f, 0x0707, 0x070f, 0x0707, 0x077f, 0x0707, 0x070f, 0x0707, 0x071f, 0x0707, 0x070f, 0x0707,
+    0x073f, 0x0707, 0x070f, 0x0707, 0x071f, 0x0707, 0x070f, 0x0707, 0x01ff, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x017f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x03ff, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307,
+    0x033f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307, 0x037f, 0x0307, 0x030f, 0x0307,
+    0x031f, 0x0307, 0x030f, 0x0307, 0x033f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307,
+    0x01ff, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x017f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x0fff, 0x0f07, 0x0f0f, 0x0f07,
+    0x0f1f, 0x0f07, 0x0f0f, 0x0f07, 0x0f3f, 0x0f07, 0x0f0f, 0x0f07, 0x0f1f, 0x0f07, 0x0f0f, 0x0f07,
+    0x0f7f, 0x0f07, 0x0f0f, 0x0f07, 0x0f1f, 0x0f07, 0x0f0f, 0x0f07, 0x0f3f, 0x0f07, 0x0f0f, 0x0f07,
+    0x0f1f, 0x0f07, 0x0f0f, 0x0f07, 0x01ff, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x017f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x03ff, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307, 0x033f, 0x0307, 0x030f, 0x0307,
+    0x031f, 0x0307, 0x030f, 0x0307, 0x037f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307,
+    0x033f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307, 0x01ff, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x017f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x07ff, 0x0707, 0x070f, 0x0707, 0x071f, 0x0707, 0x070f, 0x0707,
+    0x073f, 0x0707, 0x070f, 0x0707, 0x071f, 0x0707, 0x070f, 0x0707, 0x077f, 0x0707, 0x070f, 0x0707,
+    0x071f, 0x0707, 0x070f, 0x0707, 0x073f, 0x0707, 0x070f, 0x0707, 0x071f, 0x0707, 0x070f, 0x0707,
+    0x01ff, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x017f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x03ff, 0x0307, 0x030f, 0x0307,
+    0x031f, 0x0307, 0x030f, 0x0307, 0x033f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307,
+    0x037f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307, 0x033f, 0x0307, 0x030f, 0x0307,
+    0x031f, 0x0307, 0x030f, 0x0307, 0x01ff, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x017f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x1fff, 0x1f07, 0x1f0f, 0x1f07, 0x1f1f, 0x1f07, 0x1f0f, 0x1f07, 0x1f3f, 0x1f07, 0x1f0f, 0x1f07,
+    0x1f1f, 0x1f07, 0x1f0f, 0x1f07, 0x1f7f, 0x1f07, 0x1f0f, 0x1f07, 0x1f1f, 0x1f07, 0x1f0f, 0x1f07,
+    0x1f3f, 0x1f07, 0x1f0f, 0x1f07, 0x1f1f, 0x1f07, 0x1f0f, 0x1f07, 0x01ff, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x017f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x03ff, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307,
+    0x033f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307, 0x037f, 0x0307, 0x030f, 0x0307,
+    0x031f, 0x0307, 0x030f, 0x0307, 0x033f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307,
+    0x01ff, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x017f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x07ff, 0x0707, 0x070f, 0x0707,
+    0x071f, 0x0707, 0x070f, 0x0707, 0x073f, 0x0707, 0x070f, 0x0707, 0x071f, 0x0707, 0x070f, 0x0707,
+    0x077f, 0x0707, 0x070f, 0x0707, 0x071f, 0x0707, 0x070f, 0x0707, 0x073f, 0x0707, 0x070f, 0x0707,
+    0x071f, 0x0707, 0x070f, 0x0707, 0x01ff, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x017f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x03ff, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307, 0x033f, 0x0307, 0x030f, 0x0307,
+    0x031f, 0x0307, 0x030f, 0x0307, 0x037f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307,
+    0x033f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307, 0x01ff, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x017f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x0fff, 0x0f07, 0x0f0f, 0x0f07, 0x0f1f, 0x0f07, 0x0f0f, 0x0f07,
+    0x0f3f, 0x0f07, 0x0f0f, 0x0f07, 0x0f1f, 0x0f07, 0x0f0f, 0x0f07, 0x0f7f, 0x0f07, 0x0f0f, 0x0f07,
+    0x0f1f, 0x0f07, 0x0f0f, 0x0f07, 0x0f3f, 0x0f07, 0x0f0f, 0x0f07, 0x0f1f, 0x0f07, 0x0f0f, 0x0f07,
+    0x01ff, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x017f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x03ff, 0x0307, 0x030f, 0x0307,
+    0x031f, 0x0307, 0x030f, 0x0307, 0x033f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307,
+    0x037f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307, 0x033f, 0x0307, 0x030f, 0x0307,
+    0x031f, 0x0307, 0x030f, 0x0307, 0x01ff, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x017f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x07ff, 0x0707, 0x070f, 0x0707, 0x071f, 0x0707, 0x070f, 0x0707, 0x073f, 0x0707, 0x070f, 0x0707,
+    0x071f, 0x0707, 0x070f, 0x0707, 0x077f, 0x0707, 0x070f, 0x0707, 0x071f, 0x0707, 0x070f, 0x0707,
+    0x073f, 0x0707, 0x070f, 0x0707, 0x071f, 0x0707, 0x070f, 0x0707, 0x01ff, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x017f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x03ff, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307,
+    0x033f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307, 0x037f, 0x0307, 0x030f, 0x0307,
+    0x031f, 0x0307, 0x030f, 0x0307, 0x033f, 0x0307, 0x030f, 0x0307, 0x031f, 0x0307, 0x030f, 0x0307,
+    0x01ff, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x013f, 0x0107, 0x010f, 0x0107,
+    0x011f, 0x0107, 0x010f, 0x0107, 0x017f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107,
+    0x013f, 0x0107, 0x010f, 0x0107, 0x011f, 0x0107, 0x010f, 0x0107, 0x3fff, 0x3ffd, 0x3f0f, 0x3f0d,
+    0x3f1f, 0x3f1d, 0x3f0f, 0x3f0d, 0x3f3f, 0x3f3d, 0x3f0f, 0x3f0d, 0x3f1f, 0x3f1d, 0x3f0f, 0x3f0d,
+    0x3f7f, 0x3f7d, 0x3f0f, 0x3f0d, 0x3f1f, 0x3f1d, 0x3f0f, 0x3f0d, 0x3f3f, 0x3f3d, 0x3f0f, 0x3f0d,
+    0x3f1f, 0x3f1d, 0x3f0f, 0x3f0d, 0x01ff, 0x01fd, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x017f, 0x017d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x03ff, 0x03fd, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d, 0x033f, 0x033d, 0x030f, 0x030d,
+    0x031f, 0x031d, 0x030f, 0x030d, 0x037f, 0x037d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d,
+    0x033f, 0x033d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d, 0x01ff, 0x01fd, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x017f, 0x017d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x07ff, 0x07fd, 0x070f, 0x070d, 0x071f, 0x071d, 0x070f, 0x070d,
+    0x073f, 0x073d, 0x070f, 0x070d, 0x071f, 0x071d, 0x070f, 0x070d, 0x077f, 0x077d, 0x070f, 0x070d,
+    0x071f, 0x071d, 0x070f, 0x070d, 0x073f, 0x073d, 0x070f, 0x070d, 0x071f, 0x071d, 0x070f, 0x070d,
+    0x01ff, 0x01fd, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x017f, 0x017d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x03ff, 0x03fd, 0x030f, 0x030d,
+    0x031f, 0x031d, 0x030f, 0x030d, 0x033f, 0x033d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d,
+    0x037f, 0x037d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d, 0x033f, 0x033d, 0x030f, 0x030d,
+    0x031f, 0x031d, 0x030f, 0x030d, 0x01ff, 0x01fd, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x017f, 0x017d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x0fff, 0x0ffd, 0x0f0f, 0x0f0d, 0x0f1f, 0x0f1d, 0x0f0f, 0x0f0d, 0x0f3f, 0x0f3d, 0x0f0f, 0x0f0d,
+    0x0f1f, 0x0f1d, 0x0f0f, 0x0f0d, 0x0f7f, 0x0f7d, 0x0f0f, 0x0f0d, 0x0f1f, 0x0f1d, 0x0f0f, 0x0f0d,
+    0x0f3f, 0x0f3d, 0x0f0f, 0x0f0d, 0x0f1f, 0x0f1d, 0x0f0f, 0x0f0d, 0x01ff, 0x01fd, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x017f, 0x017d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x03ff, 0x03fd, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d,
+    0x033f, 0x033d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d, 0x037f, 0x037d, 0x030f, 0x030d,
+    0x031f, 0x031d, 0x030f, 0x030d, 0x033f, 0x033d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d,
+    0x01ff, 0x01fd, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x017f, 0x017d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x07ff, 0x07fd, 0x070f, 0x070d,
+    0x071f, 0x071d, 0x070f, 0x070d, 0x073f, 0x073d, 0x070f, 0x070d, 0x071f, 0x071d, 0x070f, 0x070d,
+    0x077f, 0x077d, 0x070f, 0x070d, 0x071f, 0x071d, 0x070f, 0x070d, 0x073f, 0x073d, 0x070f, 0x070d,
+    0x071f, 0x071d, 0x070f, 0x070d, 0x01ff, 0x01fd, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x017f, 0x017d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x03ff, 0x03fd, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d, 0x033f, 0x033d, 0x030f, 0x030d,
+    0x031f, 0x031d, 0x030f, 0x030d, 0x037f, 0x037d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d,
+    0x033f, 0x033d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d, 0x01ff, 0x01fd, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x017f, 0x017d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x1fff, 0x1ffd, 0x1f0f, 0x1f0d, 0x1f1f, 0x1f1d, 0x1f0f, 0x1f0d,
+    0x1f3f, 0x1f3d, 0x1f0f, 0x1f0d, 0x1f1f, 0x1f1d, 0x1f0f, 0x1f0d, 0x1f7f, 0x1f7d, 0x1f0f, 0x1f0d,
+    0x1f1f, 0x1f1d, 0x1f0f, 0x1f0d, 0x1f3f, 0x1f3d, 0x1f0f, 0x1f0d, 0x1f1f, 0x1f1d, 0x1f0f, 0x1f0d,
+    0x01ff, 0x01fd, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x017f, 0x017d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x03ff, 0x03fd, 0x030f, 0x030d,
+    0x031f, 0x031d, 0x030f, 0x030d, 0x033f, 0x033d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d,
+    0x037f, 0x037d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d, 0x033f, 0x033d, 0x030f, 0x030d,
+    0x031f, 0x031d, 0x030f, 0x030d, 0x01ff, 0x01fd, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x017f, 0x017d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x07ff, 0x07fd, 0x070f, 0x070d, 0x071f, 0x071d, 0x070f, 0x070d, 0x073f, 0x073d, 0x070f, 0x070d,
+    0x071f, 0x071d, 0x070f, 0x070d, 0x077f, 0x077d, 0x070f, 0x070d, 0x071f, 0x071d, 0x070f, 0x070d,
+    0x073f, 0x073d, 0x070f, 0x070d, 0x071f, 0x071d, 0x070f, 0x070d, 0x01ff, 0x01fd, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x017f, 0x017d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x03ff, 0x03fd, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d,
+    0x033f, 0x033d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d, 0x037f, 0x037d, 0x030f, 0x030d,
+    0x031f, 0x031d, 0x030f, 0x030d, 0x033f, 0x033d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d,
+    0x01ff, 0x01fd, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x017f, 0x017d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x0fff, 0x0ffd, 0x0f0f, 0x0f0d,
+    0x0f1f, 0x0f1d, 0x0f0f, 0x0f0d, 0x0f3f, 0x0f3d, 0x0f0f, 0x0f0d, 0x0f1f, 0x0f1d, 0x0f0f, 0x0f0d,
+    0x0f7f, 0x0f7d, 0x0f0f, 0x0f0d, 0x0f1f, 0x0f1d, 0x0f0f, 0x0f0d, 0x0f3f, 0x0f3d, 0x0f0f, 0x0f0d,
+    0x0f1f, 0x0f1d, 0x0f0f, 0x0f0d, 0x01ff, 0x01fd, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x017f, 0x017d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x03ff, 0x03fd, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d, 0x033f, 0x033d, 0x030f, 0x030d,
+    0x031f, 0x031d, 0x030f, 0x030d, 0x037f, 0x037d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d,
+    0x033f, 0x033d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d, 0x01ff, 0x01fd, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x017f, 0x017d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x07ff, 0x07fd, 0x070f, 0x070d, 0x071f, 0x071d, 0x070f, 0x070d,
+    0x073f, 0x073d, 0x070f, 0x070d, 0x071f, 0x071d, 0x070f, 0x070d, 0x077f, 0x077d, 0x070f, 0x070d,
+    0x071f, 0x071d, 0x070f, 0x070d, 0x073f, 0x073d, 0x070f, 0x070d, 0x071f, 0x071d, 0x070f, 0x070d,
+    0x01ff, 0x01fd, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x017f, 0x017d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x03ff, 0x03fd, 0x030f, 0x030d,
+    0x031f, 0x031d, 0x030f, 0x030d, 0x033f, 0x033d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d,
+    0x037f, 0x037d, 0x030f, 0x030d, 0x031f, 0x031d, 0x030f, 0x030d, 0x033f, 0x033d, 0x030f, 0x030d,
+    0x031f, 0x031d, 0x030f, 0x030d, 0x01ff, 0x01fd, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d, 0x017f, 0x017d, 0x010f, 0x010d,
+    0x011f, 0x011d, 0x010f, 0x010d, 0x013f, 0x013d, 0x010f, 0x010d, 0x011f, 0x011d, 0x010f, 0x010d,
+    0x3fff, 0x3ffd, 0x3ff9, 0x3ff9, 0x3f1f, 0x3f1d, 0x3f19, 0x3f19, 0x3f3f, 0x3f3d, 0x3f39, 0x3f39,
+    0x3f1f, 0x3f1d, 0x3f19, 0x3f19, 0x3f7f, 0x3f7d, 0x3f79, 0x3f79, 0x3f1f, 0x3f1d, 0x3f19, 0x3f19,
+    0x3f3f, 0x3f3d, 0x3f39, 0x3f39, 0x3f1f, 0x3f1d, 0x3f19, 0x3f19, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x031f, 0x031d, 0x0319, 0x0319,
+    0x033f, 0x033d, 0x0339, 0x0339, 0x031f, 0x031d, 0x0319, 0x0319, 0x037f, 0x037d, 0x0379, 0x0379,
+    0x031f, 0x031d, 0x0319, 0x0319, 0x033f, 0x033d, 0x0339, 0x0339, 0x031f, 0x031d, 0x0319, 0x0319,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x017f, 0x017d, 0x0179, 0x0179, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119, 0x07ff, 0x07fd, 0x07f9, 0x07f9,
+    0x071f, 0x071d, 0x0719, 0x0719, 0x073f, 0x073d, 0x0739, 0x0739, 0x071f, 0x071d, 0x0719, 0x0719,
+    0x077f, 0x077d, 0x0779, 0x0779, 0x071f, 0x071d, 0x0719, 0x0719, 0x073f, 0x073d, 0x0739, 0x0739,
+    0x071f, 0x071d, 0x0719, 0x0719, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x031f, 0x031d, 0x0319, 0x0319, 0x033f, 0x033d, 0x0339, 0x0339,
+    0x031f, 0x031d, 0x0319, 0x0319, 0x037f, 0x037d, 0x0379, 0x0379, 0x031f, 0x031d, 0x0319, 0x0319,
+    0x033f, 0x033d, 0x0339, 0x0339, 0x031f, 0x031d, 0x0319, 0x0319, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x0fff, 0x0ffd, 0x0ff9, 0x0ff9, 0x0f1f, 0x0f1d, 0x0f19, 0x0f19,
+    0x0f3f, 0x0f3d, 0x0f39, 0x0f39, 0x0f1f, 0x0f1d, 0x0f19, 0x0f19, 0x0f7f, 0x0f7d, 0x0f79, 0x0f79,
+    0x0f1f, 0x0f1d, 0x0f19, 0x0f19, 0x0f3f, 0x0f3d, 0x0f39, 0x0f39, 0x0f1f, 0x0f1d, 0x0f19, 0x0f19,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x017f, 0x017d, 0x0179, 0x0179, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x031f, 0x031d, 0x0319, 0x0319, 0x033f, 0x033d, 0x0339, 0x0339, 0x031f, 0x031d, 0x0319, 0x0319,
+    0x037f, 0x037d, 0x0379, 0x0379, 0x031f, 0x031d, 0x0319, 0x0319, 0x033f, 0x033d, 0x0339, 0x0339,
+    0x031f, 0x031d, 0x0319, 0x0319, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x071f, 0x071d, 0x0719, 0x0719, 0x073f, 0x073d, 0x0739, 0x0739,
+    0x071f, 0x071d, 0x0719, 0x0719, 0x077f, 0x077d, 0x0779, 0x0779, 0x071f, 0x071d, 0x0719, 0x0719,
+    0x073f, 0x073d, 0x0739, 0x0739, 0x071f, 0x071d, 0x0719, 0x0719, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x031f, 0x031d, 0x0319, 0x0319,
+    0x033f, 0x033d, 0x0339, 0x0339, 0x031f, 0x031d, 0x0319, 0x0319, 0x037f, 0x037d, 0x0379, 0x0379,
+    0x031f, 0x031d, 0x0319, 0x0319, 0x033f, 0x033d, 0x0339, 0x0339, 0x031f, 0x031d, 0x0319, 0x0319,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x017f, 0x017d, 0x0179, 0x0179, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119, 0x1fff, 0x1ffd, 0x1ff9, 0x1ff9,
+    0x1f1f, 0x1f1d, 0x1f19, 0x1f19, 0x1f3f, 0x1f3d, 0x1f39, 0x1f39, 0x1f1f, 0x1f1d, 0x1f19, 0x1f19,
+    0x1f7f, 0x1f7d, 0x1f79, 0x1f79, 0x1f1f, 0x1f1d, 0x1f19, 0x1f19, 0x1f3f, 0x1f3d, 0x1f39, 0x1f39,
+    0x1f1f, 0x1f1d, 0x1f19, 0x1f19, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x031f, 0x031d, 0x0319, 0x0319, 0x033f, 0x033d, 0x0339, 0x0339,
+    0x031f, 0x031d, 0x0319, 0x0319, 0x037f, 0x037d, 0x0379, 0x0379, 0x031f, 0x031d, 0x0319, 0x0319,
+    0x033f, 0x033d, 0x0339, 0x0339, 0x031f, 0x031d, 0x0319, 0x0319, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x071f, 0x071d, 0x0719, 0x0719,
+    0x073f, 0x073d, 0x0739, 0x0739, 0x071f, 0x071d, 0x0719, 0x0719, 0x077f, 0x077d, 0x0779, 0x0779,
+    0x071f, 0x071d, 0x0719, 0x0719, 0x073f, 0x073d, 0x0739, 0x0739, 0x071f, 0x071d, 0x0719, 0x0719,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x017f, 0x017d, 0x0179, 0x0179, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x031f, 0x031d, 0x0319, 0x0319, 0x033f, 0x033d, 0x0339, 0x0339, 0x031f, 0x031d, 0x0319, 0x0319,
+    0x037f, 0x037d, 0x0379, 0x0379, 0x031f, 0x031d, 0x0319, 0x0319, 0x033f, 0x033d, 0x0339, 0x0339,
+    0x031f, 0x031d, 0x0319, 0x0319, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x0fff, 0x0ffd, 0x0ff9, 0x0ff9, 0x0f1f, 0x0f1d, 0x0f19, 0x0f19, 0x0f3f, 0x0f3d, 0x0f39, 0x0f39,
+    0x0f1f, 0x0f1d, 0x0f19, 0x0f19, 0x0f7f, 0x0f7d, 0x0f79, 0x0f79, 0x0f1f, 0x0f1d, 0x0f19, 0x0f19,
+    0x0f3f, 0x0f3d, 0x0f39, 0x0f39, 0x0f1f, 0x0f1d, 0x0f19, 0x0f19, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x031f, 0x031d, 0x0319, 0x0319,
+    0x033f, 0x033d, 0x0339, 0x0339, 0x031f, 0x031d, 0x0319, 0x0319, 0x037f, 0x037d, 0x0379, 0x0379,
+    0x031f, 0x031d, 0x0319, 0x0319, 0x033f, 0x033d, 0x0339, 0x0339, 0x031f, 0x031d, 0x0319, 0x0319,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x017f, 0x017d, 0x0179, 0x0179, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119, 0x07ff, 0x07fd, 0x07f9, 0x07f9,
+    0x071f, 0x071d, 0x0719, 0x0719, 0x073f, 0x073d, 0x0739, 0x0739, 0x071f, 0x071d, 0x0719, 0x0719,
+    0x077f, 0x077d, 0x0779, 0x0779, 0x071f, 0x071d, 0x0719, 0x0719, 0x073f, 0x073d, 0x0739, 0x0739,
+    0x071f, 0x071d, 0x0719, 0x0719, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x031f, 0x031d, 0x0319, 0x0319, 0x033f, 0x033d, 0x0339, 0x0339,
+    0x031f, 0x031d, 0x0319, 0x0319, 0x037f, 0x037d, 0x0379, 0x0379, 0x031f, 0x031d, 0x0319, 0x0319,
+    0x033f, 0x033d, 0x0339, 0x0339, 0x031f, 0x031d, 0x0319, 0x0319, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139, 0x011f, 0x011d, 0x0119, 0x0119,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x011f, 0x011d, 0x0119, 0x0119, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x011f, 0x011d, 0x0119, 0x0119, 0x3fff, 0x3ffd, 0x3ff9, 0x3ff9, 0x3ff1, 0x3ff1, 0x3ff1, 0x3ff1,
+    0x3f3f, 0x3f3d, 0x3f39, 0x3f39, 0x3f31, 0x3f31, 0x3f31, 0x3f31, 0x3f7f, 0x3f7d, 0x3f79, 0x3f79,
+    0x3f71, 0x3f71, 0x3f71, 0x3f71, 0x3f3f, 0x3f3d, 0x3f39, 0x3f39, 0x3f31, 0x3f31, 0x3f31, 0x3f31,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x033f, 0x033d, 0x0339, 0x0339, 0x0331, 0x0331, 0x0331, 0x0331,
+    0x037f, 0x037d, 0x0379, 0x0379, 0x0371, 0x0371, 0x0371, 0x0371, 0x033f, 0x033d, 0x0339, 0x0339,
+    0x0331, 0x0331, 0x0331, 0x0331, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x073f, 0x073d, 0x0739, 0x0739,
+    0x0731, 0x0731, 0x0731, 0x0731, 0x077f, 0x077d, 0x0779, 0x0779, 0x0771, 0x0771, 0x0771, 0x0771,
+    0x073f, 0x073d, 0x0739, 0x0739, 0x0731, 0x0731, 0x0731, 0x0731, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1,
+    0x033f, 0x033d, 0x0339, 0x0339, 0x0331, 0x0331, 0x0331, 0x0331, 0x037f, 0x037d, 0x0379, 0x0379,
+    0x0371, 0x0371, 0x0371, 0x0371, 0x033f, 0x033d, 0x0339, 0x0339, 0x0331, 0x0331, 0x0331, 0x0331,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131, 0x0fff, 0x0ffd, 0x0ff9, 0x0ff9,
+    0x0ff1, 0x0ff1, 0x0ff1, 0x0ff1, 0x0f3f, 0x0f3d, 0x0f39, 0x0f39, 0x0f31, 0x0f31, 0x0f31, 0x0f31,
+    0x0f7f, 0x0f7d, 0x0f79, 0x0f79, 0x0f71, 0x0f71, 0x0f71, 0x0f71, 0x0f3f, 0x0f3d, 0x0f39, 0x0f39,
+    0x0f31, 0x0f31, 0x0f31, 0x0f31, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x033f, 0x033d, 0x0339, 0x0339,
+    0x0331, 0x0331, 0x0331, 0x0331, 0x037f, 0x037d, 0x0379, 0x0379, 0x0371, 0x0371, 0x0371, 0x0371,
+    0x033f, 0x033d, 0x0339, 0x0339, 0x0331, 0x0331, 0x0331, 0x0331, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x07f1, 0x07f1, 0x07f1, 0x07f1,
+    0x073f, 0x073d, 0x0739, 0x0739, 0x0731, 0x0731, 0x0731, 0x0731, 0x077f, 0x077d, 0x0779, 0x0779,
+    0x0771, 0x0771, 0x0771, 0x0771, 0x073f, 0x073d, 0x0739, 0x0739, 0x0731, 0x0731, 0x0731, 0x0731,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x033f, 0x033d, 0x0339, 0x0339, 0x0331, 0x0331, 0x0331, 0x0331,
+    0x037f, 0x037d, 0x0379, 0x0379, 0x0371, 0x0371, 0x0371, 0x0371, 0x033f, 0x033d, 0x0339, 0x0339,
+    0x0331, 0x0331, 0x0331, 0x0331, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x1fff, 0x1ffd, 0x1ff9, 0x1ff9, 0x1ff1, 0x1ff1, 0x1ff1, 0x1ff1, 0x1f3f, 0x1f3d, 0x1f39, 0x1f39,
+    0x1f31, 0x1f31, 0x1f31, 0x1f31, 0x1f7f, 0x1f7d, 0x1f79, 0x1f79, 0x1f71, 0x1f71, 0x1f71, 0x1f71,
+    0x1f3f, 0x1f3d, 0x1f39, 0x1f39, 0x1f31, 0x1f31, 0x1f31, 0x1f31, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1,
+    0x033f, 0x033d, 0x0339, 0x0339, 0x0331, 0x0331, 0x0331, 0x0331, 0x037f, 0x037d, 0x0379, 0x0379,
+    0x0371, 0x0371, 0x0371, 0x0371, 0x033f, 0x033d, 0x0339, 0x0339, 0x0331, 0x0331, 0x0331, 0x0331,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131, 0x07ff, 0x07fd, 0x07f9, 0x07f9,
+    0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x073f, 0x073d, 0x0739, 0x0739, 0x0731, 0x0731, 0x0731, 0x0731,
+    0x077f, 0x077d, 0x0779, 0x0779, 0x0771, 0x0771, 0x0771, 0x0771, 0x073f, 0x073d, 0x0739, 0x0739,
+    0x0731, 0x0731, 0x0731, 0x0731, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x033f, 0x033d, 0x0339, 0x0339,
+    0x0331, 0x0331, 0x0331, 0x0331, 0x037f, 0x037d, 0x0379, 0x0379, 0x0371, 0x0371, 0x0371, 0x0371,
+    0x033f, 0x033d, 0x0339, 0x0339, 0x0331, 0x0331, 0x0331, 0x0331, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0fff, 0x0ffd, 0x0ff9, 0x0ff9, 0x0ff1, 0x0ff1, 0x0ff1, 0x0ff1,
+    0x0f3f, 0x0f3d, 0x0f39, 0x0f39, 0x0f31, 0x0f31, 0x0f31, 0x0f31, 0x0f7f, 0x0f7d, 0x0f79, 0x0f79,
+    0x0f71, 0x0f71, 0x0f71, 0x0f71, 0x0f3f, 0x0f3d, 0x0f39, 0x0f39, 0x0f31, 0x0f31, 0x0f31, 0x0f31,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x033f, 0x033d, 0x0339, 0x0339, 0x0331, 0x0331, 0x0331, 0x0331,
+    0x037f, 0x037d, 0x0379, 0x0379, 0x0371, 0x0371, 0x0371, 0x0371, 0x033f, 0x033d, 0x0339, 0x0339,
+    0x0331, 0x0331, 0x0331, 0x0331, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x073f, 0x073d, 0x0739, 0x0739,
+    0x0731, 0x0731, 0x0731, 0x0731, 0x077f, 0x077d, 0x0779, 0x0779, 0x0771, 0x0771, 0x0771, 0x0771,
+    0x073f, 0x073d, 0x0739, 0x0739, 0x0731, 0x0731, 0x0731, 0x0731, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1,
+    0x033f, 0x033d, 0x0339, 0x0339, 0x0331, 0x0331, 0x0331, 0x0331, 0x037f, 0x037d, 0x0379, 0x0379,
+    0x0371, 0x0371, 0x0371, 0x0371, 0x033f, 0x033d, 0x0339, 0x0339, 0x0331, 0x0331, 0x0331, 0x0331,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x013f, 0x013d, 0x0139, 0x0139,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x013f, 0x013d, 0x0139, 0x0139, 0x0131, 0x0131, 0x0131, 0x0131, 0x3fff, 0x3ffd, 0x3ff9, 0x3ff9,
+    0x3ff1, 0x3ff1, 0x3ff1, 0x3ff1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1,
+    0x3f7f, 0x3f7d, 0x3f79, 0x3f79, 0x3f71, 0x3f71, 0x3f71, 0x3f71, 0x3f61, 0x3f61, 0x3f61, 0x3f61,
+    0x3f61, 0x3f61, 0x3f61, 0x3f61, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x037f, 0x037d, 0x0379, 0x0379, 0x0371, 0x0371, 0x0371, 0x0371,
+    0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171, 0x0161, 0x0161, 0x0161, 0x0161,
+    0x0161, 0x0161, 0x0161, 0x0161, 0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x07f1, 0x07f1, 0x07f1, 0x07f1,
+    0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x077f, 0x077d, 0x0779, 0x0779,
+    0x0771, 0x0771, 0x0771, 0x0771, 0x0761, 0x0761, 0x0761, 0x0761, 0x0761, 0x0761, 0x0761, 0x0761,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x037f, 0x037d, 0x0379, 0x0379, 0x0371, 0x0371, 0x0371, 0x0371, 0x0361, 0x0361, 0x0361, 0x0361,
+    0x0361, 0x0361, 0x0361, 0x0361, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161,
+    0x0fff, 0x0ffd, 0x0ff9, 0x0ff9, 0x0ff1, 0x0ff1, 0x0ff1, 0x0ff1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1,
+    0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0f7f, 0x0f7d, 0x0f79, 0x0f79, 0x0f71, 0x0f71, 0x0f71, 0x0f71,
+    0x0f61, 0x0f61, 0x0f61, 0x0f61, 0x0f61, 0x0f61, 0x0f61, 0x0f61, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171, 0x0161, 0x0161, 0x0161, 0x0161,
+    0x0161, 0x0161, 0x0161, 0x0161, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x037f, 0x037d, 0x0379, 0x0379,
+    0x0371, 0x0371, 0x0371, 0x0371, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x07ff, 0x07fd, 0x07f9, 0x07f9,
+    0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1,
+    0x077f, 0x077d, 0x0779, 0x0779, 0x0771, 0x0771, 0x0771, 0x0771, 0x0761, 0x0761, 0x0761, 0x0761,
+    0x0761, 0x0761, 0x0761, 0x0761, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x037f, 0x037d, 0x0379, 0x0379, 0x0371, 0x0371, 0x0371, 0x0371,
+    0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171, 0x0161, 0x0161, 0x0161, 0x0161,
+    0x0161, 0x0161, 0x0161, 0x0161, 0x1fff, 0x1ffd, 0x1ff9, 0x1ff9, 0x1ff1, 0x1ff1, 0x1ff1, 0x1ff1,
+    0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1f7f, 0x1f7d, 0x1f79, 0x1f79,
+    0x1f71, 0x1f71, 0x1f71, 0x1f71, 0x1f61, 0x1f61, 0x1f61, 0x1f61, 0x1f61, 0x1f61, 0x1f61, 0x1f61,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x037f, 0x037d, 0x0379, 0x0379, 0x0371, 0x0371, 0x0371, 0x0371, 0x0361, 0x0361, 0x0361, 0x0361,
+    0x0361, 0x0361, 0x0361, 0x0361, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161,
+    0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x07e1, 0x07e1, 0x07e1, 0x07e1,
+    0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x077f, 0x077d, 0x0779, 0x0779, 0x0771, 0x0771, 0x0771, 0x0771,
+    0x0761, 0x0761, 0x0761, 0x0761, 0x0761, 0x0761, 0x0761, 0x0761, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171, 0x0161, 0x0161, 0x0161, 0x0161,
+    0x0161, 0x0161, 0x0161, 0x0161, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x037f, 0x037d, 0x0379, 0x0379,
+    0x0371, 0x0371, 0x0371, 0x0371, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0fff, 0x0ffd, 0x0ff9, 0x0ff9,
+    0x0ff1, 0x0ff1, 0x0ff1, 0x0ff1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1,
+    0x0f7f, 0x0f7d, 0x0f79, 0x0f79, 0x0f71, 0x0f71, 0x0f71, 0x0f71, 0x0f61, 0x0f61, 0x0f61, 0x0f61,
+    0x0f61, 0x0f61, 0x0f61, 0x0f61, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x037f, 0x037d, 0x0379, 0x0379, 0x0371, 0x0371, 0x0371, 0x0371,
+    0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171, 0x0161, 0x0161, 0x0161, 0x0161,
+    0x0161, 0x0161, 0x0161, 0x0161, 0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x07f1, 0x07f1, 0x07f1, 0x07f1,
+    0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x077f, 0x077d, 0x0779, 0x0779,
+    0x0771, 0x0771, 0x0771, 0x0771, 0x0761, 0x0761, 0x0761, 0x0761, 0x0761, 0x0761, 0x0761, 0x0761,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x017f, 0x017d, 0x0179, 0x0179, 0x0171, 0x0171, 0x0171, 0x0171,
+    0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x037f, 0x037d, 0x0379, 0x0379, 0x0371, 0x0371, 0x0371, 0x0371, 0x0361, 0x0361, 0x0361, 0x0361,
+    0x0361, 0x0361, 0x0361, 0x0361, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x017f, 0x017d, 0x0179, 0x0179,
+    0x0171, 0x0171, 0x0171, 0x0171, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161,
+    0x3fff, 0x3ffd, 0x3ff9, 0x3ff9, 0x3ff1, 0x3ff1, 0x3ff1, 0x3ff1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1,
+    0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1,
+    0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x07ff, 0x07fd, 0x07f9, 0x07f9,
+    0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0fff, 0x0ffd, 0x0ff9, 0x0ff9, 0x0ff1, 0x0ff1, 0x0ff1, 0x0ff1,
+    0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1,
+    0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x07e1, 0x07e1, 0x07e1, 0x07e1,
+    0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x1fff, 0x1ffd, 0x1ff9, 0x1ff9,
+    0x1ff1, 0x1ff1, 0x1ff1, 0x1ff1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1,
+    0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1,
+    0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x07f1, 0x07f1, 0x07f1, 0x07f1,
+    0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07c1, 0x07c1, 0x07c1, 0x07c1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x0fff, 0x0ffd, 0x0ff9, 0x0ff9, 0x0ff1, 0x0ff1, 0x0ff1, 0x0ff1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1,
+    0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1,
+    0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x07ff, 0x07fd, 0x07f9, 0x07f9,
+    0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x3fff, 0x3ffd, 0x3ff9, 0x3ff9, 0x3ff1, 0x3ff1, 0x3ff1, 0x3ff1,
+    0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fe1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1,
+    0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1, 0x3fc1,
+    0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81,
+    0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81,
+    0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x3f81, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x07ff, 0x07fd, 0x07f9, 0x07f9,
+    0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781,
+    0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781,
+    0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0fff, 0x0ffd, 0x0ff9, 0x0ff9, 0x0ff1, 0x0ff1, 0x0ff1, 0x0ff1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1,
+    0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1,
+    0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0f81, 0x0f81, 0x0f81, 0x0f81,
+    0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81,
+    0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81,
+    0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x07f1, 0x07f1, 0x07f1, 0x07f1,
+    0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07c1, 0x07c1, 0x07c1, 0x07c1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1,
+    0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781,
+    0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781,
+    0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x1fff, 0x1ffd, 0x1ff9, 0x1ff9,
+    0x1ff1, 0x1ff1, 0x1ff1, 0x1ff1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1, 0x1fe1,
+    0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1,
+    0x1fc1, 0x1fc1, 0x1fc1, 0x1fc1, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81,
+    0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81,
+    0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81, 0x1f81,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x07ff, 0x07fd, 0x07f9, 0x07f9, 0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x07e1, 0x07e1, 0x07e1, 0x07e1,
+    0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x0781, 0x0781, 0x0781, 0x0781,
+    0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781,
+    0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781,
+    0x0781, 0x0781, 0x0781, 0x0781, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x03ff, 0x03fd, 0x03f9, 0x03f9,
+    0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0fff, 0x0ffd, 0x0ff9, 0x0ff9, 0x0ff1, 0x0ff1, 0x0ff1, 0x0ff1,
+    0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fe1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1,
+    0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1, 0x0fc1,
+    0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81,
+    0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81,
+    0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x0f81, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1, 0x03e1, 0x03e1, 0x03e1, 0x03e1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x07ff, 0x07fd, 0x07f9, 0x07f9,
+    0x07f1, 0x07f1, 0x07f1, 0x07f1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1, 0x07e1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x07c1,
+    0x07c1, 0x07c1, 0x07c1, 0x07c1, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781,
+    0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781,
+    0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781, 0x0781,
+    0x01ff, 0x01fd, 0x01f9, 0x01f9, 0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x03ff, 0x03fd, 0x03f9, 0x03f9, 0x03f1, 0x03f1, 0x03f1, 0x03f1,
+    0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03e1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1, 0x03c1,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+    0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x01ff, 0x01fd, 0x01f9, 0x01f9,
+    0x01f1, 0x01f1, 0x01f1, 0x01f1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1, 0x01e1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x01c1,
+    0x01c1, 0x01c1, 0x01c1, 0x01c1, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+    0x3fff, 0x3ffe, 0x3e07, 0x3e06, 0x3e0f, 0x3e0e, 0x3e07, 0x3e06, 0x3e1f, 0x3e1e, 0x3e07, 0x3e06,
+    0x3e0f, 0x3e0e, 0x3e07, 0x3e06, 0x3e3f, 0x3e3e, 0x3e07, 0x3e06, 0x3e0f, 0x3e0e, 0x3e07, 0x3e06,
+    0x3e1f, 0x3e1e, 0x3e07, 0x3e06, 0x3e0f, 0x3e0e, 0x3e07, 0x3e06, 0x3e7f, 0x3e7e, 0x3e07, 0x3e06,
+    0x3e0f, 0x3e0e, 0x3e07, 0x3e06, 0x3e1f, 0x3e1e, 0x3e07, 0x3e06, 0x3e0f, 0x3e0e, 0x3e07, 0x3e06,
+    0x3e3f, 0x3e3e, 0x3e07, 0x3e06, 0x3e0f, 0x3e0e, 0x3e07, 0x3e06, 0x3e1f, 0x3e1e, 0x3e07, 0x3e06,
+    0x3e0f, 0x3e0e, 0x3e07, 0x3e06, 0x3eff, 0x3efe, 0x3e07, 0x3e06, 0x3e0f, 0x3e0e, 0x3e07, 0x3e06,
+    0x3e1f, 0x3e1e, 0x3e07, 0x3e06, 0x3e0f, 0x3e0e, 0x3e07, 0x3e06, 0x3e3f, 0x3e3e, 0x3e07, 0x3e06,
+    0x3e0f, 0x3e0e, 0x3e07, 0x3e06, 0x3e1f, 0x3e1e, 0x3e07, 0x3e06, 0x3e0f, 0x3e0e, 0x3e07, 0x3e06,
+    0x3e7f, 0x3e7e, 0x3e07, 0x3e06, 0x3e0f, 0x3e0e, 0x3e07, 0x3e06, 0x3e1f, 0x3e1e, 0x3e07, 0x3e06,
+    0x3e0f, 0x3e0e, 0x3e07, 0x3e06, 0x3e3f, 0x3e3e, 0x3e07, 0x3e06, 0x3e0f, 0x3e0e, 0x3e07, 0x3e06,
+    0x3e1f, 0x3e1e, 0x3e07, 0x3e06, 0x3e0f, 0x3e0e, 0x3e07, 0x3e06, 0x03ff, 0x03fe, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x027f, 0x027e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x02ff, 0x02fe, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x027f, 0x027e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x07ff, 0x07fe, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x063f, 0x063e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x067f, 0x067e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x063f, 0x063e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x06ff, 0x06fe, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x063f, 0x063e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x067f, 0x067e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x063f, 0x063e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x03ff, 0x03fe, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x027f, 0x027e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x02ff, 0x02fe, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x027f, 0x027e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x0fff, 0x0ffe, 0x0e07, 0x0e06,
+    0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e1f, 0x0e1e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06,
+    0x0e3f, 0x0e3e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e1f, 0x0e1e, 0x0e07, 0x0e06,
+    0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e7f, 0x0e7e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06,
+    0x0e1f, 0x0e1e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e3f, 0x0e3e, 0x0e07, 0x0e06,
+    0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e1f, 0x0e1e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06,
+    0x0eff, 0x0efe, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e1f, 0x0e1e, 0x0e07, 0x0e06,
+    0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e3f, 0x0e3e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06,
+    0x0e1f, 0x0e1e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e7f, 0x0e7e, 0x0e07, 0x0e06,
+    0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e1f, 0x0e1e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06,
+    0x0e3f, 0x0e3e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e1f, 0x0e1e, 0x0e07, 0x0e06,
+    0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x03ff, 0x03fe, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x027f, 0x027e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x02ff, 0x02fe, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x027f, 0x027e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x07ff, 0x07fe, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x063f, 0x063e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x067f, 0x067e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x063f, 0x063e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x06ff, 0x06fe, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x063f, 0x063e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x067f, 0x067e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x063f, 0x063e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x03ff, 0x03fe, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x027f, 0x027e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x02ff, 0x02fe, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x027f, 0x027e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x1fff, 0x1ffe, 0x1e07, 0x1e06, 0x1e0f, 0x1e0e, 0x1e07, 0x1e06,
+    0x1e1f, 0x1e1e, 0x1e07, 0x1e06, 0x1e0f, 0x1e0e, 0x1e07, 0x1e06, 0x1e3f, 0x1e3e, 0x1e07, 0x1e06,
+    0x1e0f, 0x1e0e, 0x1e07, 0x1e06, 0x1e1f, 0x1e1e, 0x1e07, 0x1e06, 0x1e0f, 0x1e0e, 0x1e07, 0x1e06,
+    0x1e7f, 0x1e7e, 0x1e07, 0x1e06, 0x1e0f, 0x1e0e, 0x1e07, 0x1e06, 0x1e1f, 0x1e1e, 0x1e07, 0x1e06,
+    0x1e0f, 0x1e0e, 0x1e07, 0x1e06, 0x1e3f, 0x1e3e, 0x1e07, 0x1e06, 0x1e0f, 0x1e0e, 0x1e07, 0x1e06,
+    0x1e1f, 0x1e1e, 0x1e07, 0x1e06, 0x1e0f, 0x1e0e, 0x1e07, 0x1e06, 0x1eff, 0x1efe, 0x1e07, 0x1e06,
+    0x1e0f, 0x1e0e, 0x1e07, 0x1e06, 0x1e1f, 0x1e1e, 0x1e07, 0x1e06, 0x1e0f, 0x1e0e, 0x1e07, 0x1e06,
+    0x1e3f, 0x1e3e, 0x1e07, 0x1e06, 0x1e0f, 0x1e0e, 0x1e07, 0x1e06, 0x1e1f, 0x1e1e, 0x1e07, 0x1e06,
+    0x1e0f, 0x1e0e, 0x1e07, 0x1e06, 0x1e7f, 0x1e7e, 0x1e07, 0x1e06, 0x1e0f, 0x1e0e, 0x1e07, 0x1e06,
+    0x1e1f, 0x1e1e, 0x1e07, 0x1e06, 0x1e0f, 0x1e0e, 0x1e07, 0x1e06, 0x1e3f, 0x1e3e, 0x1e07, 0x1e06,
+    0x1e0f, 0x1e0e, 0x1e07, 0x1e06, 0x1e1f, 0x1e1e, 0x1e07, 0x1e06, 0x1e0f, 0x1e0e, 0x1e07, 0x1e06,
+    0x03ff, 0x03fe, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x027f, 0x027e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x02ff, 0x02fe, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x027f, 0x027e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x07ff, 0x07fe, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x063f, 0x063e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x067f, 0x067e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x063f, 0x063e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x06ff, 0x06fe, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x063f, 0x063e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x067f, 0x067e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x063f, 0x063e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x03ff, 0x03fe, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x027f, 0x027e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x02ff, 0x02fe, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x027f, 0x027e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x0fff, 0x0ffe, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e1f, 0x0e1e, 0x0e07, 0x0e06,
+    0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e3f, 0x0e3e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06,
+    0x0e1f, 0x0e1e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e7f, 0x0e7e, 0x0e07, 0x0e06,
+    0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e1f, 0x0e1e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06,
+    0x0e3f, 0x0e3e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e1f, 0x0e1e, 0x0e07, 0x0e06,
+    0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0eff, 0x0efe, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06,
+    0x0e1f, 0x0e1e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e3f, 0x0e3e, 0x0e07, 0x0e06,
+    0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e1f, 0x0e1e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06,
+    0x0e7f, 0x0e7e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e1f, 0x0e1e, 0x0e07, 0x0e06,
+    0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x0e3f, 0x0e3e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06,
+    0x0e1f, 0x0e1e, 0x0e07, 0x0e06, 0x0e0f, 0x0e0e, 0x0e07, 0x0e06, 0x03ff, 0x03fe, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x027f, 0x027e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x02ff, 0x02fe, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x027f, 0x027e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x07ff, 0x07fe, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x063f, 0x063e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x067f, 0x067e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x063f, 0x063e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x06ff, 0x06fe, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x063f, 0x063e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x067f, 0x067e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606, 0x063f, 0x063e, 0x0607, 0x0606,
+    0x060f, 0x060e, 0x0607, 0x0606, 0x061f, 0x061e, 0x0607, 0x0606, 0x060f, 0x060e, 0x0607, 0x0606,
+    0x03ff, 0x03fe, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x027f, 0x027e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x02ff, 0x02fe, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x027f, 0x027e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x021f, 0x021e, 0x0207, 0x0206,
+    0x020f, 0x020e, 0x0207, 0x0206, 0x023f, 0x023e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206,
+    0x021f, 0x021e, 0x0207, 0x0206, 0x020f, 0x020e, 0x0207, 0x0206, 0x3fff, 0x3ffe, 0x3e0f, 0x3e0e,
+    0x3e1f, 0x3e1e, 0x3e0f, 0x3e0e, 0x3e3f, 0x3e3e, 0x3e0f, 0x3e0e, 0x3e1f, 0x3e1e, 0x3e0f, 0x3e0e,
+    0x3e7f, 0x3e7e, 0x3e0f, 0x3e0e, 0x3e1f, 0x3e1e, 0x3e0f, 0x3e0e, 0x3e3f, 0x3e3e, 0x3e0f, 0x3e0e,
+    0x3e1f, 0x3e1e, 0x3e0f, 0x3e0e, 0x3eff, 0x3efe, 0x3e0f, 0x3e0e, 0x3e1f, 0x3e1e, 0x3e0f, 0x3e0e,
+    0x3e3f, 0x3e3e, 0x3e0f, 0x3e0e, 0x3e1f, 0x3e1e, 0x3e0f, 0x3e0e, 0x3e7f, 0x3e7e, 0x3e0f, 0x3e0e,
+    0x3e1f, 0x3e1e, 0x3e0f, 0x3e0e, 0x3e3f, 0x3e3e, 0x3e0f, 0x3e0e, 0x3e1f, 0x3e1e, 0x3e0f, 0x3e0e,
+    0x03ff, 0x03fe, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x027f, 0x027e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x02ff, 0x02fe, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x027f, 0x027e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x07ff, 0x07fe, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e,
+    0x063f, 0x063e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e, 0x067f, 0x067e, 0x060f, 0x060e,
+    0x061f, 0x061e, 0x060f, 0x060e, 0x063f, 0x063e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e,
+    0x06ff, 0x06fe, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e, 0x063f, 0x063e, 0x060f, 0x060e,
+    0x061f, 0x061e, 0x060f, 0x060e, 0x067f, 0x067e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e,
+    0x063f, 0x063e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e, 0x03ff, 0x03fe, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x027f, 0x027e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x02ff, 0x02fe, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x027f, 0x027e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x0fff, 0x0ffe, 0x0e0f, 0x0e0e, 0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e, 0x0e3f, 0x0e3e, 0x0e0f, 0x0e0e,
+    0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e, 0x0e7f, 0x0e7e, 0x0e0f, 0x0e0e, 0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e,
+    0x0e3f, 0x0e3e, 0x0e0f, 0x0e0e, 0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e, 0x0eff, 0x0efe, 0x0e0f, 0x0e0e,
+    0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e, 0x0e3f, 0x0e3e, 0x0e0f, 0x0e0e, 0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e,
+    0x0e7f, 0x0e7e, 0x0e0f, 0x0e0e, 0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e, 0x0e3f, 0x0e3e, 0x0e0f, 0x0e0e,
+    0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e, 0x03ff, 0x03fe, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x027f, 0x027e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x02ff, 0x02fe, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x027f, 0x027e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x07ff, 0x07fe, 0x060f, 0x060e,
+    0x061f, 0x061e, 0x060f, 0x060e, 0x063f, 0x063e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e,
+    0x067f, 0x067e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e, 0x063f, 0x063e, 0x060f, 0x060e,
+    0x061f, 0x061e, 0x060f, 0x060e, 0x06ff, 0x06fe, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e,
+    0x063f, 0x063e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e, 0x067f, 0x067e, 0x060f, 0x060e,
+    0x061f, 0x061e, 0x060f, 0x060e, 0x063f, 0x063e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e,
+    0x03ff, 0x03fe, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x027f, 0x027e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x02ff, 0x02fe, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x027f, 0x027e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x1fff, 0x1ffe, 0x1e0f, 0x1e0e, 0x1e1f, 0x1e1e, 0x1e0f, 0x1e0e,
+    0x1e3f, 0x1e3e, 0x1e0f, 0x1e0e, 0x1e1f, 0x1e1e, 0x1e0f, 0x1e0e, 0x1e7f, 0x1e7e, 0x1e0f, 0x1e0e,
+    0x1e1f, 0x1e1e, 0x1e0f, 0x1e0e, 0x1e3f, 0x1e3e, 0x1e0f, 0x1e0e, 0x1e1f, 0x1e1e, 0x1e0f, 0x1e0e,
+    0x1eff, 0x1efe, 0x1e0f, 0x1e0e, 0x1e1f, 0x1e1e, 0x1e0f, 0x1e0e, 0x1e3f, 0x1e3e, 0x1e0f, 0x1e0e,
+    0x1e1f, 0x1e1e, 0x1e0f, 0x1e0e, 0x1e7f, 0x1e7e, 0x1e0f, 0x1e0e, 0x1e1f, 0x1e1e, 0x1e0f, 0x1e0e,
+    0x1e3f, 0x1e3e, 0x1e0f, 0x1e0e, 0x1e1f, 0x1e1e, 0x1e0f, 0x1e0e, 0x03ff, 0x03fe, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x027f, 0x027e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x02ff, 0x02fe, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x027f, 0x027e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x07ff, 0x07fe, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e, 0x063f, 0x063e, 0x060f, 0x060e,
+    0x061f, 0x061e, 0x060f, 0x060e, 0x067f, 0x067e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e,
+    0x063f, 0x063e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e, 0x06ff, 0x06fe, 0x060f, 0x060e,
+    0x061f, 0x061e, 0x060f, 0x060e, 0x063f, 0x063e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e,
+    0x067f, 0x067e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e, 0x063f, 0x063e, 0x060f, 0x060e,
+    0x061f, 0x061e, 0x060f, 0x060e, 0x03ff, 0x03fe, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x027f, 0x027e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x02ff, 0x02fe, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x027f, 0x027e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x0fff, 0x0ffe, 0x0e0f, 0x0e0e,
+    0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e, 0x0e3f, 0x0e3e, 0x0e0f, 0x0e0e, 0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e,
+    0x0e7f, 0x0e7e, 0x0e0f, 0x0e0e, 0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e, 0x0e3f, 0x0e3e, 0x0e0f, 0x0e0e,
+    0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e, 0x0eff, 0x0efe, 0x0e0f, 0x0e0e, 0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e,
+    0x0e3f, 0x0e3e, 0x0e0f, 0x0e0e, 0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e, 0x0e7f, 0x0e7e, 0x0e0f, 0x0e0e,
+    0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e, 0x0e3f, 0x0e3e, 0x0e0f, 0x0e0e, 0x0e1f, 0x0e1e, 0x0e0f, 0x0e0e,
+    0x03ff, 0x03fe, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x027f, 0x027e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x02ff, 0x02fe, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x027f, 0x027e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x07ff, 0x07fe, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e,
+    0x063f, 0x063e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e, 0x067f, 0x067e, 0x060f, 0x060e,
+    0x061f, 0x061e, 0x060f, 0x060e, 0x063f, 0x063e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e,
+    0x06ff, 0x06fe, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e, 0x063f, 0x063e, 0x060f, 0x060e,
+    0x061f, 0x061e, 0x060f, 0x060e, 0x067f, 0x067e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e,
+    0x063f, 0x063e, 0x060f, 0x060e, 0x061f, 0x061e, 0x060f, 0x060e, 0x03ff, 0x03fe, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x027f, 0x027e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x02ff, 0x02fe, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e, 0x027f, 0x027e, 0x020f, 0x020e,
+    0x021f, 0x021e, 0x020f, 0x020e, 0x023f, 0x023e, 0x020f, 0x020e, 0x021f, 0x021e, 0x020f, 0x020e,
+    0x3fff, 0x3ffe, 0x3ffb, 0x3ffa, 0x3e1f, 0x3e1e, 0x3e1b, 0x3e1a, 0x3e3f, 0x3e3e, 0x3e3b, 0x3e3a,
+    0x3e1f, 0x3e1e, 0x3e1b, 0x3e1a, 0x3e7f, 0x3e7e, 0x3e7b, 0x3e7a, 0x3e1f, 0x3e1e, 0x3e1b, 0x3e1a,
+    0x3e3f, 0x3e3e, 0x3e3b, 0x3e3a, 0x3e1f, 0x3e1e, 0x3e1b, 0x3e1a, 0x3eff, 0x3efe, 0x3efb, 0x3efa,
+    0x3e1f, 0x3e1e, 0x3e1b, 0x3e1a, 0x3e3f, 0x3e3e, 0x3e3b, 0x3e3a, 0x3e1f, 0x3e1e, 0x3e1b, 0x3e1a,
+    0x3e7f, 0x3e7e, 0x3e7b, 0x3e7a, 0x3e1f, 0x3e1e, 0x3e1b, 0x3e1a, 0x3e3f, 0x3e3e, 0x3e3b, 0x3e3a,
+    0x3e1f, 0x3e1e, 0x3e1b, 0x3e1a, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x027f, 0x027e, 0x027b, 0x027a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a, 0x07ff, 0x07fe, 0x07fb, 0x07fa,
+    0x061f, 0x061e, 0x061b, 0x061a, 0x063f, 0x063e, 0x063b, 0x063a, 0x061f, 0x061e, 0x061b, 0x061a,
+    0x067f, 0x067e, 0x067b, 0x067a, 0x061f, 0x061e, 0x061b, 0x061a, 0x063f, 0x063e, 0x063b, 0x063a,
+    0x061f, 0x061e, 0x061b, 0x061a, 0x06ff, 0x06fe, 0x06fb, 0x06fa, 0x061f, 0x061e, 0x061b, 0x061a,
+    0x063f, 0x063e, 0x063b, 0x063a, 0x061f, 0x061e, 0x061b, 0x061a, 0x067f, 0x067e, 0x067b, 0x067a,
+    0x061f, 0x061e, 0x061b, 0x061a, 0x063f, 0x063e, 0x063b, 0x063a, 0x061f, 0x061e, 0x061b, 0x061a,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x027f, 0x027e, 0x027b, 0x027a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a, 0x02ff, 0x02fe, 0x02fb, 0x02fa,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x0fff, 0x0ffe, 0x0ffb, 0x0ffa, 0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a,
+    0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a, 0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a, 0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a,
+    0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a, 0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a, 0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a,
+    0x0eff, 0x0efe, 0x0efb, 0x0efa, 0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a, 0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a,
+    0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a, 0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a, 0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a,
+    0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a, 0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x061f, 0x061e, 0x061b, 0x061a, 0x063f, 0x063e, 0x063b, 0x063a,
+    0x061f, 0x061e, 0x061b, 0x061a, 0x067f, 0x067e, 0x067b, 0x067a, 0x061f, 0x061e, 0x061b, 0x061a,
+    0x063f, 0x063e, 0x063b, 0x063a, 0x061f, 0x061e, 0x061b, 0x061a, 0x06ff, 0x06fe, 0x06fb, 0x06fa,
+    0x061f, 0x061e, 0x061b, 0x061a, 0x063f, 0x063e, 0x063b, 0x063a, 0x061f, 0x061e, 0x061b, 0x061a,
+    0x067f, 0x067e, 0x067b, 0x067a, 0x061f, 0x061e, 0x061b, 0x061a, 0x063f, 0x063e, 0x063b, 0x063a,
+    0x061f, 0x061e, 0x061b, 0x061a, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x027f, 0x027e, 0x027b, 0x027a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a, 0x1fff, 0x1ffe, 0x1ffb, 0x1ffa,
+    0x1e1f, 0x1e1e, 0x1e1b, 0x1e1a, 0x1e3f, 0x1e3e, 0x1e3b, 0x1e3a, 0x1e1f, 0x1e1e, 0x1e1b, 0x1e1a,
+    0x1e7f, 0x1e7e, 0x1e7b, 0x1e7a, 0x1e1f, 0x1e1e, 0x1e1b, 0x1e1a, 0x1e3f, 0x1e3e, 0x1e3b, 0x1e3a,
+    0x1e1f, 0x1e1e, 0x1e1b, 0x1e1a, 0x1eff, 0x1efe, 0x1efb, 0x1efa, 0x1e1f, 0x1e1e, 0x1e1b, 0x1e1a,
+    0x1e3f, 0x1e3e, 0x1e3b, 0x1e3a, 0x1e1f, 0x1e1e, 0x1e1b, 0x1e1a, 0x1e7f, 0x1e7e, 0x1e7b, 0x1e7a,
+    0x1e1f, 0x1e1e, 0x1e1b, 0x1e1a, 0x1e3f, 0x1e3e, 0x1e3b, 0x1e3a, 0x1e1f, 0x1e1e, 0x1e1b, 0x1e1a,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x027f, 0x027e, 0x027b, 0x027a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a, 0x02ff, 0x02fe, 0x02fb, 0x02fa,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x061f, 0x061e, 0x061b, 0x061a,
+    0x063f, 0x063e, 0x063b, 0x063a, 0x061f, 0x061e, 0x061b, 0x061a, 0x067f, 0x067e, 0x067b, 0x067a,
+    0x061f, 0x061e, 0x061b, 0x061a, 0x063f, 0x063e, 0x063b, 0x063a, 0x061f, 0x061e, 0x061b, 0x061a,
+    0x06ff, 0x06fe, 0x06fb, 0x06fa, 0x061f, 0x061e, 0x061b, 0x061a, 0x063f, 0x063e, 0x063b, 0x063a,
+    0x061f, 0x061e, 0x061b, 0x061a, 0x067f, 0x067e, 0x067b, 0x067a, 0x061f, 0x061e, 0x061b, 0x061a,
+    0x063f, 0x063e, 0x063b, 0x063a, 0x061f, 0x061e, 0x061b, 0x061a, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x0fff, 0x0ffe, 0x0ffb, 0x0ffa, 0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a, 0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a,
+    0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a, 0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a, 0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a,
+    0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a, 0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a, 0x0eff, 0x0efe, 0x0efb, 0x0efa,
+    0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a, 0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a, 0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a,
+    0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a, 0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a, 0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a,
+    0x0e1f, 0x0e1e, 0x0e1b, 0x0e1a, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x027f, 0x027e, 0x027b, 0x027a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a, 0x07ff, 0x07fe, 0x07fb, 0x07fa,
+    0x061f, 0x061e, 0x061b, 0x061a, 0x063f, 0x063e, 0x063b, 0x063a, 0x061f, 0x061e, 0x061b, 0x061a,
+    0x067f, 0x067e, 0x067b, 0x067a, 0x061f, 0x061e, 0x061b, 0x061a, 0x063f, 0x063e, 0x063b, 0x063a,
+    0x061f, 0x061e, 0x061b, 0x061a, 0x06ff, 0x06fe, 0x06fb, 0x06fa, 0x061f, 0x061e, 0x061b, 0x061a,
+    0x063f, 0x063e, 0x063b, 0x063a, 0x061f, 0x061e, 0x061b, 0x061a, 0x067f, 0x067e, 0x067b, 0x067a,
+    0x061f, 0x061e, 0x061b, 0x061a, 0x063f, 0x063e, 0x063b, 0x063a, 0x061f, 0x061e, 0x061b, 0x061a,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x027f, 0x027e, 0x027b, 0x027a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a, 0x02ff, 0x02fe, 0x02fb, 0x02fa,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a, 0x021f, 0x021e, 0x021b, 0x021a,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x021f, 0x021e, 0x021b, 0x021a, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x021f, 0x021e, 0x021b, 0x021a, 0x3fff, 0x3ffe, 0x3ffb, 0x3ffa, 0x3ff3, 0x3ff2, 0x3ff3, 0x3ff2,
+    0x3e3f, 0x3e3e, 0x3e3b, 0x3e3a, 0x3e33, 0x3e32, 0x3e33, 0x3e32, 0x3e7f, 0x3e7e, 0x3e7b, 0x3e7a,
+    0x3e73, 0x3e72, 0x3e73, 0x3e72, 0x3e3f, 0x3e3e, 0x3e3b, 0x3e3a, 0x3e33, 0x3e32, 0x3e33, 0x3e32,
+    0x3eff, 0x3efe, 0x3efb, 0x3efa, 0x3ef3, 0x3ef2, 0x3ef3, 0x3ef2, 0x3e3f, 0x3e3e, 0x3e3b, 0x3e3a,
+    0x3e33, 0x3e32, 0x3e33, 0x3e32, 0x3e7f, 0x3e7e, 0x3e7b, 0x3e7a, 0x3e73, 0x3e72, 0x3e73, 0x3e72,
+    0x3e3f, 0x3e3e, 0x3e3b, 0x3e3a, 0x3e33, 0x3e32, 0x3e33, 0x3e32, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x0233, 0x0232, 0x0233, 0x0232, 0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x0273, 0x0272, 0x0273, 0x0272, 0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232,
+    0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x063f, 0x063e, 0x063b, 0x063a,
+    0x0633, 0x0632, 0x0633, 0x0632, 0x067f, 0x067e, 0x067b, 0x067a, 0x0673, 0x0672, 0x0673, 0x0672,
+    0x063f, 0x063e, 0x063b, 0x063a, 0x0633, 0x0632, 0x0633, 0x0632, 0x06ff, 0x06fe, 0x06fb, 0x06fa,
+    0x06f3, 0x06f2, 0x06f3, 0x06f2, 0x063f, 0x063e, 0x063b, 0x063a, 0x0633, 0x0632, 0x0633, 0x0632,
+    0x067f, 0x067e, 0x067b, 0x067a, 0x0673, 0x0672, 0x0673, 0x0672, 0x063f, 0x063e, 0x063b, 0x063a,
+    0x0633, 0x0632, 0x0633, 0x0632, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x0273, 0x0272, 0x0273, 0x0272, 0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232,
+    0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x0233, 0x0232, 0x0233, 0x0232, 0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232, 0x0fff, 0x0ffe, 0x0ffb, 0x0ffa,
+    0x0ff3, 0x0ff2, 0x0ff3, 0x0ff2, 0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a, 0x0e33, 0x0e32, 0x0e33, 0x0e32,
+    0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a, 0x0e73, 0x0e72, 0x0e73, 0x0e72, 0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a,
+    0x0e33, 0x0e32, 0x0e33, 0x0e32, 0x0eff, 0x0efe, 0x0efb, 0x0efa, 0x0ef3, 0x0ef2, 0x0ef3, 0x0ef2,
+    0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a, 0x0e33, 0x0e32, 0x0e33, 0x0e32, 0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a,
+    0x0e73, 0x0e72, 0x0e73, 0x0e72, 0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a, 0x0e33, 0x0e32, 0x0e33, 0x0e32,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x0233, 0x0232, 0x0233, 0x0232, 0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232, 0x02ff, 0x02fe, 0x02fb, 0x02fa,
+    0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x0233, 0x0232, 0x0233, 0x0232, 0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2,
+    0x063f, 0x063e, 0x063b, 0x063a, 0x0633, 0x0632, 0x0633, 0x0632, 0x067f, 0x067e, 0x067b, 0x067a,
+    0x0673, 0x0672, 0x0673, 0x0672, 0x063f, 0x063e, 0x063b, 0x063a, 0x0633, 0x0632, 0x0633, 0x0632,
+    0x06ff, 0x06fe, 0x06fb, 0x06fa, 0x06f3, 0x06f2, 0x06f3, 0x06f2, 0x063f, 0x063e, 0x063b, 0x063a,
+    0x0633, 0x0632, 0x0633, 0x0632, 0x067f, 0x067e, 0x067b, 0x067a, 0x0673, 0x0672, 0x0673, 0x0672,
+    0x063f, 0x063e, 0x063b, 0x063a, 0x0633, 0x0632, 0x0633, 0x0632, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x0233, 0x0232, 0x0233, 0x0232, 0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x0273, 0x0272, 0x0273, 0x0272, 0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232,
+    0x1fff, 0x1ffe, 0x1ffb, 0x1ffa, 0x1ff3, 0x1ff2, 0x1ff3, 0x1ff2, 0x1e3f, 0x1e3e, 0x1e3b, 0x1e3a,
+    0x1e33, 0x1e32, 0x1e33, 0x1e32, 0x1e7f, 0x1e7e, 0x1e7b, 0x1e7a, 0x1e73, 0x1e72, 0x1e73, 0x1e72,
+    0x1e3f, 0x1e3e, 0x1e3b, 0x1e3a, 0x1e33, 0x1e32, 0x1e33, 0x1e32, 0x1eff, 0x1efe, 0x1efb, 0x1efa,
+    0x1ef3, 0x1ef2, 0x1ef3, 0x1ef2, 0x1e3f, 0x1e3e, 0x1e3b, 0x1e3a, 0x1e33, 0x1e32, 0x1e33, 0x1e32,
+    0x1e7f, 0x1e7e, 0x1e7b, 0x1e7a, 0x1e73, 0x1e72, 0x1e73, 0x1e72, 0x1e3f, 0x1e3e, 0x1e3b, 0x1e3a,
+    0x1e33, 0x1e32, 0x1e33, 0x1e32, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x0273, 0x0272, 0x0273, 0x0272, 0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232,
+    0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x0233, 0x0232, 0x0233, 0x0232, 0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232, 0x07ff, 0x07fe, 0x07fb, 0x07fa,
+    0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x063f, 0x063e, 0x063b, 0x063a, 0x0633, 0x0632, 0x0633, 0x0632,
+    0x067f, 0x067e, 0x067b, 0x067a, 0x0673, 0x0672, 0x0673, 0x0672, 0x063f, 0x063e, 0x063b, 0x063a,
+    0x0633, 0x0632, 0x0633, 0x0632, 0x06ff, 0x06fe, 0x06fb, 0x06fa, 0x06f3, 0x06f2, 0x06f3, 0x06f2,
+    0x063f, 0x063e, 0x063b, 0x063a, 0x0633, 0x0632, 0x0633, 0x0632, 0x067f, 0x067e, 0x067b, 0x067a,
+    0x0673, 0x0672, 0x0673, 0x0672, 0x063f, 0x063e, 0x063b, 0x063a, 0x0633, 0x0632, 0x0633, 0x0632,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x0233, 0x0232, 0x0233, 0x0232, 0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232, 0x02ff, 0x02fe, 0x02fb, 0x02fa,
+    0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x0233, 0x0232, 0x0233, 0x0232, 0x0fff, 0x0ffe, 0x0ffb, 0x0ffa, 0x0ff3, 0x0ff2, 0x0ff3, 0x0ff2,
+    0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a, 0x0e33, 0x0e32, 0x0e33, 0x0e32, 0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a,
+    0x0e73, 0x0e72, 0x0e73, 0x0e72, 0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a, 0x0e33, 0x0e32, 0x0e33, 0x0e32,
+    0x0eff, 0x0efe, 0x0efb, 0x0efa, 0x0ef3, 0x0ef2, 0x0ef3, 0x0ef2, 0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a,
+    0x0e33, 0x0e32, 0x0e33, 0x0e32, 0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a, 0x0e73, 0x0e72, 0x0e73, 0x0e72,
+    0x0e3f, 0x0e3e, 0x0e3b, 0x0e3a, 0x0e33, 0x0e32, 0x0e33, 0x0e32, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x0233, 0x0232, 0x0233, 0x0232, 0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x0273, 0x0272, 0x0273, 0x0272, 0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232,
+    0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x063f, 0x063e, 0x063b, 0x063a,
+    0x0633, 0x0632, 0x0633, 0x0632, 0x067f, 0x067e, 0x067b, 0x067a, 0x0673, 0x0672, 0x0673, 0x0672,
+    0x063f, 0x063e, 0x063b, 0x063a, 0x0633, 0x0632, 0x0633, 0x0632, 0x06ff, 0x06fe, 0x06fb, 0x06fa,
+    0x06f3, 0x06f2, 0x06f3, 0x06f2, 0x063f, 0x063e, 0x063b, 0x063a, 0x0633, 0x0632, 0x0633, 0x0632,
+    0x067f, 0x067e, 0x067b, 0x067a, 0x0673, 0x0672, 0x0673, 0x0672, 0x063f, 0x063e, 0x063b, 0x063a,
+    0x0633, 0x0632, 0x0633, 0x0632, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x0273, 0x0272, 0x0273, 0x0272, 0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232,
+    0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x023f, 0x023e, 0x023b, 0x023a,
+    0x0233, 0x0232, 0x0233, 0x0232, 0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272,
+    0x023f, 0x023e, 0x023b, 0x023a, 0x0233, 0x0232, 0x0233, 0x0232, 0x3fff, 0x3ffe, 0x3ffb, 0x3ffa,
+    0x3ff3, 0x3ff2, 0x3ff3, 0x3ff2, 0x3fe3, 0x3fe2, 0x3fe3, 0x3fe2, 0x3fe3, 0x3fe2, 0x3fe3, 0x3fe2,
+    0x3e7f, 0x3e7e, 0x3e7b, 0x3e7a, 0x3e73, 0x3e72, 0x3e73, 0x3e72, 0x3e63, 0x3e62, 0x3e63, 0x3e62,
+    0x3e63, 0x3e62, 0x3e63, 0x3e62, 0x3eff, 0x3efe, 0x3efb, 0x3efa, 0x3ef3, 0x3ef2, 0x3ef3, 0x3ef2,
+    0x3ee3, 0x3ee2, 0x3ee3, 0x3ee2, 0x3ee3, 0x3ee2, 0x3ee3, 0x3ee2, 0x3e7f, 0x3e7e, 0x3e7b, 0x3e7a,
+    0x3e73, 0x3e72, 0x3e73, 0x3e72, 0x3e63, 0x3e62, 0x3e63, 0x3e62, 0x3e63, 0x3e62, 0x3e63, 0x3e62,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272,
+    0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x02ff, 0x02fe, 0x02fb, 0x02fa,
+    0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272, 0x0263, 0x0262, 0x0263, 0x0262,
+    0x0263, 0x0262, 0x0263, 0x0262, 0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2,
+    0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x067f, 0x067e, 0x067b, 0x067a,
+    0x0673, 0x0672, 0x0673, 0x0672, 0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662,
+    0x06ff, 0x06fe, 0x06fb, 0x06fa, 0x06f3, 0x06f2, 0x06f3, 0x06f2, 0x06e3, 0x06e2, 0x06e3, 0x06e2,
+    0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x067f, 0x067e, 0x067b, 0x067a, 0x0673, 0x0672, 0x0673, 0x0672,
+    0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272, 0x0263, 0x0262, 0x0263, 0x0262,
+    0x0263, 0x0262, 0x0263, 0x0262, 0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2,
+    0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x0273, 0x0272, 0x0273, 0x0272, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262,
+    0x0fff, 0x0ffe, 0x0ffb, 0x0ffa, 0x0ff3, 0x0ff2, 0x0ff3, 0x0ff2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2,
+    0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a, 0x0e73, 0x0e72, 0x0e73, 0x0e72,
+    0x0e63, 0x0e62, 0x0e63, 0x0e62, 0x0e63, 0x0e62, 0x0e63, 0x0e62, 0x0eff, 0x0efe, 0x0efb, 0x0efa,
+    0x0ef3, 0x0ef2, 0x0ef3, 0x0ef2, 0x0ee3, 0x0ee2, 0x0ee3, 0x0ee2, 0x0ee3, 0x0ee2, 0x0ee3, 0x0ee2,
+    0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a, 0x0e73, 0x0e72, 0x0e73, 0x0e72, 0x0e63, 0x0e62, 0x0e63, 0x0e62,
+    0x0e63, 0x0e62, 0x0e63, 0x0e62, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x0273, 0x0272, 0x0273, 0x0272, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262,
+    0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x02e3, 0x02e2, 0x02e3, 0x02e2,
+    0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272,
+    0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x07ff, 0x07fe, 0x07fb, 0x07fa,
+    0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2,
+    0x067f, 0x067e, 0x067b, 0x067a, 0x0673, 0x0672, 0x0673, 0x0672, 0x0663, 0x0662, 0x0663, 0x0662,
+    0x0663, 0x0662, 0x0663, 0x0662, 0x06ff, 0x06fe, 0x06fb, 0x06fa, 0x06f3, 0x06f2, 0x06f3, 0x06f2,
+    0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x067f, 0x067e, 0x067b, 0x067a,
+    0x0673, 0x0672, 0x0673, 0x0672, 0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272,
+    0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x02ff, 0x02fe, 0x02fb, 0x02fa,
+    0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272, 0x0263, 0x0262, 0x0263, 0x0262,
+    0x0263, 0x0262, 0x0263, 0x0262, 0x1fff, 0x1ffe, 0x1ffb, 0x1ffa, 0x1ff3, 0x1ff2, 0x1ff3, 0x1ff2,
+    0x1fe3, 0x1fe2, 0x1fe3, 0x1fe2, 0x1fe3, 0x1fe2, 0x1fe3, 0x1fe2, 0x1e7f, 0x1e7e, 0x1e7b, 0x1e7a,
+    0x1e73, 0x1e72, 0x1e73, 0x1e72, 0x1e63, 0x1e62, 0x1e63, 0x1e62, 0x1e63, 0x1e62, 0x1e63, 0x1e62,
+    0x1eff, 0x1efe, 0x1efb, 0x1efa, 0x1ef3, 0x1ef2, 0x1ef3, 0x1ef2, 0x1ee3, 0x1ee2, 0x1ee3, 0x1ee2,
+    0x1ee3, 0x1ee2, 0x1ee3, 0x1ee2, 0x1e7f, 0x1e7e, 0x1e7b, 0x1e7a, 0x1e73, 0x1e72, 0x1e73, 0x1e72,
+    0x1e63, 0x1e62, 0x1e63, 0x1e62, 0x1e63, 0x1e62, 0x1e63, 0x1e62, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272, 0x0263, 0x0262, 0x0263, 0x0262,
+    0x0263, 0x0262, 0x0263, 0x0262, 0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2,
+    0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x0273, 0x0272, 0x0273, 0x0272, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262,
+    0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x07e3, 0x07e2, 0x07e3, 0x07e2,
+    0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x067f, 0x067e, 0x067b, 0x067a, 0x0673, 0x0672, 0x0673, 0x0672,
+    0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662, 0x06ff, 0x06fe, 0x06fb, 0x06fa,
+    0x06f3, 0x06f2, 0x06f3, 0x06f2, 0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06e3, 0x06e2,
+    0x067f, 0x067e, 0x067b, 0x067a, 0x0673, 0x0672, 0x0673, 0x0672, 0x0663, 0x0662, 0x0663, 0x0662,
+    0x0663, 0x0662, 0x0663, 0x0662, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x0273, 0x0272, 0x0273, 0x0272, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262,
+    0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x02e3, 0x02e2, 0x02e3, 0x02e2,
+    0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272,
+    0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x0fff, 0x0ffe, 0x0ffb, 0x0ffa,
+    0x0ff3, 0x0ff2, 0x0ff3, 0x0ff2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2,
+    0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a, 0x0e73, 0x0e72, 0x0e73, 0x0e72, 0x0e63, 0x0e62, 0x0e63, 0x0e62,
+    0x0e63, 0x0e62, 0x0e63, 0x0e62, 0x0eff, 0x0efe, 0x0efb, 0x0efa, 0x0ef3, 0x0ef2, 0x0ef3, 0x0ef2,
+    0x0ee3, 0x0ee2, 0x0ee3, 0x0ee2, 0x0ee3, 0x0ee2, 0x0ee3, 0x0ee2, 0x0e7f, 0x0e7e, 0x0e7b, 0x0e7a,
+    0x0e73, 0x0e72, 0x0e73, 0x0e72, 0x0e63, 0x0e62, 0x0e63, 0x0e62, 0x0e63, 0x0e62, 0x0e63, 0x0e62,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272,
+    0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x02ff, 0x02fe, 0x02fb, 0x02fa,
+    0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272, 0x0263, 0x0262, 0x0263, 0x0262,
+    0x0263, 0x0262, 0x0263, 0x0262, 0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2,
+    0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x067f, 0x067e, 0x067b, 0x067a,
+    0x0673, 0x0672, 0x0673, 0x0672, 0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662,
+    0x06ff, 0x06fe, 0x06fb, 0x06fa, 0x06f3, 0x06f2, 0x06f3, 0x06f2, 0x06e3, 0x06e2, 0x06e3, 0x06e2,
+    0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x067f, 0x067e, 0x067b, 0x067a, 0x0673, 0x0672, 0x0673, 0x0672,
+    0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662, 0x0663, 0x0662, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x027f, 0x027e, 0x027b, 0x027a, 0x0273, 0x0272, 0x0273, 0x0272, 0x0263, 0x0262, 0x0263, 0x0262,
+    0x0263, 0x0262, 0x0263, 0x0262, 0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2,
+    0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x027f, 0x027e, 0x027b, 0x027a,
+    0x0273, 0x0272, 0x0273, 0x0272, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262, 0x0263, 0x0262,
+    0x3fff, 0x3ffe, 0x3ffb, 0x3ffa, 0x3ff3, 0x3ff2, 0x3ff3, 0x3ff2, 0x3fe3, 0x3fe2, 0x3fe3, 0x3fe2,
+    0x3fe3, 0x3fe2, 0x3fe3, 0x3fe2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2,
+    0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3eff, 0x3efe, 0x3efb, 0x3efa,
+    0x3ef3, 0x3ef2, 0x3ef3, 0x3ef2, 0x3ee3, 0x3ee2, 0x3ee3, 0x3ee2, 0x3ee3, 0x3ee2, 0x3ee3, 0x3ee2,
+    0x3ec3, 0x3ec2, 0x3ec3, 0x3ec2, 0x3ec3, 0x3ec2, 0x3ec3, 0x3ec2, 0x3ec3, 0x3ec2, 0x3ec3, 0x3ec2,
+    0x3ec3, 0x3ec2, 0x3ec3, 0x3ec2, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x02e3, 0x02e2, 0x02e3, 0x02e2,
+    0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2,
+    0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x07ff, 0x07fe, 0x07fb, 0x07fa,
+    0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x06ff, 0x06fe, 0x06fb, 0x06fa, 0x06f3, 0x06f2, 0x06f3, 0x06f2,
+    0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06c3, 0x06c2, 0x06c3, 0x06c2,
+    0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x02ff, 0x02fe, 0x02fb, 0x02fa,
+    0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2,
+    0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2,
+    0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x0fff, 0x0ffe, 0x0ffb, 0x0ffa, 0x0ff3, 0x0ff2, 0x0ff3, 0x0ff2,
+    0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2,
+    0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2,
+    0x0eff, 0x0efe, 0x0efb, 0x0efa, 0x0ef3, 0x0ef2, 0x0ef3, 0x0ef2, 0x0ee3, 0x0ee2, 0x0ee3, 0x0ee2,
+    0x0ee3, 0x0ee2, 0x0ee3, 0x0ee2, 0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2,
+    0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2,
+    0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02c3, 0x02c2, 0x02c3, 0x02c2,
+    0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2,
+    0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x07e3, 0x07e2, 0x07e3, 0x07e2,
+    0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x06ff, 0x06fe, 0x06fb, 0x06fa,
+    0x06f3, 0x06f2, 0x06f3, 0x06f2, 0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06e3, 0x06e2,
+    0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2,
+    0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x02e3, 0x02e2, 0x02e3, 0x02e2,
+    0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2,
+    0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x1fff, 0x1ffe, 0x1ffb, 0x1ffa,
+    0x1ff3, 0x1ff2, 0x1ff3, 0x1ff2, 0x1fe3, 0x1fe2, 0x1fe3, 0x1fe2, 0x1fe3, 0x1fe2, 0x1fe3, 0x1fe2,
+    0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2,
+    0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1eff, 0x1efe, 0x1efb, 0x1efa, 0x1ef3, 0x1ef2, 0x1ef3, 0x1ef2,
+    0x1ee3, 0x1ee2, 0x1ee3, 0x1ee2, 0x1ee3, 0x1ee2, 0x1ee3, 0x1ee2, 0x1ec3, 0x1ec2, 0x1ec3, 0x1ec2,
+    0x1ec3, 0x1ec2, 0x1ec3, 0x1ec2, 0x1ec3, 0x1ec2, 0x1ec3, 0x1ec2, 0x1ec3, 0x1ec2, 0x1ec3, 0x1ec2,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x02ff, 0x02fe, 0x02fb, 0x02fa,
+    0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2,
+    0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2,
+    0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2,
+    0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x06ff, 0x06fe, 0x06fb, 0x06fa, 0x06f3, 0x06f2, 0x06f3, 0x06f2, 0x06e3, 0x06e2, 0x06e3, 0x06e2,
+    0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2,
+    0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2,
+    0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02c3, 0x02c2, 0x02c3, 0x02c2,
+    0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2,
+    0x0fff, 0x0ffe, 0x0ffb, 0x0ffa, 0x0ff3, 0x0ff2, 0x0ff3, 0x0ff2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2,
+    0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2,
+    0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0eff, 0x0efe, 0x0efb, 0x0efa,
+    0x0ef3, 0x0ef2, 0x0ef3, 0x0ef2, 0x0ee3, 0x0ee2, 0x0ee3, 0x0ee2, 0x0ee3, 0x0ee2, 0x0ee3, 0x0ee2,
+    0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2,
+    0x0ec3, 0x0ec2, 0x0ec3, 0x0ec2, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x02ff, 0x02fe, 0x02fb, 0x02fa, 0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x02e3, 0x02e2, 0x02e3, 0x02e2,
+    0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2,
+    0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x07ff, 0x07fe, 0x07fb, 0x07fa,
+    0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x06ff, 0x06fe, 0x06fb, 0x06fa, 0x06f3, 0x06f2, 0x06f3, 0x06f2,
+    0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06e3, 0x06e2, 0x06c3, 0x06c2, 0x06c3, 0x06c2,
+    0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2, 0x06c3, 0x06c2,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x02ff, 0x02fe, 0x02fb, 0x02fa,
+    0x02f3, 0x02f2, 0x02f3, 0x02f2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2, 0x02e3, 0x02e2,
+    0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x02c3, 0x02c2,
+    0x02c3, 0x02c2, 0x02c3, 0x02c2, 0x3fff, 0x3ffe, 0x3ffb, 0x3ffa, 0x3ff3, 0x3ff2, 0x3ff3, 0x3ff2,
+    0x3fe3, 0x3fe2, 0x3fe3, 0x3fe2, 0x3fe3, 0x3fe2, 0x3fe3, 0x3fe2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2,
+    0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2,
+    0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82,
+    0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82,
+    0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x07e3, 0x07e2, 0x07e3, 0x07e2,
+    0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0fff, 0x0ffe, 0x0ffb, 0x0ffa,
+    0x0ff3, 0x0ff2, 0x0ff3, 0x0ff2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2,
+    0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2,
+    0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82,
+    0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82,
+    0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2,
+    0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x1fff, 0x1ffe, 0x1ffb, 0x1ffa, 0x1ff3, 0x1ff2, 0x1ff3, 0x1ff2, 0x1fe3, 0x1fe2, 0x1fe3, 0x1fe2,
+    0x1fe3, 0x1fe2, 0x1fe3, 0x1fe2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2,
+    0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1f83, 0x1f82, 0x1f83, 0x1f82,
+    0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82,
+    0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82,
+    0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x07ff, 0x07fe, 0x07fb, 0x07fa,
+    0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0fff, 0x0ffe, 0x0ffb, 0x0ffa, 0x0ff3, 0x0ff2, 0x0ff3, 0x0ff2,
+    0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2,
+    0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2,
+    0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82,
+    0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82,
+    0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x07e3, 0x07e2, 0x07e3, 0x07e2,
+    0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x3fff, 0x3ffe, 0x3ffb, 0x3ffa,
+    0x3ff3, 0x3ff2, 0x3ff3, 0x3ff2, 0x3fe3, 0x3fe2, 0x3fe3, 0x3fe2, 0x3fe3, 0x3fe2, 0x3fe3, 0x3fe2,
+    0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2,
+    0x3fc3, 0x3fc2, 0x3fc3, 0x3fc2, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82,
+    0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82,
+    0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82, 0x3f83, 0x3f82,
+    0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02,
+    0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02,
+    0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02,
+    0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02,
+    0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x3f03, 0x3f02,
+    0x3f03, 0x3f02, 0x3f03, 0x3f02, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x07e3, 0x07e2, 0x07e3, 0x07e2,
+    0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0fff, 0x0ffe, 0x0ffb, 0x0ffa, 0x0ff3, 0x0ff2, 0x0ff3, 0x0ff2,
+    0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2,
+    0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2,
+    0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82,
+    0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82,
+    0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f03, 0x0f02, 0x0f03, 0x0f02,
+    0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02,
+    0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02,
+    0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02,
+    0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02,
+    0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x07ff, 0x07fe, 0x07fb, 0x07fa,
+    0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x1fff, 0x1ffe, 0x1ffb, 0x1ffa, 0x1ff3, 0x1ff2, 0x1ff3, 0x1ff2, 0x1fe3, 0x1fe2, 0x1fe3, 0x1fe2,
+    0x1fe3, 0x1fe2, 0x1fe3, 0x1fe2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2,
+    0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1fc3, 0x1fc2, 0x1f83, 0x1f82, 0x1f83, 0x1f82,
+    0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82,
+    0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f83, 0x1f82,
+    0x1f83, 0x1f82, 0x1f83, 0x1f82, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02,
+    0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02,
+    0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02,
+    0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02,
+    0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02,
+    0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x1f03, 0x1f02, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2,
+    0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0fff, 0x0ffe, 0x0ffb, 0x0ffa,
+    0x0ff3, 0x0ff2, 0x0ff3, 0x0ff2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2, 0x0fe3, 0x0fe2,
+    0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2,
+    0x0fc3, 0x0fc2, 0x0fc3, 0x0fc2, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82,
+    0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82,
+    0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82, 0x0f83, 0x0f82,
+    0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02,
+    0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02,
+    0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02,
+    0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02,
+    0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x0f03, 0x0f02,
+    0x0f03, 0x0f02, 0x0f03, 0x0f02, 0x03ff, 0x03fe, 0x03fb, 0x03fa, 0x03f3, 0x03f2, 0x03f3, 0x03f2,
+    0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x07ff, 0x07fe, 0x07fb, 0x07fa, 0x07f3, 0x07f2, 0x07f3, 0x07f2, 0x07e3, 0x07e2, 0x07e3, 0x07e2,
+    0x07e3, 0x07e2, 0x07e3, 0x07e2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2,
+    0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x07c3, 0x07c2, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782, 0x0783, 0x0782,
+    0x0783, 0x0782, 0x0783, 0x0782, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702,
+    0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x0703, 0x0702, 0x03ff, 0x03fe, 0x03fb, 0x03fa,
+    0x03f3, 0x03f2, 0x03f3, 0x03f2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2, 0x03e3, 0x03e2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x03c3, 0x03c2,
+    0x03c3, 0x03c2, 0x03c3, 0x03c2, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382, 0x0383, 0x0382,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302, 0x0303, 0x0302,
+    0x0303, 0x0302, 0x0303, 0x0302, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3cff, 0x3cfe, 0x3cfc, 0x3cfc,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3dff, 0x3dfe, 0x3dfc, 0x3dfc, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3cff, 0x3cfe, 0x3cfc, 0x3cfc, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x047f, 0x047e, 0x047c, 0x047c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x047f, 0x047e, 0x047c, 0x047c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0dff, 0x0dfe, 0x0dfc, 0x0dfc,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x047f, 0x047e, 0x047c, 0x047c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1cff, 0x1cfe, 0x1cfc, 0x1cfc, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1dff, 0x1dfe, 0x1dfc, 0x1dfc, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1cff, 0x1cfe, 0x1cfc, 0x1cfc,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x05ff, 0x05fe, 0x05fc, 0x05fc,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x047f, 0x047e, 0x047c, 0x047c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0dff, 0x0dfe, 0x0dfc, 0x0dfc, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x047f, 0x047e, 0x047c, 0x047c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x047f, 0x047e, 0x047c, 0x047c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x040f, 0x040e, 0x040c, 0x040c, 0x041f, 0x041e, 0x041c, 0x041c, 0x040f, 0x040e, 0x040c, 0x040c,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3cff, 0x3cfe, 0x3cfc, 0x3cfc,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3dff, 0x3dfe, 0x3dfc, 0x3dfc, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3cff, 0x3cfe, 0x3cfc, 0x3cfc, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x047f, 0x047e, 0x047c, 0x047c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0dff, 0x0dfe, 0x0dfc, 0x0dfc,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x047f, 0x047e, 0x047c, 0x047c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x047f, 0x047e, 0x047c, 0x047c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1cff, 0x1cfe, 0x1cfc, 0x1cfc, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1dff, 0x1dfe, 0x1dfc, 0x1dfc, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1cff, 0x1cfe, 0x1cfc, 0x1cfc,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x047f, 0x047e, 0x047c, 0x047c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c, 0x05ff, 0x05fe, 0x05fc, 0x05fc,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0dff, 0x0dfe, 0x0dfc, 0x0dfc, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c1f, 0x0c1e, 0x0c1c, 0x0c1c, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x047f, 0x047e, 0x047c, 0x047c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c, 0x041f, 0x041e, 0x041c, 0x041c,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x041f, 0x041e, 0x041c, 0x041c, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x041f, 0x041e, 0x041c, 0x041c, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff7, 0x3ff6, 0x3ff4, 0x3ff4,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c37, 0x3c36, 0x3c34, 0x3c34, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c,
+    0x3c77, 0x3c76, 0x3c74, 0x3c74, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c37, 0x3c36, 0x3c34, 0x3c34,
+    0x3cff, 0x3cfe, 0x3cfc, 0x3cfc, 0x3cf7, 0x3cf6, 0x3cf4, 0x3cf4, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c37, 0x3c36, 0x3c34, 0x3c34, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c77, 0x3c76, 0x3c74, 0x3c74,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c37, 0x3c36, 0x3c34, 0x3c34, 0x3dff, 0x3dfe, 0x3dfc, 0x3dfc,
+    0x3df7, 0x3df6, 0x3df4, 0x3df4, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c37, 0x3c36, 0x3c34, 0x3c34,
+    0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c77, 0x3c76, 0x3c74, 0x3c74, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c37, 0x3c36, 0x3c34, 0x3c34, 0x3cff, 0x3cfe, 0x3cfc, 0x3cfc, 0x3cf7, 0x3cf6, 0x3cf4, 0x3cf4,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c37, 0x3c36, 0x3c34, 0x3c34, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c,
+    0x3c77, 0x3c76, 0x3c74, 0x3c74, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c37, 0x3c36, 0x3c34, 0x3c34,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x0437, 0x0436, 0x0434, 0x0434, 0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x0437, 0x0436, 0x0434, 0x0434, 0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f7, 0x05f6, 0x05f4, 0x05f4,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x0477, 0x0476, 0x0474, 0x0474, 0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x0437, 0x0436, 0x0434, 0x0434, 0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c37, 0x0c36, 0x0c34, 0x0c34,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c77, 0x0c76, 0x0c74, 0x0c74, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c37, 0x0c36, 0x0c34, 0x0c34, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c37, 0x0c36, 0x0c34, 0x0c34, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c77, 0x0c76, 0x0c74, 0x0c74, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c37, 0x0c36, 0x0c34, 0x0c34,
+    0x0dff, 0x0dfe, 0x0dfc, 0x0dfc, 0x0df7, 0x0df6, 0x0df4, 0x0df4, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c37, 0x0c36, 0x0c34, 0x0c34, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c77, 0x0c76, 0x0c74, 0x0c74,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c37, 0x0c36, 0x0c34, 0x0c34, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc,
+    0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c37, 0x0c36, 0x0c34, 0x0c34,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c77, 0x0c76, 0x0c74, 0x0c74, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c37, 0x0c36, 0x0c34, 0x0c34, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x0477, 0x0476, 0x0474, 0x0474, 0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x0437, 0x0436, 0x0434, 0x0434, 0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434, 0x05ff, 0x05fe, 0x05fc, 0x05fc,
+    0x05f7, 0x05f6, 0x05f4, 0x05f4, 0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x0437, 0x0436, 0x0434, 0x0434, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x0477, 0x0476, 0x0474, 0x0474, 0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff7, 0x1ff6, 0x1ff4, 0x1ff4, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c,
+    0x1c37, 0x1c36, 0x1c34, 0x1c34, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c77, 0x1c76, 0x1c74, 0x1c74,
+    0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c37, 0x1c36, 0x1c34, 0x1c34, 0x1cff, 0x1cfe, 0x1cfc, 0x1cfc,
+    0x1cf7, 0x1cf6, 0x1cf4, 0x1cf4, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c37, 0x1c36, 0x1c34, 0x1c34,
+    0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c77, 0x1c76, 0x1c74, 0x1c74, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c,
+    0x1c37, 0x1c36, 0x1c34, 0x1c34, 0x1dff, 0x1dfe, 0x1dfc, 0x1dfc, 0x1df7, 0x1df6, 0x1df4, 0x1df4,
+    0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c37, 0x1c36, 0x1c34, 0x1c34, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c,
+    0x1c77, 0x1c76, 0x1c74, 0x1c74, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c37, 0x1c36, 0x1c34, 0x1c34,
+    0x1cff, 0x1cfe, 0x1cfc, 0x1cfc, 0x1cf7, 0x1cf6, 0x1cf4, 0x1cf4, 0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c,
+    0x1c37, 0x1c36, 0x1c34, 0x1c34, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c77, 0x1c76, 0x1c74, 0x1c74,
+    0x1c3f, 0x1c3e, 0x1c3c, 0x1c3c, 0x1c37, 0x1c36, 0x1c34, 0x1c34, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x0437, 0x0436, 0x0434, 0x0434, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x0477, 0x0476, 0x0474, 0x0474, 0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434,
+    0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f7, 0x05f6, 0x05f4, 0x05f4, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x0437, 0x0436, 0x0434, 0x0434, 0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x0437, 0x0436, 0x0434, 0x0434, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c37, 0x0c36, 0x0c34, 0x0c34, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c77, 0x0c76, 0x0c74, 0x0c74, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c37, 0x0c36, 0x0c34, 0x0c34,
+    0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c37, 0x0c36, 0x0c34, 0x0c34, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c77, 0x0c76, 0x0c74, 0x0c74,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c37, 0x0c36, 0x0c34, 0x0c34, 0x0dff, 0x0dfe, 0x0dfc, 0x0dfc,
+    0x0df7, 0x0df6, 0x0df4, 0x0df4, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c37, 0x0c36, 0x0c34, 0x0c34,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c77, 0x0c76, 0x0c74, 0x0c74, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c,
+    0x0c37, 0x0c36, 0x0c34, 0x0c34, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4,
+    0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c37, 0x0c36, 0x0c34, 0x0c34, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c77, 0x0c76, 0x0c74, 0x0c74, 0x0c3f, 0x0c3e, 0x0c3c, 0x0c3c, 0x0c37, 0x0c36, 0x0c34, 0x0c34,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x0437, 0x0436, 0x0434, 0x0434, 0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x0437, 0x0436, 0x0434, 0x0434, 0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f7, 0x05f6, 0x05f4, 0x05f4,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x0477, 0x0476, 0x0474, 0x0474, 0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x043f, 0x043e, 0x043c, 0x043c,
+    0x0437, 0x0436, 0x0434, 0x0434, 0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474,
+    0x043f, 0x043e, 0x043c, 0x043c, 0x0437, 0x0436, 0x0434, 0x0434, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff7, 0x3ff6, 0x3ff4, 0x3ff4, 0x3fe7, 0x3fe6, 0x3fe4, 0x3fe4, 0x3fe7, 0x3fe6, 0x3fe4, 0x3fe4,
+    0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c77, 0x3c76, 0x3c74, 0x3c74, 0x3c67, 0x3c66, 0x3c64, 0x3c64,
+    0x3c67, 0x3c66, 0x3c64, 0x3c64, 0x3cff, 0x3cfe, 0x3cfc, 0x3cfc, 0x3cf7, 0x3cf6, 0x3cf4, 0x3cf4,
+    0x3ce7, 0x3ce6, 0x3ce4, 0x3ce4, 0x3ce7, 0x3ce6, 0x3ce4, 0x3ce4, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c,
+    0x3c77, 0x3c76, 0x3c74, 0x3c74, 0x3c67, 0x3c66, 0x3c64, 0x3c64, 0x3c67, 0x3c66, 0x3c64, 0x3c64,
+    0x3dff, 0x3dfe, 0x3dfc, 0x3dfc, 0x3df7, 0x3df6, 0x3df4, 0x3df4, 0x3de7, 0x3de6, 0x3de4, 0x3de4,
+    0x3de7, 0x3de6, 0x3de4, 0x3de4, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c77, 0x3c76, 0x3c74, 0x3c74,
+    0x3c67, 0x3c66, 0x3c64, 0x3c64, 0x3c67, 0x3c66, 0x3c64, 0x3c64, 0x3cff, 0x3cfe, 0x3cfc, 0x3cfc,
+    0x3cf7, 0x3cf6, 0x3cf4, 0x3cf4, 0x3ce7, 0x3ce6, 0x3ce4, 0x3ce4, 0x3ce7, 0x3ce6, 0x3ce4, 0x3ce4,
+    0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c77, 0x3c76, 0x3c74, 0x3c74, 0x3c67, 0x3c66, 0x3c64, 0x3c64,
+    0x3c67, 0x3c66, 0x3c64, 0x3c64, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x0477, 0x0476, 0x0474, 0x0474, 0x0467, 0x0466, 0x0464, 0x0464, 0x0467, 0x0466, 0x0464, 0x0464,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x04e7, 0x04e6, 0x04e4, 0x04e4,
+    0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474,
+    0x0467, 0x0466, 0x0464, 0x0464, 0x0467, 0x0466, 0x0464, 0x0464, 0x05ff, 0x05fe, 0x05fc, 0x05fc,
+    0x05f7, 0x05f6, 0x05f4, 0x05f4, 0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05e7, 0x05e6, 0x05e4, 0x05e4,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474, 0x0467, 0x0466, 0x0464, 0x0464,
+    0x0467, 0x0466, 0x0464, 0x0464, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4,
+    0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x0477, 0x0476, 0x0474, 0x0474, 0x0467, 0x0466, 0x0464, 0x0464, 0x0467, 0x0466, 0x0464, 0x0464,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4,
+    0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c77, 0x0c76, 0x0c74, 0x0c74,
+    0x0c67, 0x0c66, 0x0c64, 0x0c64, 0x0c67, 0x0c66, 0x0c64, 0x0c64, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc,
+    0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4, 0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4, 0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c77, 0x0c76, 0x0c74, 0x0c74, 0x0c67, 0x0c66, 0x0c64, 0x0c64,
+    0x0c67, 0x0c66, 0x0c64, 0x0c64, 0x0dff, 0x0dfe, 0x0dfc, 0x0dfc, 0x0df7, 0x0df6, 0x0df4, 0x0df4,
+    0x0de7, 0x0de6, 0x0de4, 0x0de4, 0x0de7, 0x0de6, 0x0de4, 0x0de4, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c77, 0x0c76, 0x0c74, 0x0c74, 0x0c67, 0x0c66, 0x0c64, 0x0c64, 0x0c67, 0x0c66, 0x0c64, 0x0c64,
+    0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4, 0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4,
+    0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c77, 0x0c76, 0x0c74, 0x0c74,
+    0x0c67, 0x0c66, 0x0c64, 0x0c64, 0x0c67, 0x0c66, 0x0c64, 0x0c64, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474, 0x0467, 0x0466, 0x0464, 0x0464,
+    0x0467, 0x0466, 0x0464, 0x0464, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4,
+    0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x0477, 0x0476, 0x0474, 0x0474, 0x0467, 0x0466, 0x0464, 0x0464, 0x0467, 0x0466, 0x0464, 0x0464,
+    0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f7, 0x05f6, 0x05f4, 0x05f4, 0x05e7, 0x05e6, 0x05e4, 0x05e4,
+    0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474,
+    0x0467, 0x0466, 0x0464, 0x0464, 0x0467, 0x0466, 0x0464, 0x0464, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04e7, 0x04e6, 0x04e4, 0x04e4,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474, 0x0467, 0x0466, 0x0464, 0x0464,
+    0x0467, 0x0466, 0x0464, 0x0464, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff7, 0x1ff6, 0x1ff4, 0x1ff4,
+    0x1fe7, 0x1fe6, 0x1fe4, 0x1fe4, 0x1fe7, 0x1fe6, 0x1fe4, 0x1fe4, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c,
+    0x1c77, 0x1c76, 0x1c74, 0x1c74, 0x1c67, 0x1c66, 0x1c64, 0x1c64, 0x1c67, 0x1c66, 0x1c64, 0x1c64,
+    0x1cff, 0x1cfe, 0x1cfc, 0x1cfc, 0x1cf7, 0x1cf6, 0x1cf4, 0x1cf4, 0x1ce7, 0x1ce6, 0x1ce4, 0x1ce4,
+    0x1ce7, 0x1ce6, 0x1ce4, 0x1ce4, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c77, 0x1c76, 0x1c74, 0x1c74,
+    0x1c67, 0x1c66, 0x1c64, 0x1c64, 0x1c67, 0x1c66, 0x1c64, 0x1c64, 0x1dff, 0x1dfe, 0x1dfc, 0x1dfc,
+    0x1df7, 0x1df6, 0x1df4, 0x1df4, 0x1de7, 0x1de6, 0x1de4, 0x1de4, 0x1de7, 0x1de6, 0x1de4, 0x1de4,
+    0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c77, 0x1c76, 0x1c74, 0x1c74, 0x1c67, 0x1c66, 0x1c64, 0x1c64,
+    0x1c67, 0x1c66, 0x1c64, 0x1c64, 0x1cff, 0x1cfe, 0x1cfc, 0x1cfc, 0x1cf7, 0x1cf6, 0x1cf4, 0x1cf4,
+    0x1ce7, 0x1ce6, 0x1ce4, 0x1ce4, 0x1ce7, 0x1ce6, 0x1ce4, 0x1ce4, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c,
+    0x1c77, 0x1c76, 0x1c74, 0x1c74, 0x1c67, 0x1c66, 0x1c64, 0x1c64, 0x1c67, 0x1c66, 0x1c64, 0x1c64,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474,
+    0x0467, 0x0466, 0x0464, 0x0464, 0x0467, 0x0466, 0x0464, 0x0464, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04e7, 0x04e6, 0x04e4, 0x04e4,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474, 0x0467, 0x0466, 0x0464, 0x0464,
+    0x0467, 0x0466, 0x0464, 0x0464, 0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f7, 0x05f6, 0x05f4, 0x05f4,
+    0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x0477, 0x0476, 0x0474, 0x0474, 0x0467, 0x0466, 0x0464, 0x0464, 0x0467, 0x0466, 0x0464, 0x0464,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x04e7, 0x04e6, 0x04e4, 0x04e4,
+    0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474,
+    0x0467, 0x0466, 0x0464, 0x0464, 0x0467, 0x0466, 0x0464, 0x0464, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c77, 0x0c76, 0x0c74, 0x0c74, 0x0c67, 0x0c66, 0x0c64, 0x0c64,
+    0x0c67, 0x0c66, 0x0c64, 0x0c64, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4,
+    0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4, 0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c77, 0x0c76, 0x0c74, 0x0c74, 0x0c67, 0x0c66, 0x0c64, 0x0c64, 0x0c67, 0x0c66, 0x0c64, 0x0c64,
+    0x0dff, 0x0dfe, 0x0dfc, 0x0dfc, 0x0df7, 0x0df6, 0x0df4, 0x0df4, 0x0de7, 0x0de6, 0x0de4, 0x0de4,
+    0x0de7, 0x0de6, 0x0de4, 0x0de4, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c77, 0x0c76, 0x0c74, 0x0c74,
+    0x0c67, 0x0c66, 0x0c64, 0x0c64, 0x0c67, 0x0c66, 0x0c64, 0x0c64, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc,
+    0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4, 0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4, 0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c77, 0x0c76, 0x0c74, 0x0c74, 0x0c67, 0x0c66, 0x0c64, 0x0c64,
+    0x0c67, 0x0c66, 0x0c64, 0x0c64, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x0477, 0x0476, 0x0474, 0x0474, 0x0467, 0x0466, 0x0464, 0x0464, 0x0467, 0x0466, 0x0464, 0x0464,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x04e7, 0x04e6, 0x04e4, 0x04e4,
+    0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474,
+    0x0467, 0x0466, 0x0464, 0x0464, 0x0467, 0x0466, 0x0464, 0x0464, 0x05ff, 0x05fe, 0x05fc, 0x05fc,
+    0x05f7, 0x05f6, 0x05f4, 0x05f4, 0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05e7, 0x05e6, 0x05e4, 0x05e4,
+    0x047f, 0x047e, 0x047c, 0x047c, 0x0477, 0x0476, 0x0474, 0x0474, 0x0467, 0x0466, 0x0464, 0x0464,
+    0x0467, 0x0466, 0x0464, 0x0464, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4,
+    0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x047f, 0x047e, 0x047c, 0x047c,
+    0x0477, 0x0476, 0x0474, 0x0474, 0x0467, 0x0466, 0x0464, 0x0464, 0x0467, 0x0466, 0x0464, 0x0464,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff7, 0x3ff6, 0x3ff4, 0x3ff4, 0x3fe7, 0x3fe6, 0x3fe4, 0x3fe4,
+    0x3fe7, 0x3fe6, 0x3fe4, 0x3fe4, 0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4, 0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4,
+    0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4, 0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4, 0x3cff, 0x3cfe, 0x3cfc, 0x3cfc,
+    0x3cf7, 0x3cf6, 0x3cf4, 0x3cf4, 0x3ce7, 0x3ce6, 0x3ce4, 0x3ce4, 0x3ce7, 0x3ce6, 0x3ce4, 0x3ce4,
+    0x3cc7, 0x3cc6, 0x3cc4, 0x3cc4, 0x3cc7, 0x3cc6, 0x3cc4, 0x3cc4, 0x3cc7, 0x3cc6, 0x3cc4, 0x3cc4,
+    0x3cc7, 0x3cc6, 0x3cc4, 0x3cc4, 0x3dff, 0x3dfe, 0x3dfc, 0x3dfc, 0x3df7, 0x3df6, 0x3df4, 0x3df4,
+    0x3de7, 0x3de6, 0x3de4, 0x3de4, 0x3de7, 0x3de6, 0x3de4, 0x3de4, 0x3dc7, 0x3dc6, 0x3dc4, 0x3dc4,
+    0x3dc7, 0x3dc6, 0x3dc4, 0x3dc4, 0x3dc7, 0x3dc6, 0x3dc4, 0x3dc4, 0x3dc7, 0x3dc6, 0x3dc4, 0x3dc4,
+    0x3cff, 0x3cfe, 0x3cfc, 0x3cfc, 0x3cf7, 0x3cf6, 0x3cf4, 0x3cf4, 0x3ce7, 0x3ce6, 0x3ce4, 0x3ce4,
+    0x3ce7, 0x3ce6, 0x3ce4, 0x3ce4, 0x3cc7, 0x3cc6, 0x3cc4, 0x3cc4, 0x3cc7, 0x3cc6, 0x3cc4, 0x3cc4,
+    0x3cc7, 0x3cc6, 0x3cc4, 0x3cc4, 0x3cc7, 0x3cc6, 0x3cc4, 0x3cc4, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4,
+    0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04c7, 0x04c6, 0x04c4, 0x04c4,
+    0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4,
+    0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f7, 0x05f6, 0x05f4, 0x05f4, 0x05e7, 0x05e6, 0x05e4, 0x05e4,
+    0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4,
+    0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04e7, 0x04e6, 0x04e4, 0x04e4,
+    0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4,
+    0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4,
+    0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4,
+    0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4,
+    0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4, 0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4,
+    0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4, 0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4, 0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4,
+    0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4, 0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4, 0x0dff, 0x0dfe, 0x0dfc, 0x0dfc,
+    0x0df7, 0x0df6, 0x0df4, 0x0df4, 0x0de7, 0x0de6, 0x0de4, 0x0de4, 0x0de7, 0x0de6, 0x0de4, 0x0de4,
+    0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4, 0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4, 0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4,
+    0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4,
+    0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4, 0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4, 0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4,
+    0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4, 0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4, 0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04e7, 0x04e6, 0x04e4, 0x04e4,
+    0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4,
+    0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f7, 0x05f6, 0x05f4, 0x05f4,
+    0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05c7, 0x05c6, 0x05c4, 0x05c4,
+    0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x04e7, 0x04e6, 0x04e4, 0x04e4,
+    0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4,
+    0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc,
+    0x1ff7, 0x1ff6, 0x1ff4, 0x1ff4, 0x1fe7, 0x1fe6, 0x1fe4, 0x1fe4, 0x1fe7, 0x1fe6, 0x1fe4, 0x1fe4,
+    0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4, 0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4, 0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4,
+    0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4, 0x1cff, 0x1cfe, 0x1cfc, 0x1cfc, 0x1cf7, 0x1cf6, 0x1cf4, 0x1cf4,
+    0x1ce7, 0x1ce6, 0x1ce4, 0x1ce4, 0x1ce7, 0x1ce6, 0x1ce4, 0x1ce4, 0x1cc7, 0x1cc6, 0x1cc4, 0x1cc4,
+    0x1cc7, 0x1cc6, 0x1cc4, 0x1cc4, 0x1cc7, 0x1cc6, 0x1cc4, 0x1cc4, 0x1cc7, 0x1cc6, 0x1cc4, 0x1cc4,
+    0x1dff, 0x1dfe, 0x1dfc, 0x1dfc, 0x1df7, 0x1df6, 0x1df4, 0x1df4, 0x1de7, 0x1de6, 0x1de4, 0x1de4,
+    0x1de7, 0x1de6, 0x1de4, 0x1de4, 0x1dc7, 0x1dc6, 0x1dc4, 0x1dc4, 0x1dc7, 0x1dc6, 0x1dc4, 0x1dc4,
+    0x1dc7, 0x1dc6, 0x1dc4, 0x1dc4, 0x1dc7, 0x1dc6, 0x1dc4, 0x1dc4, 0x1cff, 0x1cfe, 0x1cfc, 0x1cfc,
+    0x1cf7, 0x1cf6, 0x1cf4, 0x1cf4, 0x1ce7, 0x1ce6, 0x1ce4, 0x1ce4, 0x1ce7, 0x1ce6, 0x1ce4, 0x1ce4,
+    0x1cc7, 0x1cc6, 0x1cc4, 0x1cc4, 0x1cc7, 0x1cc6, 0x1cc4, 0x1cc4, 0x1cc7, 0x1cc6, 0x1cc4, 0x1cc4,
+    0x1cc7, 0x1cc6, 0x1cc4, 0x1cc4, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x04e7, 0x04e6, 0x04e4, 0x04e4,
+    0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4,
+    0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x05ff, 0x05fe, 0x05fc, 0x05fc,
+    0x05f7, 0x05f6, 0x05f4, 0x05f4, 0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05e7, 0x05e6, 0x05e4, 0x05e4,
+    0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4,
+    0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4,
+    0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04c7, 0x04c6, 0x04c4, 0x04c4,
+    0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4,
+    0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4,
+    0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0cff, 0x0cfe, 0x0cfc, 0x0cfc,
+    0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4, 0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4, 0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4,
+    0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4, 0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4, 0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4,
+    0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4, 0x0dff, 0x0dfe, 0x0dfc, 0x0dfc, 0x0df7, 0x0df6, 0x0df4, 0x0df4,
+    0x0de7, 0x0de6, 0x0de4, 0x0de4, 0x0de7, 0x0de6, 0x0de4, 0x0de4, 0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4,
+    0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4, 0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4, 0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4,
+    0x0cff, 0x0cfe, 0x0cfc, 0x0cfc, 0x0cf7, 0x0cf6, 0x0cf4, 0x0cf4, 0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4,
+    0x0ce7, 0x0ce6, 0x0ce4, 0x0ce4, 0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4, 0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4,
+    0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4, 0x0cc7, 0x0cc6, 0x0cc4, 0x0cc4, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x04ff, 0x04fe, 0x04fc, 0x04fc, 0x04f7, 0x04f6, 0x04f4, 0x04f4,
+    0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04c7, 0x04c6, 0x04c4, 0x04c4,
+    0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4,
+    0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f7, 0x05f6, 0x05f4, 0x05f4, 0x05e7, 0x05e6, 0x05e4, 0x05e4,
+    0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4,
+    0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x04ff, 0x04fe, 0x04fc, 0x04fc,
+    0x04f7, 0x04f6, 0x04f4, 0x04f4, 0x04e7, 0x04e6, 0x04e4, 0x04e4, 0x04e7, 0x04e6, 0x04e4, 0x04e4,
+    0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x04c7, 0x04c6, 0x04c4, 0x04c4,
+    0x04c7, 0x04c6, 0x04c4, 0x04c4, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff7, 0x3ff6, 0x3ff4, 0x3ff4,
+    0x3fe7, 0x3fe6, 0x3fe4, 0x3fe4, 0x3fe7, 0x3fe6, 0x3fe4, 0x3fe4, 0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4,
+    0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4, 0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4, 0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4,
+    0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84,
+    0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84,
+    0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3dff, 0x3dfe, 0x3dfc, 0x3dfc,
+    0x3df7, 0x3df6, 0x3df4, 0x3df4, 0x3de7, 0x3de6, 0x3de4, 0x3de4, 0x3de7, 0x3de6, 0x3de4, 0x3de4,
+    0x3dc7, 0x3dc6, 0x3dc4, 0x3dc4, 0x3dc7, 0x3dc6, 0x3dc4, 0x3dc4, 0x3dc7, 0x3dc6, 0x3dc4, 0x3dc4,
+    0x3dc7, 0x3dc6, 0x3dc4, 0x3dc4, 0x3d87, 0x3d86, 0x3d84, 0x3d84, 0x3d87, 0x3d86, 0x3d84, 0x3d84,
+    0x3d87, 0x3d86, 0x3d84, 0x3d84, 0x3d87, 0x3d86, 0x3d84, 0x3d84, 0x3d87, 0x3d86, 0x3d84, 0x3d84,
+    0x3d87, 0x3d86, 0x3d84, 0x3d84, 0x3d87, 0x3d86, 0x3d84, 0x3d84, 0x3d87, 0x3d86, 0x3d84, 0x3d84,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f7, 0x05f6, 0x05f4, 0x05f4,
+    0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05c7, 0x05c6, 0x05c4, 0x05c4,
+    0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4,
+    0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584,
+    0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584,
+    0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4,
+    0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4,
+    0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0dff, 0x0dfe, 0x0dfc, 0x0dfc, 0x0df7, 0x0df6, 0x0df4, 0x0df4, 0x0de7, 0x0de6, 0x0de4, 0x0de4,
+    0x0de7, 0x0de6, 0x0de4, 0x0de4, 0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4, 0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4,
+    0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4, 0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4, 0x0d87, 0x0d86, 0x0d84, 0x0d84,
+    0x0d87, 0x0d86, 0x0d84, 0x0d84, 0x0d87, 0x0d86, 0x0d84, 0x0d84, 0x0d87, 0x0d86, 0x0d84, 0x0d84,
+    0x0d87, 0x0d86, 0x0d84, 0x0d84, 0x0d87, 0x0d86, 0x0d84, 0x0d84, 0x0d87, 0x0d86, 0x0d84, 0x0d84,
+    0x0d87, 0x0d86, 0x0d84, 0x0d84, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x05ff, 0x05fe, 0x05fc, 0x05fc,
+    0x05f7, 0x05f6, 0x05f4, 0x05f4, 0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05e7, 0x05e6, 0x05e4, 0x05e4,
+    0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4,
+    0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584,
+    0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584,
+    0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff7, 0x1ff6, 0x1ff4, 0x1ff4, 0x1fe7, 0x1fe6, 0x1fe4, 0x1fe4,
+    0x1fe7, 0x1fe6, 0x1fe4, 0x1fe4, 0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4, 0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4,
+    0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4, 0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4, 0x1f87, 0x1f86, 0x1f84, 0x1f84,
+    0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84,
+    0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84,
+    0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1dff, 0x1dfe, 0x1dfc, 0x1dfc, 0x1df7, 0x1df6, 0x1df4, 0x1df4,
+    0x1de7, 0x1de6, 0x1de4, 0x1de4, 0x1de7, 0x1de6, 0x1de4, 0x1de4, 0x1dc7, 0x1dc6, 0x1dc4, 0x1dc4,
+    0x1dc7, 0x1dc6, 0x1dc4, 0x1dc4, 0x1dc7, 0x1dc6, 0x1dc4, 0x1dc4, 0x1dc7, 0x1dc6, 0x1dc4, 0x1dc4,
+    0x1d87, 0x1d86, 0x1d84, 0x1d84, 0x1d87, 0x1d86, 0x1d84, 0x1d84, 0x1d87, 0x1d86, 0x1d84, 0x1d84,
+    0x1d87, 0x1d86, 0x1d84, 0x1d84, 0x1d87, 0x1d86, 0x1d84, 0x1d84, 0x1d87, 0x1d86, 0x1d84, 0x1d84,
+    0x1d87, 0x1d86, 0x1d84, 0x1d84, 0x1d87, 0x1d86, 0x1d84, 0x1d84, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f7, 0x05f6, 0x05f4, 0x05f4, 0x05e7, 0x05e6, 0x05e4, 0x05e4,
+    0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4,
+    0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x0587, 0x0586, 0x0584, 0x0584,
+    0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584,
+    0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584,
+    0x0587, 0x0586, 0x0584, 0x0584, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4,
+    0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4,
+    0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0dff, 0x0dfe, 0x0dfc, 0x0dfc,
+    0x0df7, 0x0df6, 0x0df4, 0x0df4, 0x0de7, 0x0de6, 0x0de4, 0x0de4, 0x0de7, 0x0de6, 0x0de4, 0x0de4,
+    0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4, 0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4, 0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4,
+    0x0dc7, 0x0dc6, 0x0dc4, 0x0dc4, 0x0d87, 0x0d86, 0x0d84, 0x0d84, 0x0d87, 0x0d86, 0x0d84, 0x0d84,
+    0x0d87, 0x0d86, 0x0d84, 0x0d84, 0x0d87, 0x0d86, 0x0d84, 0x0d84, 0x0d87, 0x0d86, 0x0d84, 0x0d84,
+    0x0d87, 0x0d86, 0x0d84, 0x0d84, 0x0d87, 0x0d86, 0x0d84, 0x0d84, 0x0d87, 0x0d86, 0x0d84, 0x0d84,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x05ff, 0x05fe, 0x05fc, 0x05fc, 0x05f7, 0x05f6, 0x05f4, 0x05f4,
+    0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05e7, 0x05e6, 0x05e4, 0x05e4, 0x05c7, 0x05c6, 0x05c4, 0x05c4,
+    0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4, 0x05c7, 0x05c6, 0x05c4, 0x05c4,
+    0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584,
+    0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584,
+    0x0587, 0x0586, 0x0584, 0x0584, 0x0587, 0x0586, 0x0584, 0x0584, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff7, 0x3ff6, 0x3ff4, 0x3ff4, 0x3fe7, 0x3fe6, 0x3fe4, 0x3fe4, 0x3fe7, 0x3fe6, 0x3fe4, 0x3fe4,
+    0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4, 0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4, 0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4,
+    0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4, 0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84,
+    0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84,
+    0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84,
+    0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04,
+    0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04,
+    0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04,
+    0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04,
+    0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04,
+    0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4,
+    0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4,
+    0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff7, 0x1ff6, 0x1ff4, 0x1ff4,
+    0x1fe7, 0x1fe6, 0x1fe4, 0x1fe4, 0x1fe7, 0x1fe6, 0x1fe4, 0x1fe4, 0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4,
+    0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4, 0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4, 0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4,
+    0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84,
+    0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84,
+    0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4,
+    0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4,
+    0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff7, 0x3ff6, 0x3ff4, 0x3ff4, 0x3fe7, 0x3fe6, 0x3fe4, 0x3fe4,
+    0x3fe7, 0x3fe6, 0x3fe4, 0x3fe4, 0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4, 0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4,
+    0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4, 0x3fc7, 0x3fc6, 0x3fc4, 0x3fc4, 0x3f87, 0x3f86, 0x3f84, 0x3f84,
+    0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84,
+    0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f87, 0x3f86, 0x3f84, 0x3f84,
+    0x3f87, 0x3f86, 0x3f84, 0x3f84, 0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04,
+    0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04,
+    0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04,
+    0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04,
+    0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04,
+    0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3f07, 0x3f06, 0x3f04, 0x3f04, 0x3e07, 0x3e06, 0x3e04, 0x3e04,
+    0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04,
+    0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04,
+    0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04,
+    0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04,
+    0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04,
+    0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04,
+    0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04,
+    0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04,
+    0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04,
+    0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x3e07, 0x3e06, 0x3e04, 0x3e04,
+    0x3e07, 0x3e06, 0x3e04, 0x3e04, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4,
+    0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4,
+    0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff7, 0x1ff6, 0x1ff4, 0x1ff4,
+    0x1fe7, 0x1fe6, 0x1fe4, 0x1fe4, 0x1fe7, 0x1fe6, 0x1fe4, 0x1fe4, 0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4,
+    0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4, 0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4, 0x1fc7, 0x1fc6, 0x1fc4, 0x1fc4,
+    0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84,
+    0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84,
+    0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f87, 0x1f86, 0x1f84, 0x1f84, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04, 0x1f07, 0x1f06, 0x1f04, 0x1f04,
+    0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04,
+    0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04,
+    0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04,
+    0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04,
+    0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04,
+    0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04,
+    0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04,
+    0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04,
+    0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04,
+    0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04,
+    0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x1e07, 0x1e06, 0x1e04, 0x1e04, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f7, 0x07f6, 0x07f4, 0x07f4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff7, 0x0ff6, 0x0ff4, 0x0ff4, 0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4,
+    0x0fe7, 0x0fe6, 0x0fe4, 0x0fe4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4,
+    0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0fc7, 0x0fc6, 0x0fc4, 0x0fc4, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f87, 0x0f86, 0x0f84, 0x0f84,
+    0x0f87, 0x0f86, 0x0f84, 0x0f84, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04,
+    0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0f07, 0x0f06, 0x0f04, 0x0f04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x0e07, 0x0e06, 0x0e04, 0x0e04,
+    0x0e07, 0x0e06, 0x0e04, 0x0e04, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f7, 0x07f6, 0x07f4, 0x07f4,
+    0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07e7, 0x07e6, 0x07e4, 0x07e4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4, 0x07c7, 0x07c6, 0x07c4, 0x07c4,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784,
+    0x0787, 0x0786, 0x0784, 0x0784, 0x0787, 0x0786, 0x0784, 0x0784, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704, 0x0707, 0x0706, 0x0704, 0x0704,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604,
+    0x0607, 0x0606, 0x0604, 0x0604, 0x0607, 0x0606, 0x0604, 0x0604, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x38ff, 0x38fe, 0x38fc, 0x38fc, 0x38f8, 0x38f8, 0x38f8, 0x38f8, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x39ff, 0x39fe, 0x39fc, 0x39fc, 0x39f8, 0x39f8, 0x39f8, 0x39f8,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x38ff, 0x38fe, 0x38fc, 0x38fc,
+    0x38f8, 0x38f8, 0x38f8, 0x38f8, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3bff, 0x3bfe, 0x3bfc, 0x3bfc, 0x3bf8, 0x3bf8, 0x3bf8, 0x3bf8, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x38ff, 0x38fe, 0x38fc, 0x38fc, 0x38f8, 0x38f8, 0x38f8, 0x38f8,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x39ff, 0x39fe, 0x39fc, 0x39fc,
+    0x39f8, 0x39f8, 0x39f8, 0x39f8, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x38ff, 0x38fe, 0x38fc, 0x38fc, 0x38f8, 0x38f8, 0x38f8, 0x38f8, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x08ff, 0x08fe, 0x08fc, 0x08fc,
+    0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x0bff, 0x0bfe, 0x0bfc, 0x0bfc,
+    0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x08ff, 0x08fe, 0x08fc, 0x08fc,
+    0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x187f, 0x187e, 0x187c, 0x187c,
+    0x1878, 0x1878, 0x1878, 0x1878, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x18ff, 0x18fe, 0x18fc, 0x18fc, 0x18f8, 0x18f8, 0x18f8, 0x18f8,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x183f, 0x183e, 0x183c, 0x183c,
+    0x1838, 0x1838, 0x1838, 0x1838, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x19ff, 0x19fe, 0x19fc, 0x19fc,
+    0x19f8, 0x19f8, 0x19f8, 0x19f8, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x183f, 0x183e, 0x183c, 0x183c,
+    0x1838, 0x1838, 0x1838, 0x1838, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x18ff, 0x18fe, 0x18fc, 0x18fc, 0x18f8, 0x18f8, 0x18f8, 0x18f8, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x187f, 0x187e, 0x187c, 0x187c,
+    0x1878, 0x1878, 0x1878, 0x1878, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1bff, 0x1bfe, 0x1bfc, 0x1bfc, 0x1bf8, 0x1bf8, 0x1bf8, 0x1bf8,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x183f, 0x183e, 0x183c, 0x183c,
+    0x1838, 0x1838, 0x1838, 0x1838, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x18ff, 0x18fe, 0x18fc, 0x18fc,
+    0x18f8, 0x18f8, 0x18f8, 0x18f8, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x183f, 0x183e, 0x183c, 0x183c,
+    0x1838, 0x1838, 0x1838, 0x1838, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x19ff, 0x19fe, 0x19fc, 0x19fc, 0x19f8, 0x19f8, 0x19f8, 0x19f8, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x187f, 0x187e, 0x187c, 0x187c,
+    0x1878, 0x1878, 0x1878, 0x1878, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x18ff, 0x18fe, 0x18fc, 0x18fc, 0x18f8, 0x18f8, 0x18f8, 0x18f8,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x183f, 0x183e, 0x183c, 0x183c,
+    0x1838, 0x1838, 0x1838, 0x1838, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x08ff, 0x08fe, 0x08fc, 0x08fc,
+    0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x0bff, 0x0bfe, 0x0bfc, 0x0bfc, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x09ff, 0x09fe, 0x09fc, 0x09fc,
+    0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x081f, 0x081e, 0x081c, 0x081c, 0x0818, 0x0818, 0x0818, 0x0818,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x081f, 0x081e, 0x081c, 0x081c,
+    0x0818, 0x0818, 0x0818, 0x0818, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x38ff, 0x38fe, 0x38fc, 0x38fc, 0x38f8, 0x38f8, 0x38f8, 0x38f8, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x39ff, 0x39fe, 0x39fc, 0x39fc,
+    0x39f8, 0x39f8, 0x39f8, 0x39f8, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x38ff, 0x38fe, 0x38fc, 0x38fc, 0x38f8, 0x38f8, 0x38f8, 0x38f8,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3bff, 0x3bfe, 0x3bfc, 0x3bfc, 0x3bf8, 0x3bf8, 0x3bf8, 0x3bf8, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x38ff, 0x38fe, 0x38fc, 0x38fc,
+    0x38f8, 0x38f8, 0x38f8, 0x38f8, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x39ff, 0x39fe, 0x39fc, 0x39fc, 0x39f8, 0x39f8, 0x39f8, 0x39f8,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x38ff, 0x38fe, 0x38fc, 0x38fc, 0x38f8, 0x38f8, 0x38f8, 0x38f8, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x08ff, 0x08fe, 0x08fc, 0x08fc,
+    0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x0bff, 0x0bfe, 0x0bfc, 0x0bfc, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x09ff, 0x09fe, 0x09fc, 0x09fc,
+    0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x183f, 0x183e, 0x183c, 0x183c,
+    0x1838, 0x1838, 0x1838, 0x1838, 0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878,
+    0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838, 0x18ff, 0x18fe, 0x18fc, 0x18fc,
+    0x18f8, 0x18f8, 0x18f8, 0x18f8, 0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838,
+    0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878, 0x183f, 0x183e, 0x183c, 0x183c,
+    0x1838, 0x1838, 0x1838, 0x1838, 0x19ff, 0x19fe, 0x19fc, 0x19fc, 0x19f8, 0x19f8, 0x19f8, 0x19f8,
+    0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838, 0x187f, 0x187e, 0x187c, 0x187c,
+    0x1878, 0x1878, 0x1878, 0x1878, 0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838,
+    0x18ff, 0x18fe, 0x18fc, 0x18fc, 0x18f8, 0x18f8, 0x18f8, 0x18f8, 0x183f, 0x183e, 0x183c, 0x183c,
+    0x1838, 0x1838, 0x1838, 0x1838, 0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878,
+    0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838, 0x1bff, 0x1bfe, 0x1bfc, 0x1bfc,
+    0x1bf8, 0x1bf8, 0x1bf8, 0x1bf8, 0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838,
+    0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878, 0x183f, 0x183e, 0x183c, 0x183c,
+    0x1838, 0x1838, 0x1838, 0x1838, 0x18ff, 0x18fe, 0x18fc, 0x18fc, 0x18f8, 0x18f8, 0x18f8, 0x18f8,
+    0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838, 0x187f, 0x187e, 0x187c, 0x187c,
+    0x1878, 0x1878, 0x1878, 0x1878, 0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838,
+    0x19ff, 0x19fe, 0x19fc, 0x19fc, 0x19f8, 0x19f8, 0x19f8, 0x19f8, 0x183f, 0x183e, 0x183c, 0x183c,
+    0x1838, 0x1838, 0x1838, 0x1838, 0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878,
+    0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838, 0x18ff, 0x18fe, 0x18fc, 0x18fc,
+    0x18f8, 0x18f8, 0x18f8, 0x18f8, 0x183f, 0x183e, 0x183c, 0x183c, 0x1838, 0x1838, 0x1838, 0x1838,
+    0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878, 0x183f, 0x183e, 0x183c, 0x183c,
+    0x1838, 0x1838, 0x1838, 0x1838, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x09ff, 0x09fe, 0x09fc, 0x09fc,
+    0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x0bff, 0x0bfe, 0x0bfc, 0x0bfc, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x08ff, 0x08fe, 0x08fc, 0x08fc,
+    0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838,
+    0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x083f, 0x083e, 0x083c, 0x083c,
+    0x0838, 0x0838, 0x0838, 0x0838, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x083f, 0x083e, 0x083c, 0x083c, 0x0838, 0x0838, 0x0838, 0x0838, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3fef, 0x3fee, 0x3fec, 0x3fec, 0x3fe8, 0x3fe8, 0x3fe8, 0x3fe8,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x386f, 0x386e, 0x386c, 0x386c,
+    0x3868, 0x3868, 0x3868, 0x3868, 0x38ff, 0x38fe, 0x38fc, 0x38fc, 0x38f8, 0x38f8, 0x38f8, 0x38f8,
+    0x38ef, 0x38ee, 0x38ec, 0x38ec, 0x38e8, 0x38e8, 0x38e8, 0x38e8, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x386f, 0x386e, 0x386c, 0x386c, 0x3868, 0x3868, 0x3868, 0x3868,
+    0x39ff, 0x39fe, 0x39fc, 0x39fc, 0x39f8, 0x39f8, 0x39f8, 0x39f8, 0x39ef, 0x39ee, 0x39ec, 0x39ec,
+    0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x386f, 0x386e, 0x386c, 0x386c, 0x3868, 0x3868, 0x3868, 0x3868, 0x38ff, 0x38fe, 0x38fc, 0x38fc,
+    0x38f8, 0x38f8, 0x38f8, 0x38f8, 0x38ef, 0x38ee, 0x38ec, 0x38ec, 0x38e8, 0x38e8, 0x38e8, 0x38e8,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x386f, 0x386e, 0x386c, 0x386c,
+    0x3868, 0x3868, 0x3868, 0x3868, 0x3bff, 0x3bfe, 0x3bfc, 0x3bfc, 0x3bf8, 0x3bf8, 0x3bf8, 0x3bf8,
+    0x3bef, 0x3bee, 0x3bec, 0x3bec, 0x3be8, 0x3be8, 0x3be8, 0x3be8, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x386f, 0x386e, 0x386c, 0x386c, 0x3868, 0x3868, 0x3868, 0x3868,
+    0x38ff, 0x38fe, 0x38fc, 0x38fc, 0x38f8, 0x38f8, 0x38f8, 0x38f8, 0x38ef, 0x38ee, 0x38ec, 0x38ec,
+    0x38e8, 0x38e8, 0x38e8, 0x38e8, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x386f, 0x386e, 0x386c, 0x386c, 0x3868, 0x3868, 0x3868, 0x3868, 0x39ff, 0x39fe, 0x39fc, 0x39fc,
+    0x39f8, 0x39f8, 0x39f8, 0x39f8, 0x39ef, 0x39ee, 0x39ec, 0x39ec, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x386f, 0x386e, 0x386c, 0x386c,
+    0x3868, 0x3868, 0x3868, 0x3868, 0x38ff, 0x38fe, 0x38fc, 0x38fc, 0x38f8, 0x38f8, 0x38f8, 0x38f8,
+    0x38ef, 0x38ee, 0x38ec, 0x38ec, 0x38e8, 0x38e8, 0x38e8, 0x38e8, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x386f, 0x386e, 0x386c, 0x386c, 0x3868, 0x3868, 0x3868, 0x3868,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0fef, 0x0fee, 0x0fec, 0x0fec,
+    0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x086f, 0x086e, 0x086c, 0x086c, 0x0868, 0x0868, 0x0868, 0x0868, 0x08ff, 0x08fe, 0x08fc, 0x08fc,
+    0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x08ef, 0x08ee, 0x08ec, 0x08ec, 0x08e8, 0x08e8, 0x08e8, 0x08e8,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x086f, 0x086e, 0x086c, 0x086c,
+    0x0868, 0x0868, 0x0868, 0x0868, 0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8,
+    0x09ef, 0x09ee, 0x09ec, 0x09ec, 0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x086f, 0x086e, 0x086c, 0x086c, 0x0868, 0x0868, 0x0868, 0x0868,
+    0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x08ef, 0x08ee, 0x08ec, 0x08ec,
+    0x08e8, 0x08e8, 0x08e8, 0x08e8, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x086f, 0x086e, 0x086c, 0x086c, 0x0868, 0x0868, 0x0868, 0x0868, 0x0bff, 0x0bfe, 0x0bfc, 0x0bfc,
+    0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bef, 0x0bee, 0x0bec, 0x0bec, 0x0be8, 0x0be8, 0x0be8, 0x0be8,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x086f, 0x086e, 0x086c, 0x086c,
+    0x0868, 0x0868, 0x0868, 0x0868, 0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8,
+    0x08ef, 0x08ee, 0x08ec, 0x08ec, 0x08e8, 0x08e8, 0x08e8, 0x08e8, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x086f, 0x086e, 0x086c, 0x086c, 0x0868, 0x0868, 0x0868, 0x0868,
+    0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x09ef, 0x09ee, 0x09ec, 0x09ec,
+    0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x086f, 0x086e, 0x086c, 0x086c, 0x0868, 0x0868, 0x0868, 0x0868, 0x08ff, 0x08fe, 0x08fc, 0x08fc,
+    0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x08ef, 0x08ee, 0x08ec, 0x08ec, 0x08e8, 0x08e8, 0x08e8, 0x08e8,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x086f, 0x086e, 0x086c, 0x086c,
+    0x0868, 0x0868, 0x0868, 0x0868, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8,
+    0x1fef, 0x1fee, 0x1fec, 0x1fec, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fe8, 0x187f, 0x187e, 0x187c, 0x187c,
+    0x1878, 0x1878, 0x1878, 0x1878, 0x186f, 0x186e, 0x186c, 0x186c, 0x1868, 0x1868, 0x1868, 0x1868,
+    0x18ff, 0x18fe, 0x18fc, 0x18fc, 0x18f8, 0x18f8, 0x18f8, 0x18f8, 0x18ef, 0x18ee, 0x18ec, 0x18ec,
+    0x18e8, 0x18e8, 0x18e8, 0x18e8, 0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878,
+    0x186f, 0x186e, 0x186c, 0x186c, 0x1868, 0x1868, 0x1868, 0x1868, 0x19ff, 0x19fe, 0x19fc, 0x19fc,
+    0x19f8, 0x19f8, 0x19f8, 0x19f8, 0x19ef, 0x19ee, 0x19ec, 0x19ec, 0x19e8, 0x19e8, 0x19e8, 0x19e8,
+    0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878, 0x186f, 0x186e, 0x186c, 0x186c,
+    0x1868, 0x1868, 0x1868, 0x1868, 0x18ff, 0x18fe, 0x18fc, 0x18fc, 0x18f8, 0x18f8, 0x18f8, 0x18f8,
+    0x18ef, 0x18ee, 0x18ec, 0x18ec, 0x18e8, 0x18e8, 0x18e8, 0x18e8, 0x187f, 0x187e, 0x187c, 0x187c,
+    0x1878, 0x1878, 0x1878, 0x1878, 0x186f, 0x186e, 0x186c, 0x186c, 0x1868, 0x1868, 0x1868, 0x1868,
+    0x1bff, 0x1bfe, 0x1bfc, 0x1bfc, 0x1bf8, 0x1bf8, 0x1bf8, 0x1bf8, 0x1bef, 0x1bee, 0x1bec, 0x1bec,
+    0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878,
+    0x186f, 0x186e, 0x186c, 0x186c, 0x1868, 0x1868, 0x1868, 0x1868, 0x18ff, 0x18fe, 0x18fc, 0x18fc,
+    0x18f8, 0x18f8, 0x18f8, 0x18f8, 0x18ef, 0x18ee, 0x18ec, 0x18ec, 0x18e8, 0x18e8, 0x18e8, 0x18e8,
+    0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878, 0x186f, 0x186e, 0x186c, 0x186c,
+    0x1868, 0x1868, 0x1868, 0x1868, 0x19ff, 0x19fe, 0x19fc, 0x19fc, 0x19f8, 0x19f8, 0x19f8, 0x19f8,
+    0x19ef, 0x19ee, 0x19ec, 0x19ec, 0x19e8, 0x19e8, 0x19e8, 0x19e8, 0x187f, 0x187e, 0x187c, 0x187c,
+    0x1878, 0x1878, 0x1878, 0x1878, 0x186f, 0x186e, 0x186c, 0x186c, 0x1868, 0x1868, 0x1868, 0x1868,
+    0x18ff, 0x18fe, 0x18fc, 0x18fc, 0x18f8, 0x18f8, 0x18f8, 0x18f8, 0x18ef, 0x18ee, 0x18ec, 0x18ec,
+    0x18e8, 0x18e8, 0x18e8, 0x18e8, 0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878,
+    0x186f, 0x186e, 0x186c, 0x186c, 0x1868, 0x1868, 0x1868, 0x1868, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0fef, 0x0fee, 0x0fec, 0x0fec, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x086f, 0x086e, 0x086c, 0x086c,
+    0x0868, 0x0868, 0x0868, 0x0868, 0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8,
+    0x08ef, 0x08ee, 0x08ec, 0x08ec, 0x08e8, 0x08e8, 0x08e8, 0x08e8, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x086f, 0x086e, 0x086c, 0x086c, 0x0868, 0x0868, 0x0868, 0x0868,
+    0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x09ef, 0x09ee, 0x09ec, 0x09ec,
+    0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x086f, 0x086e, 0x086c, 0x086c, 0x0868, 0x0868, 0x0868, 0x0868, 0x08ff, 0x08fe, 0x08fc, 0x08fc,
+    0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x08ef, 0x08ee, 0x08ec, 0x08ec, 0x08e8, 0x08e8, 0x08e8, 0x08e8,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x086f, 0x086e, 0x086c, 0x086c,
+    0x0868, 0x0868, 0x0868, 0x0868, 0x0bff, 0x0bfe, 0x0bfc, 0x0bfc, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8,
+    0x0bef, 0x0bee, 0x0bec, 0x0bec, 0x0be8, 0x0be8, 0x0be8, 0x0be8, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x086f, 0x086e, 0x086c, 0x086c, 0x0868, 0x0868, 0x0868, 0x0868,
+    0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x08ef, 0x08ee, 0x08ec, 0x08ec,
+    0x08e8, 0x08e8, 0x08e8, 0x08e8, 0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878,
+    0x086f, 0x086e, 0x086c, 0x086c, 0x0868, 0x0868, 0x0868, 0x0868, 0x09ff, 0x09fe, 0x09fc, 0x09fc,
+    0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x09ef, 0x09ee, 0x09ec, 0x09ec, 0x09e8, 0x09e8, 0x09e8, 0x09e8,
+    0x087f, 0x087e, 0x087c, 0x087c, 0x0878, 0x0878, 0x0878, 0x0878, 0x086f, 0x086e, 0x086c, 0x086c,
+    0x0868, 0x0868, 0x0868, 0x0868, 0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8,
+    0x08ef, 0x08ee, 0x08ec, 0x08ec, 0x08e8, 0x08e8, 0x08e8, 0x08e8, 0x087f, 0x087e, 0x087c, 0x087c,
+    0x0878, 0x0878, 0x0878, 0x0878, 0x086f, 0x086e, 0x086c, 0x086c, 0x0868, 0x0868, 0x0868, 0x0868,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3fef, 0x3fee, 0x3fec, 0x3fec,
+    0x3fe8, 0x3fe8, 0x3fe8, 0x3fe8, 0x3fcf, 0x3fce, 0x3fcc, 0x3fcc, 0x3fc8, 0x3fc8, 0x3fc8, 0x3fc8,
+    0x3fcf, 0x3fce, 0x3fcc, 0x3fcc, 0x3fc8, 0x3fc8, 0x3fc8, 0x3fc8, 0x38ff, 0x38fe, 0x38fc, 0x38fc,
+    0x38f8, 0x38f8, 0x38f8, 0x38f8, 0x38ef, 0x38ee, 0x38ec, 0x38ec, 0x38e8, 0x38e8, 0x38e8, 0x38e8,
+    0x38cf, 0x38ce, 0x38cc, 0x38cc, 0x38c8, 0x38c8, 0x38c8, 0x38c8, 0x38cf, 0x38ce, 0x38cc, 0x38cc,
+    0x38c8, 0x38c8, 0x38c8, 0x38c8, 0x39ff, 0x39fe, 0x39fc, 0x39fc, 0x39f8, 0x39f8, 0x39f8, 0x39f8,
+    0x39ef, 0x39ee, 0x39ec, 0x39ec, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39cf, 0x39ce, 0x39cc, 0x39cc,
+    0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39cf, 0x39ce, 0x39cc, 0x39cc, 0x39c8, 0x39c8, 0x39c8, 0x39c8,
+    0x38ff, 0x38fe, 0x38fc, 0x38fc, 0x38f8, 0x38f8, 0x38f8, 0x38f8, 0x38ef, 0x38ee, 0x38ec, 0x38ec,
+    0x38e8, 0x38e8, 0x38e8, 0x38e8, 0x38cf, 0x38ce, 0x38cc, 0x38cc, 0x38c8, 0x38c8, 0x38c8, 0x38c8,
+    0x38cf, 0x38ce, 0x38cc, 0x38cc, 0x38c8, 0x38c8, 0x38c8, 0x38c8, 0x3bff, 0x3bfe, 0x3bfc, 0x3bfc,
+    0x3bf8, 0x3bf8, 0x3bf8, 0x3bf8, 0x3bef, 0x3bee, 0x3bec, 0x3bec, 0x3be8, 0x3be8, 0x3be8, 0x3be8,
+    0x3bcf, 0x3bce, 0x3bcc, 0x3bcc, 0x3bc8, 0x3bc8, 0x3bc8, 0x3bc8, 0x3bcf, 0x3bce, 0x3bcc, 0x3bcc,
+    0x3bc8, 0x3bc8, 0x3bc8, 0x3bc8, 0x38ff, 0x38fe, 0x38fc, 0x38fc, 0x38f8, 0x38f8, 0x38f8, 0x38f8,
+    0x38ef, 0x38ee, 0x38ec, 0x38ec, 0x38e8, 0x38e8, 0x38e8, 0x38e8, 0x38cf, 0x38ce, 0x38cc, 0x38cc,
+    0x38c8, 0x38c8, 0x38c8, 0x38c8, 0x38cf, 0x38ce, 0x38cc, 0x38cc, 0x38c8, 0x38c8, 0x38c8, 0x38c8,
+    0x39ff, 0x39fe, 0x39fc, 0x39fc, 0x39f8, 0x39f8, 0x39f8, 0x39f8, 0x39ef, 0x39ee, 0x39ec, 0x39ec,
+    0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39cf, 0x39ce, 0x39cc, 0x39cc, 0x39c8, 0x39c8, 0x39c8, 0x39c8,
+    0x39cf, 0x39ce, 0x39cc, 0x39cc, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x38ff, 0x38fe, 0x38fc, 0x38fc,
+    0x38f8, 0x38f8, 0x38f8, 0x38f8, 0x38ef, 0x38ee, 0x38ec, 0x38ec, 0x38e8, 0x38e8, 0x38e8, 0x38e8,
+    0x38cf, 0x38ce, 0x38cc, 0x38cc, 0x38c8, 0x38c8, 0x38c8, 0x38c8, 0x38cf, 0x38ce, 0x38cc, 0x38cc,
+    0x38c8, 0x38c8, 0x38c8, 0x38c8, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8,
+    0x0fef, 0x0fee, 0x0fec, 0x0fec, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc,
+    0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8,
+    0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x08ef, 0x08ee, 0x08ec, 0x08ec,
+    0x08e8, 0x08e8, 0x08e8, 0x08e8, 0x08cf, 0x08ce, 0x08cc, 0x08cc, 0x08c8, 0x08c8, 0x08c8, 0x08c8,
+    0x08cf, 0x08ce, 0x08cc, 0x08cc, 0x08c8, 0x08c8, 0x08c8, 0x08c8, 0x09ff, 0x09fe, 0x09fc, 0x09fc,
+    0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x09ef, 0x09ee, 0x09ec, 0x09ec, 0x09e8, 0x09e8, 0x09e8, 0x09e8,
+    0x09cf, 0x09ce, 0x09cc, 0x09cc, 0x09c8, 0x09c8, 0x09c8, 0x09c8, 0x09cf, 0x09ce, 0x09cc, 0x09cc,
+    0x09c8, 0x09c8, 0x09c8, 0x09c8, 0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8,
+    0x08ef, 0x08ee, 0x08ec, 0x08ec, 0x08e8, 0x08e8, 0x08e8, 0x08e8, 0x08cf, 0x08ce, 0x08cc, 0x08cc,
+    0x08c8, 0x08c8, 0x08c8, 0x08c8, 0x08cf, 0x08ce, 0x08cc, 0x08cc, 0x08c8, 0x08c8, 0x08c8, 0x08c8,
+    0x0bff, 0x0bfe, 0x0bfc, 0x0bfc, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bef, 0x0bee, 0x0bec, 0x0bec,
+    0x0be8, 0x0be8, 0x0be8, 0x0be8, 0x0bcf, 0x0bce, 0x0bcc, 0x0bcc, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8,
+    0x0bcf, 0x0bce, 0x0bcc, 0x0bcc, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x08ff, 0x08fe, 0x08fc, 0x08fc,
+    0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x08ef, 0x08ee, 0x08ec, 0x08ec, 0x08e8, 0x08e8, 0x08e8, 0x08e8,
+    0x08cf, 0x08ce, 0x08cc, 0x08cc, 0x08c8, 0x08c8, 0x08c8, 0x08c8, 0x08cf, 0x08ce, 0x08cc, 0x08cc,
+    0x08c8, 0x08c8, 0x08c8, 0x08c8, 0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8,
+    0x09ef, 0x09ee, 0x09ec, 0x09ec, 0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x09cf, 0x09ce, 0x09cc, 0x09cc,
+    0x09c8, 0x09c8, 0x09c8, 0x09c8, 0x09cf, 0x09ce, 0x09cc, 0x09cc, 0x09c8, 0x09c8, 0x09c8, 0x09c8,
+    0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x08ef, 0x08ee, 0x08ec, 0x08ec,
+    0x08e8, 0x08e8, 0x08e8, 0x08e8, 0x08cf, 0x08ce, 0x08cc, 0x08cc, 0x08c8, 0x08c8, 0x08c8, 0x08c8,
+    0x08cf, 0x08ce, 0x08cc, 0x08cc, 0x08c8, 0x08c8, 0x08c8, 0x08c8, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc,
+    0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1fef, 0x1fee, 0x1fec, 0x1fec, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fe8,
+    0x1fcf, 0x1fce, 0x1fcc, 0x1fcc, 0x1fc8, 0x1fc8, 0x1fc8, 0x1fc8, 0x1fcf, 0x1fce, 0x1fcc, 0x1fcc,
+    0x1fc8, 0x1fc8, 0x1fc8, 0x1fc8, 0x18ff, 0x18fe, 0x18fc, 0x18fc, 0x18f8, 0x18f8, 0x18f8, 0x18f8,
+    0x18ef, 0x18ee, 0x18ec, 0x18ec, 0x18e8, 0x18e8, 0x18e8, 0x18e8, 0x18cf, 0x18ce, 0x18cc, 0x18cc,
+    0x18c8, 0x18c8, 0x18c8, 0x18c8, 0x18cf, 0x18ce, 0x18cc, 0x18cc, 0x18c8, 0x18c8, 0x18c8, 0x18c8,
+    0x19ff, 0x19fe, 0x19fc, 0x19fc, 0x19f8, 0x19f8, 0x19f8, 0x19f8, 0x19ef, 0x19ee, 0x19ec, 0x19ec,
+    0x19e8, 0x19e8, 0x19e8, 0x19e8, 0x19cf, 0x19ce, 0x19cc, 0x19cc, 0x19c8, 0x19c8, 0x19c8, 0x19c8,
+    0x19cf, 0x19ce, 0x19cc, 0x19cc, 0x19c8, 0x19c8, 0x19c8, 0x19c8, 0x18ff, 0x18fe, 0x18fc, 0x18fc,
+    0x18f8, 0x18f8, 0x18f8, 0x18f8, 0x18ef, 0x18ee, 0x18ec, 0x18ec, 0x18e8, 0x18e8, 0x18e8, 0x18e8,
+    0x18cf, 0x18ce, 0x18cc, 0x18cc, 0x18c8, 0x18c8, 0x18c8, 0x18c8, 0x18cf, 0x18ce, 0x18cc, 0x18cc,
+    0x18c8, 0x18c8, 0x18c8, 0x18c8, 0x1bff, 0x1bfe, 0x1bfc, 0x1bfc, 0x1bf8, 0x1bf8, 0x1bf8, 0x1bf8,
+    0x1bef, 0x1bee, 0x1bec, 0x1bec, 0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1bcf, 0x1bce, 0x1bcc, 0x1bcc,
+    0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bcf, 0x1bce, 0x1bcc, 0x1bcc, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8,
+    0x18ff, 0x18fe, 0x18fc, 0x18fc, 0x18f8, 0x18f8, 0x18f8, 0x18f8, 0x18ef, 0x18ee, 0x18ec, 0x18ec,
+    0x18e8, 0x18e8, 0x18e8, 0x18e8, 0x18cf, 0x18ce, 0x18cc, 0x18cc, 0x18c8, 0x18c8, 0x18c8, 0x18c8,
+    0x18cf, 0x18ce, 0x18cc, 0x18cc, 0x18c8, 0x18c8, 0x18c8, 0x18c8, 0x19ff, 0x19fe, 0x19fc, 0x19fc,
+    0x19f8, 0x19f8, 0x19f8, 0x19f8, 0x19ef, 0x19ee, 0x19ec, 0x19ec, 0x19e8, 0x19e8, 0x19e8, 0x19e8,
+    0x19cf, 0x19ce, 0x19cc, 0x19cc, 0x19c8, 0x19c8, 0x19c8, 0x19c8, 0x19cf, 0x19ce, 0x19cc, 0x19cc,
+    0x19c8, 0x19c8, 0x19c8, 0x19c8, 0x18ff, 0x18fe, 0x18fc, 0x18fc, 0x18f8, 0x18f8, 0x18f8, 0x18f8,
+    0x18ef, 0x18ee, 0x18ec, 0x18ec, 0x18e8, 0x18e8, 0x18e8, 0x18e8, 0x18cf, 0x18ce, 0x18cc, 0x18cc,
+    0x18c8, 0x18c8, 0x18c8, 0x18c8, 0x18cf, 0x18ce, 0x18cc, 0x18cc, 0x18c8, 0x18c8, 0x18c8, 0x18c8,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0fef, 0x0fee, 0x0fec, 0x0fec,
+    0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8,
+    0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x08ff, 0x08fe, 0x08fc, 0x08fc,
+    0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x08ef, 0x08ee, 0x08ec, 0x08ec, 0x08e8, 0x08e8, 0x08e8, 0x08e8,
+    0x08cf, 0x08ce, 0x08cc, 0x08cc, 0x08c8, 0x08c8, 0x08c8, 0x08c8, 0x08cf, 0x08ce, 0x08cc, 0x08cc,
+    0x08c8, 0x08c8, 0x08c8, 0x08c8, 0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8,
+    0x09ef, 0x09ee, 0x09ec, 0x09ec, 0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x09cf, 0x09ce, 0x09cc, 0x09cc,
+    0x09c8, 0x09c8, 0x09c8, 0x09c8, 0x09cf, 0x09ce, 0x09cc, 0x09cc, 0x09c8, 0x09c8, 0x09c8, 0x09c8,
+    0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x08ef, 0x08ee, 0x08ec, 0x08ec,
+    0x08e8, 0x08e8, 0x08e8, 0x08e8, 0x08cf, 0x08ce, 0x08cc, 0x08cc, 0x08c8, 0x08c8, 0x08c8, 0x08c8,
+    0x08cf, 0x08ce, 0x08cc, 0x08cc, 0x08c8, 0x08c8, 0x08c8, 0x08c8, 0x0bff, 0x0bfe, 0x0bfc, 0x0bfc,
+    0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bef, 0x0bee, 0x0bec, 0x0bec, 0x0be8, 0x0be8, 0x0be8, 0x0be8,
+    0x0bcf, 0x0bce, 0x0bcc, 0x0bcc, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bcf, 0x0bce, 0x0bcc, 0x0bcc,
+    0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x08ff, 0x08fe, 0x08fc, 0x08fc, 0x08f8, 0x08f8, 0x08f8, 0x08f8,
+    0x08ef, 0x08ee, 0x08ec, 0x08ec, 0x08e8, 0x08e8, 0x08e8, 0x08e8, 0x08cf, 0x08ce, 0x08cc, 0x08cc,
+    0x08c8, 0x08c8, 0x08c8, 0x08c8, 0x08cf, 0x08ce, 0x08cc, 0x08cc, 0x08c8, 0x08c8, 0x08c8, 0x08c8,
+    0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x09ef, 0x09ee, 0x09ec, 0x09ec,
+    0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x09cf, 0x09ce, 0x09cc, 0x09cc, 0x09c8, 0x09c8, 0x09c8, 0x09c8,
+    0x09cf, 0x09ce, 0x09cc, 0x09cc, 0x09c8, 0x09c8, 0x09c8, 0x09c8, 0x08ff, 0x08fe, 0x08fc, 0x08fc,
+    0x08f8, 0x08f8, 0x08f8, 0x08f8, 0x08ef, 0x08ee, 0x08ec, 0x08ec, 0x08e8, 0x08e8, 0x08e8, 0x08e8,
+    0x08cf, 0x08ce, 0x08cc, 0x08cc, 0x08c8, 0x08c8, 0x08c8, 0x08c8, 0x08cf, 0x08ce, 0x08cc, 0x08cc,
+    0x08c8, 0x08c8, 0x08c8, 0x08c8, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x3fef, 0x3fee, 0x3fec, 0x3fec, 0x3fe8, 0x3fe8, 0x3fe8, 0x3fe8, 0x3fcf, 0x3fce, 0x3fcc, 0x3fcc,
+    0x3fc8, 0x3fc8, 0x3fc8, 0x3fc8, 0x3fcf, 0x3fce, 0x3fcc, 0x3fcc, 0x3fc8, 0x3fc8, 0x3fc8, 0x3fc8,
+    0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f88, 0x3f88, 0x3f88, 0x3f88, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c,
+    0x3f88, 0x3f88, 0x3f88, 0x3f88, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f88, 0x3f88, 0x3f88, 0x3f88,
+    0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f88, 0x3f88, 0x3f88, 0x3f88, 0x39ff, 0x39fe, 0x39fc, 0x39fc,
+    0x39f8, 0x39f8, 0x39f8, 0x39f8, 0x39ef, 0x39ee, 0x39ec, 0x39ec, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
+    0x39cf, 0x39ce, 0x39cc, 0x39cc, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39cf, 0x39ce, 0x39cc, 0x39cc,
+    0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x398f, 0x398e, 0x398c, 0x398c, 0x3988, 0x3988, 0x3988, 0x3988,
+    0x398f, 0x398e, 0x398c, 0x398c, 0x3988, 0x3988, 0x3988, 0x3988, 0x398f, 0x398e, 0x398c, 0x398c,
+    0x3988, 0x3988, 0x3988, 0x3988, 0x398f, 0x398e, 0x398c, 0x398c, 0x3988, 0x3988, 0x3988, 0x3988,
+    0x3bff, 0x3bfe, 0x3bfc, 0x3bfc, 0x3bf8, 0x3bf8, 0x3bf8, 0x3bf8, 0x3bef, 0x3bee, 0x3bec, 0x3bec,
+    0x3be8, 0x3be8, 0x3be8, 0x3be8, 0x3bcf, 0x3bce, 0x3bcc, 0x3bcc, 0x3bc8, 0x3bc8, 0x3bc8, 0x3bc8,
+    0x3bcf, 0x3bce, 0x3bcc, 0x3bcc, 0x3bc8, 0x3bc8, 0x3bc8, 0x3bc8, 0x3b8f, 0x3b8e, 0x3b8c, 0x3b8c,
+    0x3b88, 0x3b88, 0x3b88, 0x3b88, 0x3b8f, 0x3b8e, 0x3b8c, 0x3b8c, 0x3b88, 0x3b88, 0x3b88, 0x3b88,
+    0x3b8f, 0x3b8e, 0x3b8c, 0x3b8c, 0x3b88, 0x3b88, 0x3b88, 0x3b88, 0x3b8f, 0x3b8e, 0x3b8c, 0x3b8c,
+    0x3b88, 0x3b88, 0x3b88, 0x3b88, 0x39ff, 0x39fe, 0x39fc, 0x39fc, 0x39f8, 0x39f8, 0x39f8, 0x39f8,
+    0x39ef, 0x39ee, 0x39ec, 0x39ec, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39cf, 0x39ce, 0x39cc, 0x39cc,
+    0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39cf, 0x39ce, 0x39cc, 0x39cc, 0x39c8, 0x39c8, 0x39c8, 0x39c8,
+    0x398f, 0x398e, 0x398c, 0x398c, 0x3988, 0x3988, 0x3988, 0x3988, 0x398f, 0x398e, 0x398c, 0x398c,
+    0x3988, 0x3988, 0x3988, 0x3988, 0x398f, 0x398e, 0x398c, 0x398c, 0x3988, 0x3988, 0x3988, 0x3988,
+    0x398f, 0x398e, 0x398c, 0x398c, 0x3988, 0x3988, 0x3988, 0x3988, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0fef, 0x0fee, 0x0fec, 0x0fec, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8,
+    0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc,
+    0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88,
+    0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x09ef, 0x09ee, 0x09ec, 0x09ec,
+    0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x09cf, 0x09ce, 0x09cc, 0x09cc, 0x09c8, 0x09c8, 0x09c8, 0x09c8,
+    0x09cf, 0x09ce, 0x09cc, 0x09cc, 0x09c8, 0x09c8, 0x09c8, 0x09c8, 0x098f, 0x098e, 0x098c, 0x098c,
+    0x0988, 0x0988, 0x0988, 0x0988, 0x098f, 0x098e, 0x098c, 0x098c, 0x0988, 0x0988, 0x0988, 0x0988,
+    0x098f, 0x098e, 0x098c, 0x098c, 0x0988, 0x0988, 0x0988, 0x0988, 0x098f, 0x098e, 0x098c, 0x098c,
+    0x0988, 0x0988, 0x0988, 0x0988, 0x0bff, 0x0bfe, 0x0bfc, 0x0bfc, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8,
+    0x0bef, 0x0bee, 0x0bec, 0x0bec, 0x0be8, 0x0be8, 0x0be8, 0x0be8, 0x0bcf, 0x0bce, 0x0bcc, 0x0bcc,
+    0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bcf, 0x0bce, 0x0bcc, 0x0bcc, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8,
+    0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c, 0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c,
+    0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c, 0x0b88, 0x0b88, 0x0b88, 0x0b88,
+    0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c, 0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x09ff, 0x09fe, 0x09fc, 0x09fc,
+    0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x09ef, 0x09ee, 0x09ec, 0x09ec, 0x09e8, 0x09e8, 0x09e8, 0x09e8,
+    0x09cf, 0x09ce, 0x09cc, 0x09cc, 0x09c8, 0x09c8, 0x09c8, 0x09c8, 0x09cf, 0x09ce, 0x09cc, 0x09cc,
+    0x09c8, 0x09c8, 0x09c8, 0x09c8, 0x098f, 0x098e, 0x098c, 0x098c, 0x0988, 0x0988, 0x0988, 0x0988,
+    0x098f, 0x098e, 0x098c, 0x098c, 0x0988, 0x0988, 0x0988, 0x0988, 0x098f, 0x098e, 0x098c, 0x098c,
+    0x0988, 0x0988, 0x0988, 0x0988, 0x098f, 0x098e, 0x098c, 0x098c, 0x0988, 0x0988, 0x0988, 0x0988,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1fef, 0x1fee, 0x1fec, 0x1fec,
+    0x1fe8, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fcf, 0x1fce, 0x1fcc, 0x1fcc, 0x1fc8, 0x1fc8, 0x1fc8, 0x1fc8,
+    0x1fcf, 0x1fce, 0x1fcc, 0x1fcc, 0x1fc8, 0x1fc8, 0x1fc8, 0x1fc8, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c,
+    0x1f88, 0x1f88, 0x1f88, 0x1f88, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f88, 0x1f88, 0x1f88, 0x1f88,
+    0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f88, 0x1f88, 0x1f88, 0x1f88, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c,
+    0x1f88, 0x1f88, 0x1f88, 0x1f88, 0x19ff, 0x19fe, 0x19fc, 0x19fc, 0x19f8, 0x19f8, 0x19f8, 0x19f8,
+    0x19ef, 0x19ee, 0x19ec, 0x19ec, 0x19e8, 0x19e8, 0x19e8, 0x19e8, 0x19cf, 0x19ce, 0x19cc, 0x19cc,
+    0x19c8, 0x19c8, 0x19c8, 0x19c8, 0x19cf, 0x19ce, 0x19cc, 0x19cc, 0x19c8, 0x19c8, 0x19c8, 0x19c8,
+    0x198f, 0x198e, 0x198c, 0x198c, 0x1988, 0x1988, 0x1988, 0x1988, 0x198f, 0x198e, 0x198c, 0x198c,
+    0x1988, 0x1988, 0x1988, 0x1988, 0x198f, 0x198e, 0x198c, 0x198c, 0x1988, 0x1988, 0x1988, 0x1988,
+    0x198f, 0x198e, 0x198c, 0x198c, 0x1988, 0x1988, 0x1988, 0x1988, 0x1bff, 0x1bfe, 0x1bfc, 0x1bfc,
+    0x1bf8, 0x1bf8, 0x1bf8, 0x1bf8, 0x1bef, 0x1bee, 0x1bec, 0x1bec, 0x1be8, 0x1be8, 0x1be8, 0x1be8,
+    0x1bcf, 0x1bce, 0x1bcc, 0x1bcc, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bcf, 0x1bce, 0x1bcc, 0x1bcc,
+    0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b8f, 0x1b8e, 0x1b8c, 0x1b8c, 0x1b88, 0x1b88, 0x1b88, 0x1b88,
+    0x1b8f, 0x1b8e, 0x1b8c, 0x1b8c, 0x1b88, 0x1b88, 0x1b88, 0x1b88, 0x1b8f, 0x1b8e, 0x1b8c, 0x1b8c,
+    0x1b88, 0x1b88, 0x1b88, 0x1b88, 0x1b8f, 0x1b8e, 0x1b8c, 0x1b8c, 0x1b88, 0x1b88, 0x1b88, 0x1b88,
+    0x19ff, 0x19fe, 0x19fc, 0x19fc, 0x19f8, 0x19f8, 0x19f8, 0x19f8, 0x19ef, 0x19ee, 0x19ec, 0x19ec,
+    0x19e8, 0x19e8, 0x19e8, 0x19e8, 0x19cf, 0x19ce, 0x19cc, 0x19cc, 0x19c8, 0x19c8, 0x19c8, 0x19c8,
+    0x19cf, 0x19ce, 0x19cc, 0x19cc, 0x19c8, 0x19c8, 0x19c8, 0x19c8, 0x198f, 0x198e, 0x198c, 0x198c,
+    0x1988, 0x1988, 0x1988, 0x1988, 0x198f, 0x198e, 0x198c, 0x198c, 0x1988, 0x1988, 0x1988, 0x1988,
+    0x198f, 0x198e, 0x198c, 0x198c, 0x1988, 0x1988, 0x1988, 0x1988, 0x198f, 0x198e, 0x198c, 0x198c,
+    0x1988, 0x1988, 0x1988, 0x1988, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8,
+    0x0fef, 0x0fee, 0x0fec, 0x0fec, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc,
+    0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x09ff, 0x09fe, 0x09fc, 0x09fc,
+    0x09f8, 0x09f8, 0x09f8, 0x09f8, 0x09ef, 0x09ee, 0x09ec, 0x09ec, 0x09e8, 0x09e8, 0x09e8, 0x09e8,
+    0x09cf, 0x09ce, 0x09cc, 0x09cc, 0x09c8, 0x09c8, 0x09c8, 0x09c8, 0x09cf, 0x09ce, 0x09cc, 0x09cc,
+    0x09c8, 0x09c8, 0x09c8, 0x09c8, 0x098f, 0x098e, 0x098c, 0x098c, 0x0988, 0x0988, 0x0988, 0x0988,
+    0x098f, 0x098e, 0x098c, 0x098c, 0x0988, 0x0988, 0x0988, 0x0988, 0x098f, 0x098e, 0x098c, 0x098c,
+    0x0988, 0x0988, 0x0988, 0x0988, 0x098f, 0x098e, 0x098c, 0x098c, 0x0988, 0x0988, 0x0988, 0x0988,
+    0x0bff, 0x0bfe, 0x0bfc, 0x0bfc, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bef, 0x0bee, 0x0bec, 0x0bec,
+    0x0be8, 0x0be8, 0x0be8, 0x0be8, 0x0bcf, 0x0bce, 0x0bcc, 0x0bcc, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8,
+    0x0bcf, 0x0bce, 0x0bcc, 0x0bcc, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c,
+    0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c, 0x0b88, 0x0b88, 0x0b88, 0x0b88,
+    0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c, 0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c,
+    0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x09ff, 0x09fe, 0x09fc, 0x09fc, 0x09f8, 0x09f8, 0x09f8, 0x09f8,
+    0x09ef, 0x09ee, 0x09ec, 0x09ec, 0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x09cf, 0x09ce, 0x09cc, 0x09cc,
+    0x09c8, 0x09c8, 0x09c8, 0x09c8, 0x09cf, 0x09ce, 0x09cc, 0x09cc, 0x09c8, 0x09c8, 0x09c8, 0x09c8,
+    0x098f, 0x098e, 0x098c, 0x098c, 0x0988, 0x0988, 0x0988, 0x0988, 0x098f, 0x098e, 0x098c, 0x098c,
+    0x0988, 0x0988, 0x0988, 0x0988, 0x098f, 0x098e, 0x098c, 0x098c, 0x0988, 0x0988, 0x0988, 0x0988,
+    0x098f, 0x098e, 0x098c, 0x098c, 0x0988, 0x0988, 0x0988, 0x0988, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3fef, 0x3fee, 0x3fec, 0x3fec, 0x3fe8, 0x3fe8, 0x3fe8, 0x3fe8,
+    0x3fcf, 0x3fce, 0x3fcc, 0x3fcc, 0x3fc8, 0x3fc8, 0x3fc8, 0x3fc8, 0x3fcf, 0x3fce, 0x3fcc, 0x3fcc,
+    0x3fc8, 0x3fc8, 0x3fc8, 0x3fc8, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f88, 0x3f88, 0x3f88, 0x3f88,
+    0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f88, 0x3f88, 0x3f88, 0x3f88, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c,
+    0x3f88, 0x3f88, 0x3f88, 0x3f88, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f88, 0x3f88, 0x3f88, 0x3f88,
+    0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c,
+    0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08,
+    0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c,
+    0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08,
+    0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c,
+    0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3bff, 0x3bfe, 0x3bfc, 0x3bfc, 0x3bf8, 0x3bf8, 0x3bf8, 0x3bf8,
+    0x3bef, 0x3bee, 0x3bec, 0x3bec, 0x3be8, 0x3be8, 0x3be8, 0x3be8, 0x3bcf, 0x3bce, 0x3bcc, 0x3bcc,
+    0x3bc8, 0x3bc8, 0x3bc8, 0x3bc8, 0x3bcf, 0x3bce, 0x3bcc, 0x3bcc, 0x3bc8, 0x3bc8, 0x3bc8, 0x3bc8,
+    0x3b8f, 0x3b8e, 0x3b8c, 0x3b8c, 0x3b88, 0x3b88, 0x3b88, 0x3b88, 0x3b8f, 0x3b8e, 0x3b8c, 0x3b8c,
+    0x3b88, 0x3b88, 0x3b88, 0x3b88, 0x3b8f, 0x3b8e, 0x3b8c, 0x3b8c, 0x3b88, 0x3b88, 0x3b88, 0x3b88,
+    0x3b8f, 0x3b8e, 0x3b8c, 0x3b8c, 0x3b88, 0x3b88, 0x3b88, 0x3b88, 0x3b0f, 0x3b0e, 0x3b0c, 0x3b0c,
+    0x3b08, 0x3b08, 0x3b08, 0x3b08, 0x3b0f, 0x3b0e, 0x3b0c, 0x3b0c, 0x3b08, 0x3b08, 0x3b08, 0x3b08,
+    0x3b0f, 0x3b0e, 0x3b0c, 0x3b0c, 0x3b08, 0x3b08, 0x3b08, 0x3b08, 0x3b0f, 0x3b0e, 0x3b0c, 0x3b0c,
+    0x3b08, 0x3b08, 0x3b08, 0x3b08, 0x3b0f, 0x3b0e, 0x3b0c, 0x3b0c, 0x3b08, 0x3b08, 0x3b08, 0x3b08,
+    0x3b0f, 0x3b0e, 0x3b0c, 0x3b0c, 0x3b08, 0x3b08, 0x3b08, 0x3b08, 0x3b0f, 0x3b0e, 0x3b0c, 0x3b0c,
+    0x3b08, 0x3b08, 0x3b08, 0x3b08, 0x3b0f, 0x3b0e, 0x3b0c, 0x3b0c, 0x3b08, 0x3b08, 0x3b08, 0x3b08,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0fef, 0x0fee, 0x0fec, 0x0fec,
+    0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8,
+    0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0bff, 0x0bfe, 0x0bfc, 0x0bfc,
+    0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bef, 0x0bee, 0x0bec, 0x0bec, 0x0be8, 0x0be8, 0x0be8, 0x0be8,
+    0x0bcf, 0x0bce, 0x0bcc, 0x0bcc, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bcf, 0x0bce, 0x0bcc, 0x0bcc,
+    0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c, 0x0b88, 0x0b88, 0x0b88, 0x0b88,
+    0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c, 0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c,
+    0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c, 0x0b88, 0x0b88, 0x0b88, 0x0b88,
+    0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c, 0x0b08, 0x0b08, 0x0b08, 0x0b08, 0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c,
+    0x0b08, 0x0b08, 0x0b08, 0x0b08, 0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c, 0x0b08, 0x0b08, 0x0b08, 0x0b08,
+    0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c, 0x0b08, 0x0b08, 0x0b08, 0x0b08, 0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c,
+    0x0b08, 0x0b08, 0x0b08, 0x0b08, 0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c, 0x0b08, 0x0b08, 0x0b08, 0x0b08,
+    0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c, 0x0b08, 0x0b08, 0x0b08, 0x0b08, 0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c,
+    0x0b08, 0x0b08, 0x0b08, 0x0b08, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8,
+    0x1fef, 0x1fee, 0x1fec, 0x1fec, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fcf, 0x1fce, 0x1fcc, 0x1fcc,
+    0x1fc8, 0x1fc8, 0x1fc8, 0x1fc8, 0x1fcf, 0x1fce, 0x1fcc, 0x1fcc, 0x1fc8, 0x1fc8, 0x1fc8, 0x1fc8,
+    0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f88, 0x1f88, 0x1f88, 0x1f88, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c,
+    0x1f88, 0x1f88, 0x1f88, 0x1f88, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f88, 0x1f88, 0x1f88, 0x1f88,
+    0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f88, 0x1f88, 0x1f88, 0x1f88, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c,
+    0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08,
+    0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c,
+    0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08,
+    0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c,
+    0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08,
+    0x1bff, 0x1bfe, 0x1bfc, 0x1bfc, 0x1bf8, 0x1bf8, 0x1bf8, 0x1bf8, 0x1bef, 0x1bee, 0x1bec, 0x1bec,
+    0x1be8, 0x1be8, 0x1be8, 0x1be8, 0x1bcf, 0x1bce, 0x1bcc, 0x1bcc, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8,
+    0x1bcf, 0x1bce, 0x1bcc, 0x1bcc, 0x1bc8, 0x1bc8, 0x1bc8, 0x1bc8, 0x1b8f, 0x1b8e, 0x1b8c, 0x1b8c,
+    0x1b88, 0x1b88, 0x1b88, 0x1b88, 0x1b8f, 0x1b8e, 0x1b8c, 0x1b8c, 0x1b88, 0x1b88, 0x1b88, 0x1b88,
+    0x1b8f, 0x1b8e, 0x1b8c, 0x1b8c, 0x1b88, 0x1b88, 0x1b88, 0x1b88, 0x1b8f, 0x1b8e, 0x1b8c, 0x1b8c,
+    0x1b88, 0x1b88, 0x1b88, 0x1b88, 0x1b0f, 0x1b0e, 0x1b0c, 0x1b0c, 0x1b08, 0x1b08, 0x1b08, 0x1b08,
+    0x1b0f, 0x1b0e, 0x1b0c, 0x1b0c, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b0f, 0x1b0e, 0x1b0c, 0x1b0c,
+    0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b0f, 0x1b0e, 0x1b0c, 0x1b0c, 0x1b08, 0x1b08, 0x1b08, 0x1b08,
+    0x1b0f, 0x1b0e, 0x1b0c, 0x1b0c, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b0f, 0x1b0e, 0x1b0c, 0x1b0c,
+    0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x1b0f, 0x1b0e, 0x1b0c, 0x1b0c, 0x1b08, 0x1b08, 0x1b08, 0x1b08,
+    0x1b0f, 0x1b0e, 0x1b0c, 0x1b0c, 0x1b08, 0x1b08, 0x1b08, 0x1b08, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0fef, 0x0fee, 0x0fec, 0x0fec, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8,
+    0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc,
+    0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0bff, 0x0bfe, 0x0bfc, 0x0bfc, 0x0bf8, 0x0bf8, 0x0bf8, 0x0bf8,
+    0x0bef, 0x0bee, 0x0bec, 0x0bec, 0x0be8, 0x0be8, 0x0be8, 0x0be8, 0x0bcf, 0x0bce, 0x0bcc, 0x0bcc,
+    0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bcf, 0x0bce, 0x0bcc, 0x0bcc, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8,
+    0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c, 0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c,
+    0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c, 0x0b88, 0x0b88, 0x0b88, 0x0b88,
+    0x0b8f, 0x0b8e, 0x0b8c, 0x0b8c, 0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c,
+    0x0b08, 0x0b08, 0x0b08, 0x0b08, 0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c, 0x0b08, 0x0b08, 0x0b08, 0x0b08,
+    0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c, 0x0b08, 0x0b08, 0x0b08, 0x0b08, 0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c,
+    0x0b08, 0x0b08, 0x0b08, 0x0b08, 0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c, 0x0b08, 0x0b08, 0x0b08, 0x0b08,
+    0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c, 0x0b08, 0x0b08, 0x0b08, 0x0b08, 0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c,
+    0x0b08, 0x0b08, 0x0b08, 0x0b08, 0x0b0f, 0x0b0e, 0x0b0c, 0x0b0c, 0x0b08, 0x0b08, 0x0b08, 0x0b08,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3fef, 0x3fee, 0x3fec, 0x3fec,
+    0x3fe8, 0x3fe8, 0x3fe8, 0x3fe8, 0x3fcf, 0x3fce, 0x3fcc, 0x3fcc, 0x3fc8, 0x3fc8, 0x3fc8, 0x3fc8,
+    0x3fcf, 0x3fce, 0x3fcc, 0x3fcc, 0x3fc8, 0x3fc8, 0x3fc8, 0x3fc8, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c,
+    0x3f88, 0x3f88, 0x3f88, 0x3f88, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f88, 0x3f88, 0x3f88, 0x3f88,
+    0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f88, 0x3f88, 0x3f88, 0x3f88, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c,
+    0x3f88, 0x3f88, 0x3f88, 0x3f88, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08,
+    0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c,
+    0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08,
+    0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c,
+    0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08,
+    0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c,
+    0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08,
+    0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c,
+    0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08,
+    0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c,
+    0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08,
+    0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c,
+    0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08,
+    0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c,
+    0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08,
+    0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c,
+    0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8,
+    0x0fef, 0x0fee, 0x0fec, 0x0fec, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc,
+    0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc,
+    0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1fef, 0x1fee, 0x1fec, 0x1fec, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fe8,
+    0x1fcf, 0x1fce, 0x1fcc, 0x1fcc, 0x1fc8, 0x1fc8, 0x1fc8, 0x1fc8, 0x1fcf, 0x1fce, 0x1fcc, 0x1fcc,
+    0x1fc8, 0x1fc8, 0x1fc8, 0x1fc8, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f88, 0x1f88, 0x1f88, 0x1f88,
+    0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f88, 0x1f88, 0x1f88, 0x1f88, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c,
+    0x1f88, 0x1f88, 0x1f88, 0x1f88, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f88, 0x1f88, 0x1f88, 0x1f88,
+    0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c,
+    0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08,
+    0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c,
+    0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08,
+    0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c,
+    0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c,
+    0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c,
+    0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c,
+    0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c,
+    0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c,
+    0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0fef, 0x0fee, 0x0fec, 0x0fec,
+    0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8,
+    0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x3fef, 0x3fee, 0x3fec, 0x3fec, 0x3fe8, 0x3fe8, 0x3fe8, 0x3fe8, 0x3fcf, 0x3fce, 0x3fcc, 0x3fcc,
+    0x3fc8, 0x3fc8, 0x3fc8, 0x3fc8, 0x3fcf, 0x3fce, 0x3fcc, 0x3fcc, 0x3fc8, 0x3fc8, 0x3fc8, 0x3fc8,
+    0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f88, 0x3f88, 0x3f88, 0x3f88, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c,
+    0x3f88, 0x3f88, 0x3f88, 0x3f88, 0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f88, 0x3f88, 0x3f88, 0x3f88,
+    0x3f8f, 0x3f8e, 0x3f8c, 0x3f8c, 0x3f88, 0x3f88, 0x3f88, 0x3f88, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c,
+    0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08,
+    0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c,
+    0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08,
+    0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c,
+    0x3f08, 0x3f08, 0x3f08, 0x3f08, 0x3f0f, 0x3f0e, 0x3f0c, 0x3f0c, 0x3f08, 0x3f08, 0x3f08, 0x3f08,
+    0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c,
+    0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08,
+    0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c,
+    0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08,
+    0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c,
+    0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08,
+    0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c,
+    0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08,
+    0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c,
+    0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08,
+    0x3e0f, 0x3e0e, 0x3e0c, 0x3e0c, 0x3e08, 0x3e08, 0x3e08, 0x3e08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08,
+    0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c,
+    0x3c08, 0x3c08, 0x3c08, 0x3c08, 0x3c0f, 0x3c0e, 0x3c0c, 0x3c0c, 0x3c08, 0x3c08, 0x3c08, 0x3c08,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0fef, 0x0fee, 0x0fec, 0x0fec,
+    0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8,
+    0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc,
+    0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1fef, 0x1fee, 0x1fec, 0x1fec, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fe8,
+    0x1fcf, 0x1fce, 0x1fcc, 0x1fcc, 0x1fc8, 0x1fc8, 0x1fc8, 0x1fc8, 0x1fcf, 0x1fce, 0x1fcc, 0x1fcc,
+    0x1fc8, 0x1fc8, 0x1fc8, 0x1fc8, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f88, 0x1f88, 0x1f88, 0x1f88,
+    0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f88, 0x1f88, 0x1f88, 0x1f88, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c,
+    0x1f88, 0x1f88, 0x1f88, 0x1f88, 0x1f8f, 0x1f8e, 0x1f8c, 0x1f8c, 0x1f88, 0x1f88, 0x1f88, 0x1f88,
+    0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c,
+    0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08,
+    0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c,
+    0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08,
+    0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c, 0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1f0f, 0x1f0e, 0x1f0c, 0x1f0c,
+    0x1f08, 0x1f08, 0x1f08, 0x1f08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c,
+    0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c,
+    0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c,
+    0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c,
+    0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c,
+    0x1e08, 0x1e08, 0x1e08, 0x1e08, 0x1e0f, 0x1e0e, 0x1e0c, 0x1e0c, 0x1e08, 0x1e08, 0x1e08, 0x1e08,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08,
+    0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c0f, 0x1c0e, 0x1c0c, 0x1c0c,
+    0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8,
+    0x0fef, 0x0fee, 0x0fec, 0x0fec, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fe8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc,
+    0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fcf, 0x0fce, 0x0fcc, 0x0fcc, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fc8,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c,
+    0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88,
+    0x0f8f, 0x0f8e, 0x0f8c, 0x0f8c, 0x0f88, 0x0f88, 0x0f88, 0x0f88, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c,
+    0x0f08, 0x0f08, 0x0f08, 0x0f08, 0x0f0f, 0x0f0e, 0x0f0c, 0x0f0c, 0x0f08, 0x0f08, 0x0f08, 0x0f08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c,
+    0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08,
+    0x0e0f, 0x0e0e, 0x0e0c, 0x0e0c, 0x0e08, 0x0e08, 0x0e08, 0x0e08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c,
+    0x0c08, 0x0c08, 0x0c08, 0x0c08, 0x0c0f, 0x0c0e, 0x0c0c, 0x0c0c, 0x0c08, 0x0c08, 0x0c08, 0x0c08,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x31ff, 0x31fe, 0x31fc, 0x31fc,
+    0x31f8, 0x31f8, 0x31f8, 0x31f8, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x33ff, 0x33fe, 0x33fc, 0x33fc, 0x33f8, 0x33f8, 0x33f8, 0x33f8,
+    0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x30ff, 0x30fe, 0x30fc, 0x30fc,
+    0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x31ff, 0x31fe, 0x31fc, 0x31fc, 0x31f8, 0x31f8, 0x31f8, 0x31f8, 0x31f0, 0x31f0, 0x31f0, 0x31f0,
+    0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x37ff, 0x37fe, 0x37fc, 0x37fc,
+    0x37f8, 0x37f8, 0x37f8, 0x37f8, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x31ff, 0x31fe, 0x31fc, 0x31fc, 0x31f8, 0x31f8, 0x31f8, 0x31f8,
+    0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x30ff, 0x30fe, 0x30fc, 0x30fc,
+    0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x33ff, 0x33fe, 0x33fc, 0x33fc, 0x33f8, 0x33f8, 0x33f8, 0x33f8, 0x33f0, 0x33f0, 0x33f0, 0x33f0,
+    0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x31ff, 0x31fe, 0x31fc, 0x31fc,
+    0x31f8, 0x31f8, 0x31f8, 0x31f8, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x103f, 0x103e, 0x103c, 0x103c,
+    0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x10ff, 0x10fe, 0x10fc, 0x10fc,
+    0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x103f, 0x103e, 0x103c, 0x103c,
+    0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x11ff, 0x11fe, 0x11fc, 0x11fc, 0x11f8, 0x11f8, 0x11f8, 0x11f8, 0x11f0, 0x11f0, 0x11f0, 0x11f0,
+    0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x107f, 0x107e, 0x107c, 0x107c,
+    0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x103f, 0x103e, 0x103c, 0x103c,
+    0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x13ff, 0x13fe, 0x13fc, 0x13fc,
+    0x13f8, 0x13f8, 0x13f8, 0x13f8, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0,
+    0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x103f, 0x103e, 0x103c, 0x103c,
+    0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x107f, 0x107e, 0x107c, 0x107c,
+    0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x11ff, 0x11fe, 0x11fc, 0x11fc, 0x11f8, 0x11f8, 0x11f8, 0x11f8,
+    0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x103f, 0x103e, 0x103c, 0x103c,
+    0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x10ff, 0x10fe, 0x10fc, 0x10fc,
+    0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x103f, 0x103e, 0x103c, 0x103c,
+    0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x17ff, 0x17fe, 0x17fc, 0x17fc, 0x17f8, 0x17f8, 0x17f8, 0x17f8, 0x17f0, 0x17f0, 0x17f0, 0x17f0,
+    0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x107f, 0x107e, 0x107c, 0x107c,
+    0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x103f, 0x103e, 0x103c, 0x103c,
+    0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x11ff, 0x11fe, 0x11fc, 0x11fc,
+    0x11f8, 0x11f8, 0x11f8, 0x11f8, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0,
+    0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x103f, 0x103e, 0x103c, 0x103c,
+    0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x107f, 0x107e, 0x107c, 0x107c,
+    0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x13ff, 0x13fe, 0x13fc, 0x13fc, 0x13f8, 0x13f8, 0x13f8, 0x13f8,
+    0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x103f, 0x103e, 0x103c, 0x103c,
+    0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x10ff, 0x10fe, 0x10fc, 0x10fc,
+    0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x103f, 0x103e, 0x103c, 0x103c,
+    0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x11ff, 0x11fe, 0x11fc, 0x11fc, 0x11f8, 0x11f8, 0x11f8, 0x11f8, 0x11f0, 0x11f0, 0x11f0, 0x11f0,
+    0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x107f, 0x107e, 0x107c, 0x107c,
+    0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x103f, 0x103e, 0x103c, 0x103c,
+    0x1038, 0x1038, 0x1038, 0x1038, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x103f, 0x103e, 0x103c, 0x103c, 0x1038, 0x1038, 0x1038, 0x1038,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x31ff, 0x31fe, 0x31fc, 0x31fc, 0x31f8, 0x31f8, 0x31f8, 0x31f8, 0x31f0, 0x31f0, 0x31f0, 0x31f0,
+    0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x30ff, 0x30fe, 0x30fc, 0x30fc,
+    0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x33ff, 0x33fe, 0x33fc, 0x33fc, 0x33f8, 0x33f8, 0x33f8, 0x33f8,
+    0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x31ff, 0x31fe, 0x31fc, 0x31fc,
+    0x31f8, 0x31f8, 0x31f8, 0x31f8, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x37ff, 0x37fe, 0x37fc, 0x37fc, 0x37f8, 0x37f8, 0x37f8, 0x37f8, 0x37f0, 0x37f0, 0x37f0, 0x37f0,
+    0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x30ff, 0x30fe, 0x30fc, 0x30fc,
+    0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x31ff, 0x31fe, 0x31fc, 0x31fc, 0x31f8, 0x31f8, 0x31f8, 0x31f8,
+    0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x33ff, 0x33fe, 0x33fc, 0x33fc,
+    0x33f8, 0x33f8, 0x33f8, 0x33f8, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x31ff, 0x31fe, 0x31fc, 0x31fc, 0x31f8, 0x31f8, 0x31f8, 0x31f8, 0x31f0, 0x31f0, 0x31f0, 0x31f0,
+    0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x30ff, 0x30fe, 0x30fc, 0x30fc,
+    0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x107f, 0x107e, 0x107c, 0x107c,
+    0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x11ff, 0x11fe, 0x11fc, 0x11fc,
+    0x11f8, 0x11f8, 0x11f8, 0x11f8, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0,
+    0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x107f, 0x107e, 0x107c, 0x107c,
+    0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x13ff, 0x13fe, 0x13fc, 0x13fc, 0x13f8, 0x13f8, 0x13f8, 0x13f8, 0x13f0, 0x13f0, 0x13f0, 0x13f0,
+    0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x10ff, 0x10fe, 0x10fc, 0x10fc,
+    0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x11ff, 0x11fe, 0x11fc, 0x11fc, 0x11f8, 0x11f8, 0x11f8, 0x11f8,
+    0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x107f, 0x107e, 0x107c, 0x107c,
+    0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x17ff, 0x17fe, 0x17fc, 0x17fc,
+    0x17f8, 0x17f8, 0x17f8, 0x17f8, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0,
+    0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x107f, 0x107e, 0x107c, 0x107c,
+    0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x11ff, 0x11fe, 0x11fc, 0x11fc, 0x11f8, 0x11f8, 0x11f8, 0x11f8, 0x11f0, 0x11f0, 0x11f0, 0x11f0,
+    0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x10ff, 0x10fe, 0x10fc, 0x10fc,
+    0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x13ff, 0x13fe, 0x13fc, 0x13fc, 0x13f8, 0x13f8, 0x13f8, 0x13f8,
+    0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x107f, 0x107e, 0x107c, 0x107c,
+    0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x11ff, 0x11fe, 0x11fc, 0x11fc,
+    0x11f8, 0x11f8, 0x11f8, 0x11f8, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0,
+    0x107f, 0x107e, 0x107c, 0x107c, 0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x107f, 0x107e, 0x107c, 0x107c,
+    0x1078, 0x1078, 0x1078, 0x1078, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fdf, 0x3fde, 0x3fdc, 0x3fdc, 0x3fd8, 0x3fd8, 0x3fd8, 0x3fd8,
+    0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x30ff, 0x30fe, 0x30fc, 0x30fc,
+    0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x30df, 0x30de, 0x30dc, 0x30dc, 0x30d8, 0x30d8, 0x30d8, 0x30d8, 0x30d0, 0x30d0, 0x30d0, 0x30d0,
+    0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x31ff, 0x31fe, 0x31fc, 0x31fc, 0x31f8, 0x31f8, 0x31f8, 0x31f8,
+    0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31df, 0x31de, 0x31dc, 0x31dc,
+    0x31d8, 0x31d8, 0x31d8, 0x31d8, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0,
+    0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30df, 0x30de, 0x30dc, 0x30dc, 0x30d8, 0x30d8, 0x30d8, 0x30d8,
+    0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x33ff, 0x33fe, 0x33fc, 0x33fc,
+    0x33f8, 0x33f8, 0x33f8, 0x33f8, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0,
+    0x33df, 0x33de, 0x33dc, 0x33dc, 0x33d8, 0x33d8, 0x33d8, 0x33d8, 0x33d0, 0x33d0, 0x33d0, 0x33d0,
+    0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30df, 0x30de, 0x30dc, 0x30dc,
+    0x30d8, 0x30d8, 0x30d8, 0x30d8, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0,
+    0x31ff, 0x31fe, 0x31fc, 0x31fc, 0x31f8, 0x31f8, 0x31f8, 0x31f8, 0x31f0, 0x31f0, 0x31f0, 0x31f0,
+    0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31df, 0x31de, 0x31dc, 0x31dc, 0x31d8, 0x31d8, 0x31d8, 0x31d8,
+    0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x30ff, 0x30fe, 0x30fc, 0x30fc,
+    0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x30df, 0x30de, 0x30dc, 0x30dc, 0x30d8, 0x30d8, 0x30d8, 0x30d8, 0x30d0, 0x30d0, 0x30d0, 0x30d0,
+    0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x37ff, 0x37fe, 0x37fc, 0x37fc, 0x37f8, 0x37f8, 0x37f8, 0x37f8,
+    0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37df, 0x37de, 0x37dc, 0x37dc,
+    0x37d8, 0x37d8, 0x37d8, 0x37d8, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0,
+    0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30df, 0x30de, 0x30dc, 0x30dc, 0x30d8, 0x30d8, 0x30d8, 0x30d8,
+    0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x31ff, 0x31fe, 0x31fc, 0x31fc,
+    0x31f8, 0x31f8, 0x31f8, 0x31f8, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0,
+    0x31df, 0x31de, 0x31dc, 0x31dc, 0x31d8, 0x31d8, 0x31d8, 0x31d8, 0x31d0, 0x31d0, 0x31d0, 0x31d0,
+    0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30df, 0x30de, 0x30dc, 0x30dc,
+    0x30d8, 0x30d8, 0x30d8, 0x30d8, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0,
+    0x33ff, 0x33fe, 0x33fc, 0x33fc, 0x33f8, 0x33f8, 0x33f8, 0x33f8, 0x33f0, 0x33f0, 0x33f0, 0x33f0,
+    0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33df, 0x33de, 0x33dc, 0x33dc, 0x33d8, 0x33d8, 0x33d8, 0x33d8,
+    0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x30ff, 0x30fe, 0x30fc, 0x30fc,
+    0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x30df, 0x30de, 0x30dc, 0x30dc, 0x30d8, 0x30d8, 0x30d8, 0x30d8, 0x30d0, 0x30d0, 0x30d0, 0x30d0,
+    0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x31ff, 0x31fe, 0x31fc, 0x31fc, 0x31f8, 0x31f8, 0x31f8, 0x31f8,
+    0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31df, 0x31de, 0x31dc, 0x31dc,
+    0x31d8, 0x31d8, 0x31d8, 0x31d8, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0,
+    0x30ff, 0x30fe, 0x30fc, 0x30fc, 0x30f8, 0x30f8, 0x30f8, 0x30f8, 0x30f0, 0x30f0, 0x30f0, 0x30f0,
+    0x30f0, 0x30f0, 0x30f0, 0x30f0, 0x30df, 0x30de, 0x30dc, 0x30dc, 0x30d8, 0x30d8, 0x30d8, 0x30d8,
+    0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x30d0, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc,
+    0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0,
+    0x1fdf, 0x1fde, 0x1fdc, 0x1fdc, 0x1fd8, 0x1fd8, 0x1fd8, 0x1fd8, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0,
+    0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10df, 0x10de, 0x10dc, 0x10dc,
+    0x10d8, 0x10d8, 0x10d8, 0x10d8, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0,
+    0x11ff, 0x11fe, 0x11fc, 0x11fc, 0x11f8, 0x11f8, 0x11f8, 0x11f8, 0x11f0, 0x11f0, 0x11f0, 0x11f0,
+    0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11df, 0x11de, 0x11dc, 0x11dc, 0x11d8, 0x11d8, 0x11d8, 0x11d8,
+    0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x10ff, 0x10fe, 0x10fc, 0x10fc,
+    0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x10df, 0x10de, 0x10dc, 0x10dc, 0x10d8, 0x10d8, 0x10d8, 0x10d8, 0x10d0, 0x10d0, 0x10d0, 0x10d0,
+    0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x13ff, 0x13fe, 0x13fc, 0x13fc, 0x13f8, 0x13f8, 0x13f8, 0x13f8,
+    0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13df, 0x13de, 0x13dc, 0x13dc,
+    0x13d8, 0x13d8, 0x13d8, 0x13d8, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0,
+    0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10df, 0x10de, 0x10dc, 0x10dc, 0x10d8, 0x10d8, 0x10d8, 0x10d8,
+    0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x11ff, 0x11fe, 0x11fc, 0x11fc,
+    0x11f8, 0x11f8, 0x11f8, 0x11f8, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0,
+    0x11df, 0x11de, 0x11dc, 0x11dc, 0x11d8, 0x11d8, 0x11d8, 0x11d8, 0x11d0, 0x11d0, 0x11d0, 0x11d0,
+    0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10df, 0x10de, 0x10dc, 0x10dc,
+    0x10d8, 0x10d8, 0x10d8, 0x10d8, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0,
+    0x17ff, 0x17fe, 0x17fc, 0x17fc, 0x17f8, 0x17f8, 0x17f8, 0x17f8, 0x17f0, 0x17f0, 0x17f0, 0x17f0,
+    0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17df, 0x17de, 0x17dc, 0x17dc, 0x17d8, 0x17d8, 0x17d8, 0x17d8,
+    0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x10ff, 0x10fe, 0x10fc, 0x10fc,
+    0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x10df, 0x10de, 0x10dc, 0x10dc, 0x10d8, 0x10d8, 0x10d8, 0x10d8, 0x10d0, 0x10d0, 0x10d0, 0x10d0,
+    0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x11ff, 0x11fe, 0x11fc, 0x11fc, 0x11f8, 0x11f8, 0x11f8, 0x11f8,
+    0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11df, 0x11de, 0x11dc, 0x11dc,
+    0x11d8, 0x11d8, 0x11d8, 0x11d8, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0,
+    0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10df, 0x10de, 0x10dc, 0x10dc, 0x10d8, 0x10d8, 0x10d8, 0x10d8,
+    0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x13ff, 0x13fe, 0x13fc, 0x13fc,
+    0x13f8, 0x13f8, 0x13f8, 0x13f8, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0,
+    0x13df, 0x13de, 0x13dc, 0x13dc, 0x13d8, 0x13d8, 0x13d8, 0x13d8, 0x13d0, 0x13d0, 0x13d0, 0x13d0,
+    0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x10ff, 0x10fe, 0x10fc, 0x10fc, 0x10f8, 0x10f8, 0x10f8, 0x10f8,
+    0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10df, 0x10de, 0x10dc, 0x10dc,
+    0x10d8, 0x10d8, 0x10d8, 0x10d8, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x10d0,
+    0x11ff, 0x11fe, 0x11fc, 0x11fc, 0x11f8, 0x11f8, 0x11f8, 0x11f8, 0x11f0, 0x11f0, 0x11f0, 0x11f0,
+    0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11df, 0x11de, 0x11dc, 0x11dc, 0x11d8, 0x11d8, 0x11d8, 0x11d8,
+    0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x10ff, 0x10fe, 0x10fc, 0x10fc,
+    0x10f8, 0x10f8, 0x10f8, 0x10f8, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0, 0x10f0,
+    0x10df, 0x10de, 0x10dc, 0x10dc, 0x10d8, 0x10d8, 0x10d8, 0x10d8, 0x10d0, 0x10d0, 0x10d0, 0x10d0,
+    0x10d0, 0x10d0, 0x10d0, 0x10d0, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fdf, 0x3fde, 0x3fdc, 0x3fdc,
+    0x3fd8, 0x3fd8, 0x3fd8, 0x3fd8, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0,
+    0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c, 0x3f98, 0x3f98, 0x3f98, 0x3f98, 0x3f90, 0x3f90, 0x3f90, 0x3f90,
+    0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c, 0x3f98, 0x3f98, 0x3f98, 0x3f98,
+    0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x31ff, 0x31fe, 0x31fc, 0x31fc,
+    0x31f8, 0x31f8, 0x31f8, 0x31f8, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0,
+    0x31df, 0x31de, 0x31dc, 0x31dc, 0x31d8, 0x31d8, 0x31d8, 0x31d8, 0x31d0, 0x31d0, 0x31d0, 0x31d0,
+    0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x319f, 0x319e, 0x319c, 0x319c, 0x3198, 0x3198, 0x3198, 0x3198,
+    0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x319f, 0x319e, 0x319c, 0x319c,
+    0x3198, 0x3198, 0x3198, 0x3198, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190,
+    0x33ff, 0x33fe, 0x33fc, 0x33fc, 0x33f8, 0x33f8, 0x33f8, 0x33f8, 0x33f0, 0x33f0, 0x33f0, 0x33f0,
+    0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33df, 0x33de, 0x33dc, 0x33dc, 0x33d8, 0x33d8, 0x33d8, 0x33d8,
+    0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x339f, 0x339e, 0x339c, 0x339c,
+    0x3398, 0x3398, 0x3398, 0x3398, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390,
+    0x339f, 0x339e, 0x339c, 0x339c, 0x3398, 0x3398, 0x3398, 0x3398, 0x3390, 0x3390, 0x3390, 0x3390,
+    0x3390, 0x3390, 0x3390, 0x3390, 0x31ff, 0x31fe, 0x31fc, 0x31fc, 0x31f8, 0x31f8, 0x31f8, 0x31f8,
+    0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31df, 0x31de, 0x31dc, 0x31dc,
+    0x31d8, 0x31d8, 0x31d8, 0x31d8, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0,
+    0x319f, 0x319e, 0x319c, 0x319c, 0x3198, 0x3198, 0x3198, 0x3198, 0x3190, 0x3190, 0x3190, 0x3190,
+    0x3190, 0x3190, 0x3190, 0x3190, 0x319f, 0x319e, 0x319c, 0x319c, 0x3198, 0x3198, 0x3198, 0x3198,
+    0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x37ff, 0x37fe, 0x37fc, 0x37fc,
+    0x37f8, 0x37f8, 0x37f8, 0x37f8, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0,
+    0x37df, 0x37de, 0x37dc, 0x37dc, 0x37d8, 0x37d8, 0x37d8, 0x37d8, 0x37d0, 0x37d0, 0x37d0, 0x37d0,
+    0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x379f, 0x379e, 0x379c, 0x379c, 0x3798, 0x3798, 0x3798, 0x3798,
+    0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x379f, 0x379e, 0x379c, 0x379c,
+    0x3798, 0x3798, 0x3798, 0x3798, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790,
+    0x31ff, 0x31fe, 0x31fc, 0x31fc, 0x31f8, 0x31f8, 0x31f8, 0x31f8, 0x31f0, 0x31f0, 0x31f0, 0x31f0,
+    0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31df, 0x31de, 0x31dc, 0x31dc, 0x31d8, 0x31d8, 0x31d8, 0x31d8,
+    0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x319f, 0x319e, 0x319c, 0x319c,
+    0x3198, 0x3198, 0x3198, 0x3198, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190,
+    0x319f, 0x319e, 0x319c, 0x319c, 0x3198, 0x3198, 0x3198, 0x3198, 0x3190, 0x3190, 0x3190, 0x3190,
+    0x3190, 0x3190, 0x3190, 0x3190, 0x33ff, 0x33fe, 0x33fc, 0x33fc, 0x33f8, 0x33f8, 0x33f8, 0x33f8,
+    0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33df, 0x33de, 0x33dc, 0x33dc,
+    0x33d8, 0x33d8, 0x33d8, 0x33d8, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0,
+    0x339f, 0x339e, 0x339c, 0x339c, 0x3398, 0x3398, 0x3398, 0x3398, 0x3390, 0x3390, 0x3390, 0x3390,
+    0x3390, 0x3390, 0x3390, 0x3390, 0x339f, 0x339e, 0x339c, 0x339c, 0x3398, 0x3398, 0x3398, 0x3398,
+    0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x31ff, 0x31fe, 0x31fc, 0x31fc,
+    0x31f8, 0x31f8, 0x31f8, 0x31f8, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0, 0x31f0,
+    0x31df, 0x31de, 0x31dc, 0x31dc, 0x31d8, 0x31d8, 0x31d8, 0x31d8, 0x31d0, 0x31d0, 0x31d0, 0x31d0,
+    0x31d0, 0x31d0, 0x31d0, 0x31d0, 0x319f, 0x319e, 0x319c, 0x319c, 0x3198, 0x3198, 0x3198, 0x3198,
+    0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x319f, 0x319e, 0x319c, 0x319c,
+    0x3198, 0x3198, 0x3198, 0x3198, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190, 0x3190,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fdf, 0x1fde, 0x1fdc, 0x1fdc, 0x1fd8, 0x1fd8, 0x1fd8, 0x1fd8,
+    0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c,
+    0x1f98, 0x1f98, 0x1f98, 0x1f98, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90,
+    0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c, 0x1f98, 0x1f98, 0x1f98, 0x1f98, 0x1f90, 0x1f90, 0x1f90, 0x1f90,
+    0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x11ff, 0x11fe, 0x11fc, 0x11fc, 0x11f8, 0x11f8, 0x11f8, 0x11f8,
+    0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11df, 0x11de, 0x11dc, 0x11dc,
+    0x11d8, 0x11d8, 0x11d8, 0x11d8, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0,
+    0x119f, 0x119e, 0x119c, 0x119c, 0x1198, 0x1198, 0x1198, 0x1198, 0x1190, 0x1190, 0x1190, 0x1190,
+    0x1190, 0x1190, 0x1190, 0x1190, 0x119f, 0x119e, 0x119c, 0x119c, 0x1198, 0x1198, 0x1198, 0x1198,
+    0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x13ff, 0x13fe, 0x13fc, 0x13fc,
+    0x13f8, 0x13f8, 0x13f8, 0x13f8, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0,
+    0x13df, 0x13de, 0x13dc, 0x13dc, 0x13d8, 0x13d8, 0x13d8, 0x13d8, 0x13d0, 0x13d0, 0x13d0, 0x13d0,
+    0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x139f, 0x139e, 0x139c, 0x139c, 0x1398, 0x1398, 0x1398, 0x1398,
+    0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x139f, 0x139e, 0x139c, 0x139c,
+    0x1398, 0x1398, 0x1398, 0x1398, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390,
+    0x11ff, 0x11fe, 0x11fc, 0x11fc, 0x11f8, 0x11f8, 0x11f8, 0x11f8, 0x11f0, 0x11f0, 0x11f0, 0x11f0,
+    0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11df, 0x11de, 0x11dc, 0x11dc, 0x11d8, 0x11d8, 0x11d8, 0x11d8,
+    0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x119f, 0x119e, 0x119c, 0x119c,
+    0x1198, 0x1198, 0x1198, 0x1198, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190,
+    0x119f, 0x119e, 0x119c, 0x119c, 0x1198, 0x1198, 0x1198, 0x1198, 0x1190, 0x1190, 0x1190, 0x1190,
+    0x1190, 0x1190, 0x1190, 0x1190, 0x17ff, 0x17fe, 0x17fc, 0x17fc, 0x17f8, 0x17f8, 0x17f8, 0x17f8,
+    0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17df, 0x17de, 0x17dc, 0x17dc,
+    0x17d8, 0x17d8, 0x17d8, 0x17d8, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0,
+    0x179f, 0x179e, 0x179c, 0x179c, 0x1798, 0x1798, 0x1798, 0x1798, 0x1790, 0x1790, 0x1790, 0x1790,
+    0x1790, 0x1790, 0x1790, 0x1790, 0x179f, 0x179e, 0x179c, 0x179c, 0x1798, 0x1798, 0x1798, 0x1798,
+    0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x11ff, 0x11fe, 0x11fc, 0x11fc,
+    0x11f8, 0x11f8, 0x11f8, 0x11f8, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0,
+    0x11df, 0x11de, 0x11dc, 0x11dc, 0x11d8, 0x11d8, 0x11d8, 0x11d8, 0x11d0, 0x11d0, 0x11d0, 0x11d0,
+    0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x119f, 0x119e, 0x119c, 0x119c, 0x1198, 0x1198, 0x1198, 0x1198,
+    0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x119f, 0x119e, 0x119c, 0x119c,
+    0x1198, 0x1198, 0x1198, 0x1198, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190,
+    0x13ff, 0x13fe, 0x13fc, 0x13fc, 0x13f8, 0x13f8, 0x13f8, 0x13f8, 0x13f0, 0x13f0, 0x13f0, 0x13f0,
+    0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13df, 0x13de, 0x13dc, 0x13dc, 0x13d8, 0x13d8, 0x13d8, 0x13d8,
+    0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x139f, 0x139e, 0x139c, 0x139c,
+    0x1398, 0x1398, 0x1398, 0x1398, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390,
+    0x139f, 0x139e, 0x139c, 0x139c, 0x1398, 0x1398, 0x1398, 0x1398, 0x1390, 0x1390, 0x1390, 0x1390,
+    0x1390, 0x1390, 0x1390, 0x1390, 0x11ff, 0x11fe, 0x11fc, 0x11fc, 0x11f8, 0x11f8, 0x11f8, 0x11f8,
+    0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11f0, 0x11df, 0x11de, 0x11dc, 0x11dc,
+    0x11d8, 0x11d8, 0x11d8, 0x11d8, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0, 0x11d0,
+    0x119f, 0x119e, 0x119c, 0x119c, 0x1198, 0x1198, 0x1198, 0x1198, 0x1190, 0x1190, 0x1190, 0x1190,
+    0x1190, 0x1190, 0x1190, 0x1190, 0x119f, 0x119e, 0x119c, 0x119c, 0x1198, 0x1198, 0x1198, 0x1198,
+    0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x1190, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3fdf, 0x3fde, 0x3fdc, 0x3fdc, 0x3fd8, 0x3fd8, 0x3fd8, 0x3fd8, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0,
+    0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c, 0x3f98, 0x3f98, 0x3f98, 0x3f98,
+    0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c,
+    0x3f98, 0x3f98, 0x3f98, 0x3f98, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90,
+    0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c, 0x3f18, 0x3f18, 0x3f18, 0x3f18, 0x3f10, 0x3f10, 0x3f10, 0x3f10,
+    0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c, 0x3f18, 0x3f18, 0x3f18, 0x3f18,
+    0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c,
+    0x3f18, 0x3f18, 0x3f18, 0x3f18, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10,
+    0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c, 0x3f18, 0x3f18, 0x3f18, 0x3f18, 0x3f10, 0x3f10, 0x3f10, 0x3f10,
+    0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x33ff, 0x33fe, 0x33fc, 0x33fc, 0x33f8, 0x33f8, 0x33f8, 0x33f8,
+    0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33df, 0x33de, 0x33dc, 0x33dc,
+    0x33d8, 0x33d8, 0x33d8, 0x33d8, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x33d0,
+    0x339f, 0x339e, 0x339c, 0x339c, 0x3398, 0x3398, 0x3398, 0x3398, 0x3390, 0x3390, 0x3390, 0x3390,
+    0x3390, 0x3390, 0x3390, 0x3390, 0x339f, 0x339e, 0x339c, 0x339c, 0x3398, 0x3398, 0x3398, 0x3398,
+    0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x331f, 0x331e, 0x331c, 0x331c,
+    0x3318, 0x3318, 0x3318, 0x3318, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310,
+    0x331f, 0x331e, 0x331c, 0x331c, 0x3318, 0x3318, 0x3318, 0x3318, 0x3310, 0x3310, 0x3310, 0x3310,
+    0x3310, 0x3310, 0x3310, 0x3310, 0x331f, 0x331e, 0x331c, 0x331c, 0x3318, 0x3318, 0x3318, 0x3318,
+    0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x331f, 0x331e, 0x331c, 0x331c,
+    0x3318, 0x3318, 0x3318, 0x3318, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310,
+    0x37ff, 0x37fe, 0x37fc, 0x37fc, 0x37f8, 0x37f8, 0x37f8, 0x37f8, 0x37f0, 0x37f0, 0x37f0, 0x37f0,
+    0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37df, 0x37de, 0x37dc, 0x37dc, 0x37d8, 0x37d8, 0x37d8, 0x37d8,
+    0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x379f, 0x379e, 0x379c, 0x379c,
+    0x3798, 0x3798, 0x3798, 0x3798, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790,
+    0x379f, 0x379e, 0x379c, 0x379c, 0x3798, 0x3798, 0x3798, 0x3798, 0x3790, 0x3790, 0x3790, 0x3790,
+    0x3790, 0x3790, 0x3790, 0x3790, 0x371f, 0x371e, 0x371c, 0x371c, 0x3718, 0x3718, 0x3718, 0x3718,
+    0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x371f, 0x371e, 0x371c, 0x371c,
+    0x3718, 0x3718, 0x3718, 0x3718, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710,
+    0x371f, 0x371e, 0x371c, 0x371c, 0x3718, 0x3718, 0x3718, 0x3718, 0x3710, 0x3710, 0x3710, 0x3710,
+    0x3710, 0x3710, 0x3710, 0x3710, 0x371f, 0x371e, 0x371c, 0x371c, 0x3718, 0x3718, 0x3718, 0x3718,
+    0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x33ff, 0x33fe, 0x33fc, 0x33fc,
+    0x33f8, 0x33f8, 0x33f8, 0x33f8, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0, 0x33f0,
+    0x33df, 0x33de, 0x33dc, 0x33dc, 0x33d8, 0x33d8, 0x33d8, 0x33d8, 0x33d0, 0x33d0, 0x33d0, 0x33d0,
+    0x33d0, 0x33d0, 0x33d0, 0x33d0, 0x339f, 0x339e, 0x339c, 0x339c, 0x3398, 0x3398, 0x3398, 0x3398,
+    0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x339f, 0x339e, 0x339c, 0x339c,
+    0x3398, 0x3398, 0x3398, 0x3398, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390, 0x3390,
+    0x331f, 0x331e, 0x331c, 0x331c, 0x3318, 0x3318, 0x3318, 0x3318, 0x3310, 0x3310, 0x3310, 0x3310,
+    0x3310, 0x3310, 0x3310, 0x3310, 0x331f, 0x331e, 0x331c, 0x331c, 0x3318, 0x3318, 0x3318, 0x3318,
+    0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x331f, 0x331e, 0x331c, 0x331c,
+    0x3318, 0x3318, 0x3318, 0x3318, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310, 0x3310,
+    0x331f, 0x331e, 0x331c, 0x331c, 0x3318, 0x3318, 0x3318, 0x3318, 0x3310, 0x3310, 0x3310, 0x3310,
+    0x3310, 0x3310, 0x3310, 0x3310, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fdf, 0x1fde, 0x1fdc, 0x1fdc,
+    0x1fd8, 0x1fd8, 0x1fd8, 0x1fd8, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0,
+    0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c, 0x1f98, 0x1f98, 0x1f98, 0x1f98, 0x1f90, 0x1f90, 0x1f90, 0x1f90,
+    0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c, 0x1f98, 0x1f98, 0x1f98, 0x1f98,
+    0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c,
+    0x1f18, 0x1f18, 0x1f18, 0x1f18, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10,
+    0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c, 0x1f18, 0x1f18, 0x1f18, 0x1f18, 0x1f10, 0x1f10, 0x1f10, 0x1f10,
+    0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c, 0x1f18, 0x1f18, 0x1f18, 0x1f18,
+    0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c,
+    0x1f18, 0x1f18, 0x1f18, 0x1f18, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10,
+    0x13ff, 0x13fe, 0x13fc, 0x13fc, 0x13f8, 0x13f8, 0x13f8, 0x13f8, 0x13f0, 0x13f0, 0x13f0, 0x13f0,
+    0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13df, 0x13de, 0x13dc, 0x13dc, 0x13d8, 0x13d8, 0x13d8, 0x13d8,
+    0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x139f, 0x139e, 0x139c, 0x139c,
+    0x1398, 0x1398, 0x1398, 0x1398, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390,
+    0x139f, 0x139e, 0x139c, 0x139c, 0x1398, 0x1398, 0x1398, 0x1398, 0x1390, 0x1390, 0x1390, 0x1390,
+    0x1390, 0x1390, 0x1390, 0x1390, 0x131f, 0x131e, 0x131c, 0x131c, 0x1318, 0x1318, 0x1318, 0x1318,
+    0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x131f, 0x131e, 0x131c, 0x131c,
+    0x1318, 0x1318, 0x1318, 0x1318, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310,
+    0x131f, 0x131e, 0x131c, 0x131c, 0x1318, 0x1318, 0x1318, 0x1318, 0x1310, 0x1310, 0x1310, 0x1310,
+    0x1310, 0x1310, 0x1310, 0x1310, 0x131f, 0x131e, 0x131c, 0x131c, 0x1318, 0x1318, 0x1318, 0x1318,
+    0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x17ff, 0x17fe, 0x17fc, 0x17fc,
+    0x17f8, 0x17f8, 0x17f8, 0x17f8, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17f0,
+    0x17df, 0x17de, 0x17dc, 0x17dc, 0x17d8, 0x17d8, 0x17d8, 0x17d8, 0x17d0, 0x17d0, 0x17d0, 0x17d0,
+    0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x179f, 0x179e, 0x179c, 0x179c, 0x1798, 0x1798, 0x1798, 0x1798,
+    0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x179f, 0x179e, 0x179c, 0x179c,
+    0x1798, 0x1798, 0x1798, 0x1798, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790,
+    0x171f, 0x171e, 0x171c, 0x171c, 0x1718, 0x1718, 0x1718, 0x1718, 0x1710, 0x1710, 0x1710, 0x1710,
+    0x1710, 0x1710, 0x1710, 0x1710, 0x171f, 0x171e, 0x171c, 0x171c, 0x1718, 0x1718, 0x1718, 0x1718,
+    0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x171f, 0x171e, 0x171c, 0x171c,
+    0x1718, 0x1718, 0x1718, 0x1718, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710,
+    0x171f, 0x171e, 0x171c, 0x171c, 0x1718, 0x1718, 0x1718, 0x1718, 0x1710, 0x1710, 0x1710, 0x1710,
+    0x1710, 0x1710, 0x1710, 0x1710, 0x13ff, 0x13fe, 0x13fc, 0x13fc, 0x13f8, 0x13f8, 0x13f8, 0x13f8,
+    0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13f0, 0x13df, 0x13de, 0x13dc, 0x13dc,
+    0x13d8, 0x13d8, 0x13d8, 0x13d8, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0,
+    0x139f, 0x139e, 0x139c, 0x139c, 0x1398, 0x1398, 0x1398, 0x1398, 0x1390, 0x1390, 0x1390, 0x1390,
+    0x1390, 0x1390, 0x1390, 0x1390, 0x139f, 0x139e, 0x139c, 0x139c, 0x1398, 0x1398, 0x1398, 0x1398,
+    0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x1390, 0x131f, 0x131e, 0x131c, 0x131c,
+    0x1318, 0x1318, 0x1318, 0x1318, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310,
+    0x131f, 0x131e, 0x131c, 0x131c, 0x1318, 0x1318, 0x1318, 0x1318, 0x1310, 0x1310, 0x1310, 0x1310,
+    0x1310, 0x1310, 0x1310, 0x1310, 0x131f, 0x131e, 0x131c, 0x131c, 0x1318, 0x1318, 0x1318, 0x1318,
+    0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x131f, 0x131e, 0x131c, 0x131c,
+    0x1318, 0x1318, 0x1318, 0x1318, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310, 0x1310,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fdf, 0x3fde, 0x3fdc, 0x3fdc, 0x3fd8, 0x3fd8, 0x3fd8, 0x3fd8,
+    0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c,
+    0x3f98, 0x3f98, 0x3f98, 0x3f98, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90,
+    0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c, 0x3f98, 0x3f98, 0x3f98, 0x3f98, 0x3f90, 0x3f90, 0x3f90, 0x3f90,
+    0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c, 0x3f18, 0x3f18, 0x3f18, 0x3f18,
+    0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c,
+    0x3f18, 0x3f18, 0x3f18, 0x3f18, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10,
+    0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c, 0x3f18, 0x3f18, 0x3f18, 0x3f18, 0x3f10, 0x3f10, 0x3f10, 0x3f10,
+    0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c, 0x3f18, 0x3f18, 0x3f18, 0x3f18,
+    0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c,
+    0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c,
+    0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c,
+    0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x37ff, 0x37fe, 0x37fc, 0x37fc, 0x37f8, 0x37f8, 0x37f8, 0x37f8,
+    0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37f0, 0x37df, 0x37de, 0x37dc, 0x37dc,
+    0x37d8, 0x37d8, 0x37d8, 0x37d8, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0, 0x37d0,
+    0x379f, 0x379e, 0x379c, 0x379c, 0x3798, 0x3798, 0x3798, 0x3798, 0x3790, 0x3790, 0x3790, 0x3790,
+    0x3790, 0x3790, 0x3790, 0x3790, 0x379f, 0x379e, 0x379c, 0x379c, 0x3798, 0x3798, 0x3798, 0x3798,
+    0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x3790, 0x371f, 0x371e, 0x371c, 0x371c,
+    0x3718, 0x3718, 0x3718, 0x3718, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710,
+    0x371f, 0x371e, 0x371c, 0x371c, 0x3718, 0x3718, 0x3718, 0x3718, 0x3710, 0x3710, 0x3710, 0x3710,
+    0x3710, 0x3710, 0x3710, 0x3710, 0x371f, 0x371e, 0x371c, 0x371c, 0x3718, 0x3718, 0x3718, 0x3718,
+    0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x371f, 0x371e, 0x371c, 0x371c,
+    0x3718, 0x3718, 0x3718, 0x3718, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710, 0x3710,
+    0x361f, 0x361e, 0x361c, 0x361c, 0x3618, 0x3618, 0x3618, 0x3618, 0x3610, 0x3610, 0x3610, 0x3610,
+    0x3610, 0x3610, 0x3610, 0x3610, 0x361f, 0x361e, 0x361c, 0x361c, 0x3618, 0x3618, 0x3618, 0x3618,
+    0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x361f, 0x361e, 0x361c, 0x361c,
+    0x3618, 0x3618, 0x3618, 0x3618, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610,
+    0x361f, 0x361e, 0x361c, 0x361c, 0x3618, 0x3618, 0x3618, 0x3618, 0x3610, 0x3610, 0x3610, 0x3610,
+    0x3610, 0x3610, 0x3610, 0x3610, 0x361f, 0x361e, 0x361c, 0x361c, 0x3618, 0x3618, 0x3618, 0x3618,
+    0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x361f, 0x361e, 0x361c, 0x361c,
+    0x3618, 0x3618, 0x3618, 0x3618, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610,
+    0x361f, 0x361e, 0x361c, 0x361c, 0x3618, 0x3618, 0x3618, 0x3618, 0x3610, 0x3610, 0x3610, 0x3610,
+    0x3610, 0x3610, 0x3610, 0x3610, 0x361f, 0x361e, 0x361c, 0x361c, 0x3618, 0x3618, 0x3618, 0x3618,
+    0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x3610, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc,
+    0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0,
+    0x1fdf, 0x1fde, 0x1fdc, 0x1fdc, 0x1fd8, 0x1fd8, 0x1fd8, 0x1fd8, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0,
+    0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c, 0x1f98, 0x1f98, 0x1f98, 0x1f98,
+    0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c,
+    0x1f98, 0x1f98, 0x1f98, 0x1f98, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90,
+    0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c, 0x1f18, 0x1f18, 0x1f18, 0x1f18, 0x1f10, 0x1f10, 0x1f10, 0x1f10,
+    0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c, 0x1f18, 0x1f18, 0x1f18, 0x1f18,
+    0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c,
+    0x1f18, 0x1f18, 0x1f18, 0x1f18, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10,
+    0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c, 0x1f18, 0x1f18, 0x1f18, 0x1f18, 0x1f10, 0x1f10, 0x1f10, 0x1f10,
+    0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c,
+    0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c,
+    0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c,
+    0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x17ff, 0x17fe, 0x17fc, 0x17fc, 0x17f8, 0x17f8, 0x17f8, 0x17f8, 0x17f0, 0x17f0, 0x17f0, 0x17f0,
+    0x17f0, 0x17f0, 0x17f0, 0x17f0, 0x17df, 0x17de, 0x17dc, 0x17dc, 0x17d8, 0x17d8, 0x17d8, 0x17d8,
+    0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x17d0, 0x179f, 0x179e, 0x179c, 0x179c,
+    0x1798, 0x1798, 0x1798, 0x1798, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790,
+    0x179f, 0x179e, 0x179c, 0x179c, 0x1798, 0x1798, 0x1798, 0x1798, 0x1790, 0x1790, 0x1790, 0x1790,
+    0x1790, 0x1790, 0x1790, 0x1790, 0x171f, 0x171e, 0x171c, 0x171c, 0x1718, 0x1718, 0x1718, 0x1718,
+    0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x171f, 0x171e, 0x171c, 0x171c,
+    0x1718, 0x1718, 0x1718, 0x1718, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710,
+    0x171f, 0x171e, 0x171c, 0x171c, 0x1718, 0x1718, 0x1718, 0x1718, 0x1710, 0x1710, 0x1710, 0x1710,
+    0x1710, 0x1710, 0x1710, 0x1710, 0x171f, 0x171e, 0x171c, 0x171c, 0x1718, 0x1718, 0x1718, 0x1718,
+    0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x161f, 0x161e, 0x161c, 0x161c,
+    0x1618, 0x1618, 0x1618, 0x1618, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610,
+    0x161f, 0x161e, 0x161c, 0x161c, 0x1618, 0x1618, 0x1618, 0x1618, 0x1610, 0x1610, 0x1610, 0x1610,
+    0x1610, 0x1610, 0x1610, 0x1610, 0x161f, 0x161e, 0x161c, 0x161c, 0x1618, 0x1618, 0x1618, 0x1618,
+    0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x161f, 0x161e, 0x161c, 0x161c,
+    0x1618, 0x1618, 0x1618, 0x1618, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610,
+    0x161f, 0x161e, 0x161c, 0x161c, 0x1618, 0x1618, 0x1618, 0x1618, 0x1610, 0x1610, 0x1610, 0x1610,
+    0x1610, 0x1610, 0x1610, 0x1610, 0x161f, 0x161e, 0x161c, 0x161c, 0x1618, 0x1618, 0x1618, 0x1618,
+    0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x161f, 0x161e, 0x161c, 0x161c,
+    0x1618, 0x1618, 0x1618, 0x1618, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610, 0x1610,
+    0x161f, 0x161e, 0x161c, 0x161c, 0x1618, 0x1618, 0x1618, 0x1618, 0x1610, 0x1610, 0x1610, 0x1610,
+    0x1610, 0x1610, 0x1610, 0x1610, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fdf, 0x3fde, 0x3fdc, 0x3fdc,
+    0x3fd8, 0x3fd8, 0x3fd8, 0x3fd8, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0,
+    0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c, 0x3f98, 0x3f98, 0x3f98, 0x3f98, 0x3f90, 0x3f90, 0x3f90, 0x3f90,
+    0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c, 0x3f98, 0x3f98, 0x3f98, 0x3f98,
+    0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c,
+    0x3f18, 0x3f18, 0x3f18, 0x3f18, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10,
+    0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c, 0x3f18, 0x3f18, 0x3f18, 0x3f18, 0x3f10, 0x3f10, 0x3f10, 0x3f10,
+    0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c, 0x3f18, 0x3f18, 0x3f18, 0x3f18,
+    0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c,
+    0x3f18, 0x3f18, 0x3f18, 0x3f18, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10,
+    0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c,
+    0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c,
+    0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fdf, 0x1fde, 0x1fdc, 0x1fdc, 0x1fd8, 0x1fd8, 0x1fd8, 0x1fd8,
+    0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c,
+    0x1f98, 0x1f98, 0x1f98, 0x1f98, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90,
+    0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c, 0x1f98, 0x1f98, 0x1f98, 0x1f98, 0x1f90, 0x1f90, 0x1f90, 0x1f90,
+    0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c, 0x1f18, 0x1f18, 0x1f18, 0x1f18,
+    0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c,
+    0x1f18, 0x1f18, 0x1f18, 0x1f18, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10,
+    0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c, 0x1f18, 0x1f18, 0x1f18, 0x1f18, 0x1f10, 0x1f10, 0x1f10, 0x1f10,
+    0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c, 0x1f18, 0x1f18, 0x1f18, 0x1f18,
+    0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c,
+    0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c,
+    0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c,
+    0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3fdf, 0x3fde, 0x3fdc, 0x3fdc, 0x3fd8, 0x3fd8, 0x3fd8, 0x3fd8, 0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0,
+    0x3fd0, 0x3fd0, 0x3fd0, 0x3fd0, 0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c, 0x3f98, 0x3f98, 0x3f98, 0x3f98,
+    0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f9f, 0x3f9e, 0x3f9c, 0x3f9c,
+    0x3f98, 0x3f98, 0x3f98, 0x3f98, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90, 0x3f90,
+    0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c, 0x3f18, 0x3f18, 0x3f18, 0x3f18, 0x3f10, 0x3f10, 0x3f10, 0x3f10,
+    0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c, 0x3f18, 0x3f18, 0x3f18, 0x3f18,
+    0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c,
+    0x3f18, 0x3f18, 0x3f18, 0x3f18, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3f10,
+    0x3f1f, 0x3f1e, 0x3f1c, 0x3f1c, 0x3f18, 0x3f18, 0x3f18, 0x3f18, 0x3f10, 0x3f10, 0x3f10, 0x3f10,
+    0x3f10, 0x3f10, 0x3f10, 0x3f10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c,
+    0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c,
+    0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c, 0x3e18, 0x3e18, 0x3e18, 0x3e18,
+    0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e1f, 0x3e1e, 0x3e1c, 0x3e1c,
+    0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10, 0x3e10,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c,
+    0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c1f, 0x3c1e, 0x3c1c, 0x3c1c, 0x3c18, 0x3c18, 0x3c18, 0x3c18, 0x3c10, 0x3c10, 0x3c10, 0x3c10,
+    0x3c10, 0x3c10, 0x3c10, 0x3c10, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c, 0x3818, 0x3818, 0x3818, 0x3818,
+    0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x381f, 0x381e, 0x381c, 0x381c,
+    0x3818, 0x3818, 0x3818, 0x3818, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810, 0x3810,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fdf, 0x1fde, 0x1fdc, 0x1fdc, 0x1fd8, 0x1fd8, 0x1fd8, 0x1fd8,
+    0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1fd0, 0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c,
+    0x1f98, 0x1f98, 0x1f98, 0x1f98, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f90,
+    0x1f9f, 0x1f9e, 0x1f9c, 0x1f9c, 0x1f98, 0x1f98, 0x1f98, 0x1f98, 0x1f90, 0x1f90, 0x1f90, 0x1f90,
+    0x1f90, 0x1f90, 0x1f90, 0x1f90, 0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c, 0x1f18, 0x1f18, 0x1f18, 0x1f18,
+    0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c,
+    0x1f18, 0x1f18, 0x1f18, 0x1f18, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10,
+    0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c, 0x1f18, 0x1f18, 0x1f18, 0x1f18, 0x1f10, 0x1f10, 0x1f10, 0x1f10,
+    0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f1f, 0x1f1e, 0x1f1c, 0x1f1c, 0x1f18, 0x1f18, 0x1f18, 0x1f18,
+    0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1f10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c,
+    0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c,
+    0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c,
+    0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e1f, 0x1e1e, 0x1e1c, 0x1e1c, 0x1e18, 0x1e18, 0x1e18, 0x1e18, 0x1e10, 0x1e10, 0x1e10, 0x1e10,
+    0x1e10, 0x1e10, 0x1e10, 0x1e10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c,
+    0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18, 0x1c10, 0x1c10, 0x1c10, 0x1c10,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c1f, 0x1c1e, 0x1c1c, 0x1c1c, 0x1c18, 0x1c18, 0x1c18, 0x1c18,
+    0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x1c10, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x181f, 0x181e, 0x181c, 0x181c,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x181f, 0x181e, 0x181c, 0x181c, 0x1818, 0x1818, 0x1818, 0x1818, 0x1810, 0x1810, 0x1810, 0x1810,
+    0x1810, 0x1810, 0x1810, 0x1810, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x23ff, 0x23fe, 0x23fc, 0x23fc,
+    0x23f8, 0x23f8, 0x23f8, 0x23f8, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x27ff, 0x27fe, 0x27fc, 0x27fc, 0x27f8, 0x27f8, 0x27f8, 0x27f8, 0x27f0, 0x27f0, 0x27f0, 0x27f0,
+    0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x21ff, 0x21fe, 0x21fc, 0x21fc,
+    0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x23ff, 0x23fe, 0x23fc, 0x23fc, 0x23f8, 0x23f8, 0x23f8, 0x23f8,
+    0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2fff, 0x2ffe, 0x2ffc, 0x2ffc,
+    0x2ff8, 0x2ff8, 0x2ff8, 0x2ff8, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0,
+    0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0,
+    0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x23ff, 0x23fe, 0x23fc, 0x23fc, 0x23f8, 0x23f8, 0x23f8, 0x23f8, 0x23f0, 0x23f0, 0x23f0, 0x23f0,
+    0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x21ff, 0x21fe, 0x21fc, 0x21fc,
+    0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x27ff, 0x27fe, 0x27fc, 0x27fc, 0x27f8, 0x27f8, 0x27f8, 0x27f8,
+    0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x23ff, 0x23fe, 0x23fc, 0x23fc,
+    0x23f8, 0x23f8, 0x23f8, 0x23f8, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x23ff, 0x23fe, 0x23fc, 0x23fc,
+    0x23f8, 0x23f8, 0x23f8, 0x23f8, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x27ff, 0x27fe, 0x27fc, 0x27fc, 0x27f8, 0x27f8, 0x27f8, 0x27f8,
+    0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x21ff, 0x21fe, 0x21fc, 0x21fc,
+    0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x23ff, 0x23fe, 0x23fc, 0x23fc, 0x23f8, 0x23f8, 0x23f8, 0x23f8, 0x23f0, 0x23f0, 0x23f0, 0x23f0,
+    0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x2fff, 0x2ffe, 0x2ffc, 0x2ffc,
+    0x2ff8, 0x2ff8, 0x2ff8, 0x2ff8, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0,
+    0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0,
+    0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x23ff, 0x23fe, 0x23fc, 0x23fc, 0x23f8, 0x23f8, 0x23f8, 0x23f8,
+    0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x21ff, 0x21fe, 0x21fc, 0x21fc,
+    0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x27ff, 0x27fe, 0x27fc, 0x27fc, 0x27f8, 0x27f8, 0x27f8, 0x27f8, 0x27f0, 0x27f0, 0x27f0, 0x27f0,
+    0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x23ff, 0x23fe, 0x23fc, 0x23fc,
+    0x23f8, 0x23f8, 0x23f8, 0x23f8, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x20ff, 0x20fe, 0x20fc, 0x20fc, 0x20f8, 0x20f8, 0x20f8, 0x20f8,
+    0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x20ff, 0x20fe, 0x20fc, 0x20fc,
+    0x20f8, 0x20f8, 0x20f8, 0x20f8, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0, 0x20f0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x20e0,
+    0x20e0, 0x20e0, 0x20e0, 0x20e0, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fbf, 0x3fbe, 0x3fbc, 0x3fbc, 0x3fb8, 0x3fb8, 0x3fb8, 0x3fb8, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0,
+    0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0,
+    0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x21ff, 0x21fe, 0x21fc, 0x21fc,
+    0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21bf, 0x21be, 0x21bc, 0x21bc, 0x21b8, 0x21b8, 0x21b8, 0x21b8,
+    0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21a0, 0x21a0, 0x21a0, 0x21a0,
+    0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0,
+    0x23ff, 0x23fe, 0x23fc, 0x23fc, 0x23f8, 0x23f8, 0x23f8, 0x23f8, 0x23f0, 0x23f0, 0x23f0, 0x23f0,
+    0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23bf, 0x23be, 0x23bc, 0x23bc,
+    0x23b8, 0x23b8, 0x23b8, 0x23b8, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0,
+    0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0,
+    0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21bf, 0x21be, 0x21bc, 0x21bc, 0x21b8, 0x21b8, 0x21b8, 0x21b8, 0x21b0, 0x21b0, 0x21b0, 0x21b0,
+    0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0,
+    0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x27ff, 0x27fe, 0x27fc, 0x27fc,
+    0x27f8, 0x27f8, 0x27f8, 0x27f8, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27bf, 0x27be, 0x27bc, 0x27bc, 0x27b8, 0x27b8, 0x27b8, 0x27b8,
+    0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27a0, 0x27a0, 0x27a0, 0x27a0,
+    0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0,
+    0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21bf, 0x21be, 0x21bc, 0x21bc,
+    0x21b8, 0x21b8, 0x21b8, 0x21b8, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0,
+    0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0,
+    0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x23ff, 0x23fe, 0x23fc, 0x23fc, 0x23f8, 0x23f8, 0x23f8, 0x23f8,
+    0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23bf, 0x23be, 0x23bc, 0x23bc, 0x23b8, 0x23b8, 0x23b8, 0x23b8, 0x23b0, 0x23b0, 0x23b0, 0x23b0,
+    0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0,
+    0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x21ff, 0x21fe, 0x21fc, 0x21fc,
+    0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21bf, 0x21be, 0x21bc, 0x21bc, 0x21b8, 0x21b8, 0x21b8, 0x21b8,
+    0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21a0, 0x21a0, 0x21a0, 0x21a0,
+    0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0,
+    0x2fff, 0x2ffe, 0x2ffc, 0x2ffc, 0x2ff8, 0x2ff8, 0x2ff8, 0x2ff8, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0,
+    0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0,
+    0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fbf, 0x2fbe, 0x2fbc, 0x2fbc,
+    0x2fb8, 0x2fb8, 0x2fb8, 0x2fb8, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0,
+    0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0,
+    0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21bf, 0x21be, 0x21bc, 0x21bc, 0x21b8, 0x21b8, 0x21b8, 0x21b8, 0x21b0, 0x21b0, 0x21b0, 0x21b0,
+    0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0,
+    0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x23ff, 0x23fe, 0x23fc, 0x23fc,
+    0x23f8, 0x23f8, 0x23f8, 0x23f8, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23bf, 0x23be, 0x23bc, 0x23bc, 0x23b8, 0x23b8, 0x23b8, 0x23b8,
+    0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23a0, 0x23a0, 0x23a0, 0x23a0,
+    0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0,
+    0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21bf, 0x21be, 0x21bc, 0x21bc,
+    0x21b8, 0x21b8, 0x21b8, 0x21b8, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0,
+    0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0,
+    0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x27ff, 0x27fe, 0x27fc, 0x27fc, 0x27f8, 0x27f8, 0x27f8, 0x27f8,
+    0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27bf, 0x27be, 0x27bc, 0x27bc, 0x27b8, 0x27b8, 0x27b8, 0x27b8, 0x27b0, 0x27b0, 0x27b0, 0x27b0,
+    0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0,
+    0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x21ff, 0x21fe, 0x21fc, 0x21fc,
+    0x21f8, 0x21f8, 0x21f8, 0x21f8, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21bf, 0x21be, 0x21bc, 0x21bc, 0x21b8, 0x21b8, 0x21b8, 0x21b8,
+    0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21a0, 0x21a0, 0x21a0, 0x21a0,
+    0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0,
+    0x23ff, 0x23fe, 0x23fc, 0x23fc, 0x23f8, 0x23f8, 0x23f8, 0x23f8, 0x23f0, 0x23f0, 0x23f0, 0x23f0,
+    0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23bf, 0x23be, 0x23bc, 0x23bc,
+    0x23b8, 0x23b8, 0x23b8, 0x23b8, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0,
+    0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0,
+    0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x21ff, 0x21fe, 0x21fc, 0x21fc, 0x21f8, 0x21f8, 0x21f8, 0x21f8,
+    0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21f0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0, 0x21e0,
+    0x21bf, 0x21be, 0x21bc, 0x21bc, 0x21b8, 0x21b8, 0x21b8, 0x21b8, 0x21b0, 0x21b0, 0x21b0, 0x21b0,
+    0x21b0, 0x21b0, 0x21b0, 0x21b0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0,
+    0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x21a0, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fbf, 0x3fbe, 0x3fbc, 0x3fbc, 0x3fb8, 0x3fb8, 0x3fb8, 0x3fb8,
+    0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0,
+    0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0,
+    0x3f3f, 0x3f3e, 0x3f3c, 0x3f3c, 0x3f38, 0x3f38, 0x3f38, 0x3f38, 0x3f30, 0x3f30, 0x3f30, 0x3f30,
+    0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f3f, 0x3f3e, 0x3f3c, 0x3f3c,
+    0x3f38, 0x3f38, 0x3f38, 0x3f38, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x23ff, 0x23fe, 0x23fc, 0x23fc, 0x23f8, 0x23f8, 0x23f8, 0x23f8,
+    0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23bf, 0x23be, 0x23bc, 0x23bc, 0x23b8, 0x23b8, 0x23b8, 0x23b8, 0x23b0, 0x23b0, 0x23b0, 0x23b0,
+    0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0,
+    0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x233f, 0x233e, 0x233c, 0x233c,
+    0x2338, 0x2338, 0x2338, 0x2338, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330,
+    0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320,
+    0x2320, 0x2320, 0x2320, 0x2320, 0x233f, 0x233e, 0x233c, 0x233c, 0x2338, 0x2338, 0x2338, 0x2338,
+    0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2320, 0x2320, 0x2320, 0x2320,
+    0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320,
+    0x27ff, 0x27fe, 0x27fc, 0x27fc, 0x27f8, 0x27f8, 0x27f8, 0x27f8, 0x27f0, 0x27f0, 0x27f0, 0x27f0,
+    0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27bf, 0x27be, 0x27bc, 0x27bc,
+    0x27b8, 0x27b8, 0x27b8, 0x27b8, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0,
+    0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0,
+    0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x273f, 0x273e, 0x273c, 0x273c, 0x2738, 0x2738, 0x2738, 0x2738,
+    0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2720, 0x2720, 0x2720, 0x2720,
+    0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720,
+    0x273f, 0x273e, 0x273c, 0x273c, 0x2738, 0x2738, 0x2738, 0x2738, 0x2730, 0x2730, 0x2730, 0x2730,
+    0x2730, 0x2730, 0x2730, 0x2730, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720,
+    0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x23ff, 0x23fe, 0x23fc, 0x23fc,
+    0x23f8, 0x23f8, 0x23f8, 0x23f8, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23bf, 0x23be, 0x23bc, 0x23bc, 0x23b8, 0x23b8, 0x23b8, 0x23b8,
+    0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23a0, 0x23a0, 0x23a0, 0x23a0,
+    0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0,
+    0x233f, 0x233e, 0x233c, 0x233c, 0x2338, 0x2338, 0x2338, 0x2338, 0x2330, 0x2330, 0x2330, 0x2330,
+    0x2330, 0x2330, 0x2330, 0x2330, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320,
+    0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x233f, 0x233e, 0x233c, 0x233c,
+    0x2338, 0x2338, 0x2338, 0x2338, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330,
+    0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320,
+    0x2320, 0x2320, 0x2320, 0x2320, 0x2fff, 0x2ffe, 0x2ffc, 0x2ffc, 0x2ff8, 0x2ff8, 0x2ff8, 0x2ff8,
+    0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0,
+    0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0,
+    0x2fbf, 0x2fbe, 0x2fbc, 0x2fbc, 0x2fb8, 0x2fb8, 0x2fb8, 0x2fb8, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0,
+    0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0,
+    0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2f3f, 0x2f3e, 0x2f3c, 0x2f3c,
+    0x2f38, 0x2f38, 0x2f38, 0x2f38, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30,
+    0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20,
+    0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f3f, 0x2f3e, 0x2f3c, 0x2f3c, 0x2f38, 0x2f38, 0x2f38, 0x2f38,
+    0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f20, 0x2f20, 0x2f20, 0x2f20,
+    0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20,
+    0x23ff, 0x23fe, 0x23fc, 0x23fc, 0x23f8, 0x23f8, 0x23f8, 0x23f8, 0x23f0, 0x23f0, 0x23f0, 0x23f0,
+    0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23bf, 0x23be, 0x23bc, 0x23bc,
+    0x23b8, 0x23b8, 0x23b8, 0x23b8, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23b0,
+    0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0,
+    0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x233f, 0x233e, 0x233c, 0x233c, 0x2338, 0x2338, 0x2338, 0x2338,
+    0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2320, 0x2320, 0x2320, 0x2320,
+    0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320,
+    0x233f, 0x233e, 0x233c, 0x233c, 0x2338, 0x2338, 0x2338, 0x2338, 0x2330, 0x2330, 0x2330, 0x2330,
+    0x2330, 0x2330, 0x2330, 0x2330, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320,
+    0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x27ff, 0x27fe, 0x27fc, 0x27fc,
+    0x27f8, 0x27f8, 0x27f8, 0x27f8, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27bf, 0x27be, 0x27bc, 0x27bc, 0x27b8, 0x27b8, 0x27b8, 0x27b8,
+    0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27a0, 0x27a0, 0x27a0, 0x27a0,
+    0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0,
+    0x273f, 0x273e, 0x273c, 0x273c, 0x2738, 0x2738, 0x2738, 0x2738, 0x2730, 0x2730, 0x2730, 0x2730,
+    0x2730, 0x2730, 0x2730, 0x2730, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720,
+    0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x273f, 0x273e, 0x273c, 0x273c,
+    0x2738, 0x2738, 0x2738, 0x2738, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730,
+    0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720,
+    0x2720, 0x2720, 0x2720, 0x2720, 0x23ff, 0x23fe, 0x23fc, 0x23fc, 0x23f8, 0x23f8, 0x23f8, 0x23f8,
+    0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23f0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0, 0x23e0,
+    0x23bf, 0x23be, 0x23bc, 0x23bc, 0x23b8, 0x23b8, 0x23b8, 0x23b8, 0x23b0, 0x23b0, 0x23b0, 0x23b0,
+    0x23b0, 0x23b0, 0x23b0, 0x23b0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0,
+    0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x23a0, 0x233f, 0x233e, 0x233c, 0x233c,
+    0x2338, 0x2338, 0x2338, 0x2338, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330,
+    0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320,
+    0x2320, 0x2320, 0x2320, 0x2320, 0x233f, 0x233e, 0x233c, 0x233c, 0x2338, 0x2338, 0x2338, 0x2338,
+    0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2330, 0x2320, 0x2320, 0x2320, 0x2320,
+    0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320, 0x2320,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fbf, 0x3fbe, 0x3fbc, 0x3fbc,
+    0x3fb8, 0x3fb8, 0x3fb8, 0x3fb8, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0,
+    0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0,
+    0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3f3f, 0x3f3e, 0x3f3c, 0x3f3c, 0x3f38, 0x3f38, 0x3f38, 0x3f38,
+    0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f3f, 0x3f3e, 0x3f3c, 0x3f3c, 0x3f38, 0x3f38, 0x3f38, 0x3f38, 0x3f30, 0x3f30, 0x3f30, 0x3f30,
+    0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c,
+    0x3e38, 0x3e38, 0x3e38, 0x3e38, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c, 0x3e38, 0x3e38, 0x3e38, 0x3e38,
+    0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c, 0x3e38, 0x3e38, 0x3e38, 0x3e38, 0x3e30, 0x3e30, 0x3e30, 0x3e30,
+    0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c,
+    0x3e38, 0x3e38, 0x3e38, 0x3e38, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x27ff, 0x27fe, 0x27fc, 0x27fc, 0x27f8, 0x27f8, 0x27f8, 0x27f8,
+    0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27bf, 0x27be, 0x27bc, 0x27bc, 0x27b8, 0x27b8, 0x27b8, 0x27b8, 0x27b0, 0x27b0, 0x27b0, 0x27b0,
+    0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0,
+    0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x273f, 0x273e, 0x273c, 0x273c,
+    0x2738, 0x2738, 0x2738, 0x2738, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730,
+    0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720,
+    0x2720, 0x2720, 0x2720, 0x2720, 0x273f, 0x273e, 0x273c, 0x273c, 0x2738, 0x2738, 0x2738, 0x2738,
+    0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2720, 0x2720, 0x2720, 0x2720,
+    0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720,
+    0x263f, 0x263e, 0x263c, 0x263c, 0x2638, 0x2638, 0x2638, 0x2638, 0x2630, 0x2630, 0x2630, 0x2630,
+    0x2630, 0x2630, 0x2630, 0x2630, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620,
+    0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x263f, 0x263e, 0x263c, 0x263c,
+    0x2638, 0x2638, 0x2638, 0x2638, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630,
+    0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620,
+    0x2620, 0x2620, 0x2620, 0x2620, 0x263f, 0x263e, 0x263c, 0x263c, 0x2638, 0x2638, 0x2638, 0x2638,
+    0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2620, 0x2620, 0x2620, 0x2620,
+    0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620,
+    0x263f, 0x263e, 0x263c, 0x263c, 0x2638, 0x2638, 0x2638, 0x2638, 0x2630, 0x2630, 0x2630, 0x2630,
+    0x2630, 0x2630, 0x2630, 0x2630, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620,
+    0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2fff, 0x2ffe, 0x2ffc, 0x2ffc,
+    0x2ff8, 0x2ff8, 0x2ff8, 0x2ff8, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0,
+    0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0,
+    0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fbf, 0x2fbe, 0x2fbc, 0x2fbc, 0x2fb8, 0x2fb8, 0x2fb8, 0x2fb8,
+    0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0,
+    0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0,
+    0x2f3f, 0x2f3e, 0x2f3c, 0x2f3c, 0x2f38, 0x2f38, 0x2f38, 0x2f38, 0x2f30, 0x2f30, 0x2f30, 0x2f30,
+    0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20,
+    0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f3f, 0x2f3e, 0x2f3c, 0x2f3c,
+    0x2f38, 0x2f38, 0x2f38, 0x2f38, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30,
+    0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20,
+    0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2e3f, 0x2e3e, 0x2e3c, 0x2e3c, 0x2e38, 0x2e38, 0x2e38, 0x2e38,
+    0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e20, 0x2e20, 0x2e20, 0x2e20,
+    0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20,
+    0x2e3f, 0x2e3e, 0x2e3c, 0x2e3c, 0x2e38, 0x2e38, 0x2e38, 0x2e38, 0x2e30, 0x2e30, 0x2e30, 0x2e30,
+    0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20,
+    0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e3f, 0x2e3e, 0x2e3c, 0x2e3c,
+    0x2e38, 0x2e38, 0x2e38, 0x2e38, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30,
+    0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20,
+    0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e3f, 0x2e3e, 0x2e3c, 0x2e3c, 0x2e38, 0x2e38, 0x2e38, 0x2e38,
+    0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e20, 0x2e20, 0x2e20, 0x2e20,
+    0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20,
+    0x27ff, 0x27fe, 0x27fc, 0x27fc, 0x27f8, 0x27f8, 0x27f8, 0x27f8, 0x27f0, 0x27f0, 0x27f0, 0x27f0,
+    0x27f0, 0x27f0, 0x27f0, 0x27f0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0,
+    0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27e0, 0x27bf, 0x27be, 0x27bc, 0x27bc,
+    0x27b8, 0x27b8, 0x27b8, 0x27b8, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0, 0x27b0,
+    0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x27a0,
+    0x27a0, 0x27a0, 0x27a0, 0x27a0, 0x273f, 0x273e, 0x273c, 0x273c, 0x2738, 0x2738, 0x2738, 0x2738,
+    0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2730, 0x2720, 0x2720, 0x2720, 0x2720,
+    0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720,
+    0x273f, 0x273e, 0x273c, 0x273c, 0x2738, 0x2738, 0x2738, 0x2738, 0x2730, 0x2730, 0x2730, 0x2730,
+    0x2730, 0x2730, 0x2730, 0x2730, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720,
+    0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x2720, 0x263f, 0x263e, 0x263c, 0x263c,
+    0x2638, 0x2638, 0x2638, 0x2638, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630,
+    0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620,
+    0x2620, 0x2620, 0x2620, 0x2620, 0x263f, 0x263e, 0x263c, 0x263c, 0x2638, 0x2638, 0x2638, 0x2638,
+    0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2620, 0x2620, 0x2620, 0x2620,
+    0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620,
+    0x263f, 0x263e, 0x263c, 0x263c, 0x2638, 0x2638, 0x2638, 0x2638, 0x2630, 0x2630, 0x2630, 0x2630,
+    0x2630, 0x2630, 0x2630, 0x2630, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620,
+    0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x263f, 0x263e, 0x263c, 0x263c,
+    0x2638, 0x2638, 0x2638, 0x2638, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630, 0x2630,
+    0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620, 0x2620,
+    0x2620, 0x2620, 0x2620, 0x2620, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fbf, 0x3fbe, 0x3fbc, 0x3fbc, 0x3fb8, 0x3fb8, 0x3fb8, 0x3fb8, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0,
+    0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0,
+    0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3f3f, 0x3f3e, 0x3f3c, 0x3f3c,
+    0x3f38, 0x3f38, 0x3f38, 0x3f38, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f3f, 0x3f3e, 0x3f3c, 0x3f3c, 0x3f38, 0x3f38, 0x3f38, 0x3f38,
+    0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c, 0x3e38, 0x3e38, 0x3e38, 0x3e38, 0x3e30, 0x3e30, 0x3e30, 0x3e30,
+    0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c,
+    0x3e38, 0x3e38, 0x3e38, 0x3e38, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c, 0x3e38, 0x3e38, 0x3e38, 0x3e38,
+    0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c, 0x3e38, 0x3e38, 0x3e38, 0x3e38, 0x3e30, 0x3e30, 0x3e30, 0x3e30,
+    0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x2fff, 0x2ffe, 0x2ffc, 0x2ffc, 0x2ff8, 0x2ff8, 0x2ff8, 0x2ff8, 0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0,
+    0x2ff0, 0x2ff0, 0x2ff0, 0x2ff0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0,
+    0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fe0, 0x2fbf, 0x2fbe, 0x2fbc, 0x2fbc,
+    0x2fb8, 0x2fb8, 0x2fb8, 0x2fb8, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0, 0x2fb0,
+    0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0,
+    0x2fa0, 0x2fa0, 0x2fa0, 0x2fa0, 0x2f3f, 0x2f3e, 0x2f3c, 0x2f3c, 0x2f38, 0x2f38, 0x2f38, 0x2f38,
+    0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f20, 0x2f20, 0x2f20, 0x2f20,
+    0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20,
+    0x2f3f, 0x2f3e, 0x2f3c, 0x2f3c, 0x2f38, 0x2f38, 0x2f38, 0x2f38, 0x2f30, 0x2f30, 0x2f30, 0x2f30,
+    0x2f30, 0x2f30, 0x2f30, 0x2f30, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20,
+    0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2f20, 0x2e3f, 0x2e3e, 0x2e3c, 0x2e3c,
+    0x2e38, 0x2e38, 0x2e38, 0x2e38, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30,
+    0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20,
+    0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e3f, 0x2e3e, 0x2e3c, 0x2e3c, 0x2e38, 0x2e38, 0x2e38, 0x2e38,
+    0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e20, 0x2e20, 0x2e20, 0x2e20,
+    0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20,
+    0x2e3f, 0x2e3e, 0x2e3c, 0x2e3c, 0x2e38, 0x2e38, 0x2e38, 0x2e38, 0x2e30, 0x2e30, 0x2e30, 0x2e30,
+    0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20,
+    0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e3f, 0x2e3e, 0x2e3c, 0x2e3c,
+    0x2e38, 0x2e38, 0x2e38, 0x2e38, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30, 0x2e30,
+    0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2e20,
+    0x2e20, 0x2e20, 0x2e20, 0x2e20, 0x2c3f, 0x2c3e, 0x2c3c, 0x2c3c, 0x2c38, 0x2c38, 0x2c38, 0x2c38,
+    0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c20, 0x2c20, 0x2c20, 0x2c20,
+    0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20,
+    0x2c3f, 0x2c3e, 0x2c3c, 0x2c3c, 0x2c38, 0x2c38, 0x2c38, 0x2c38, 0x2c30, 0x2c30, 0x2c30, 0x2c30,
+    0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20,
+    0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c3f, 0x2c3e, 0x2c3c, 0x2c3c,
+    0x2c38, 0x2c38, 0x2c38, 0x2c38, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30,
+    0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20,
+    0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c3f, 0x2c3e, 0x2c3c, 0x2c3c, 0x2c38, 0x2c38, 0x2c38, 0x2c38,
+    0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c20, 0x2c20, 0x2c20, 0x2c20,
+    0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20,
+    0x2c3f, 0x2c3e, 0x2c3c, 0x2c3c, 0x2c38, 0x2c38, 0x2c38, 0x2c38, 0x2c30, 0x2c30, 0x2c30, 0x2c30,
+    0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20,
+    0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c3f, 0x2c3e, 0x2c3c, 0x2c3c,
+    0x2c38, 0x2c38, 0x2c38, 0x2c38, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30,
+    0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20,
+    0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c3f, 0x2c3e, 0x2c3c, 0x2c3c, 0x2c38, 0x2c38, 0x2c38, 0x2c38,
+    0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c20, 0x2c20, 0x2c20, 0x2c20,
+    0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20,
+    0x2c3f, 0x2c3e, 0x2c3c, 0x2c3c, 0x2c38, 0x2c38, 0x2c38, 0x2c38, 0x2c30, 0x2c30, 0x2c30, 0x2c30,
+    0x2c30, 0x2c30, 0x2c30, 0x2c30, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20,
+    0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x2c20, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fbf, 0x3fbe, 0x3fbc, 0x3fbc, 0x3fb8, 0x3fb8, 0x3fb8, 0x3fb8,
+    0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0,
+    0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0,
+    0x3f3f, 0x3f3e, 0x3f3c, 0x3f3c, 0x3f38, 0x3f38, 0x3f38, 0x3f38, 0x3f30, 0x3f30, 0x3f30, 0x3f30,
+    0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f3f, 0x3f3e, 0x3f3c, 0x3f3c,
+    0x3f38, 0x3f38, 0x3f38, 0x3f38, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c, 0x3e38, 0x3e38, 0x3e38, 0x3e38,
+    0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c, 0x3e38, 0x3e38, 0x3e38, 0x3e38, 0x3e30, 0x3e30, 0x3e30, 0x3e30,
+    0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c,
+    0x3e38, 0x3e38, 0x3e38, 0x3e38, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c, 0x3e38, 0x3e38, 0x3e38, 0x3e38,
+    0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fbf, 0x3fbe, 0x3fbc, 0x3fbc,
+    0x3fb8, 0x3fb8, 0x3fb8, 0x3fb8, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0, 0x3fb0,
+    0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0,
+    0x3fa0, 0x3fa0, 0x3fa0, 0x3fa0, 0x3f3f, 0x3f3e, 0x3f3c, 0x3f3c, 0x3f38, 0x3f38, 0x3f38, 0x3f38,
+    0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f3f, 0x3f3e, 0x3f3c, 0x3f3c, 0x3f38, 0x3f38, 0x3f38, 0x3f38, 0x3f30, 0x3f30, 0x3f30, 0x3f30,
+    0x3f30, 0x3f30, 0x3f30, 0x3f30, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20,
+    0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3f20, 0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c,
+    0x3e38, 0x3e38, 0x3e38, 0x3e38, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c, 0x3e38, 0x3e38, 0x3e38, 0x3e38,
+    0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c, 0x3e38, 0x3e38, 0x3e38, 0x3e38, 0x3e30, 0x3e30, 0x3e30, 0x3e30,
+    0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e3f, 0x3e3e, 0x3e3c, 0x3e3c,
+    0x3e38, 0x3e38, 0x3e38, 0x3e38, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30, 0x3e30,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3e20,
+    0x3e20, 0x3e20, 0x3e20, 0x3e20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c,
+    0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c3f, 0x3c3e, 0x3c3c, 0x3c3c, 0x3c38, 0x3c38, 0x3c38, 0x3c38, 0x3c30, 0x3c30, 0x3c30, 0x3c30,
+    0x3c30, 0x3c30, 0x3c30, 0x3c30, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20,
+    0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x3c20, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x383f, 0x383e, 0x383c, 0x383c, 0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3830, 0x3830, 0x3830, 0x3830, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x383f, 0x383e, 0x383c, 0x383c,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830, 0x3830,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820, 0x3820,
+    0x3820, 0x3820, 0x3820, 0x3820, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c,
+    0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x303f, 0x303e, 0x303c, 0x303c, 0x3038, 0x3038, 0x3038, 0x3038, 0x3030, 0x3030, 0x3030, 0x3030,
+    0x3030, 0x3030, 0x3030, 0x3030, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020,
+    0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3020, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x00ff, 0x00fe, 0x00fc, 0x00fc, 0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x00ff, 0x00fe, 0x00fc, 0x00fc,
+    0x00f8, 0x00f8, 0x00f8, 0x00f8, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0, 0x00f0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+    0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc,
+    0x01f8, 0x01f8, 0x01f8, 0x01f8, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x01ff, 0x01fe, 0x01fc, 0x01fc, 0x01f8, 0x01f8, 0x01f8, 0x01f8,
+    0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01f0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0, 0x01e0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+    0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3f7f, 0x3f7e, 0x3f7c, 0x3f7c, 0x3f78, 0x3f78, 0x3f78, 0x3f78, 0x3f70, 0x3f70, 0x3f70, 0x3f70,
+    0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60,
+    0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x037f, 0x037e, 0x037c, 0x037c,
+    0x0378, 0x0378, 0x0378, 0x0378, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x077f, 0x077e, 0x077c, 0x077c, 0x0778, 0x0778, 0x0778, 0x0778,
+    0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0760, 0x0760, 0x0760, 0x0760,
+    0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x037f, 0x037e, 0x037c, 0x037c, 0x0378, 0x0378, 0x0378, 0x0378, 0x0370, 0x0370, 0x0370, 0x0370,
+    0x0370, 0x0370, 0x0370, 0x0370, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8,
+    0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0f7f, 0x0f7e, 0x0f7c, 0x0f7c,
+    0x0f78, 0x0f78, 0x0f78, 0x0f78, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70,
+    0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60,
+    0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x037f, 0x037e, 0x037c, 0x037c, 0x0378, 0x0378, 0x0378, 0x0378,
+    0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x077f, 0x077e, 0x077c, 0x077c, 0x0778, 0x0778, 0x0778, 0x0778, 0x0770, 0x0770, 0x0770, 0x0770,
+    0x0770, 0x0770, 0x0770, 0x0770, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760,
+    0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x037f, 0x037e, 0x037c, 0x037c,
+    0x0378, 0x0378, 0x0378, 0x0378, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1f7f, 0x1f7e, 0x1f7c, 0x1f7c, 0x1f78, 0x1f78, 0x1f78, 0x1f78,
+    0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f60, 0x1f60, 0x1f60, 0x1f60,
+    0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60,
+    0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40,
+    0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40,
+    0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x037f, 0x037e, 0x037c, 0x037c, 0x0378, 0x0378, 0x0378, 0x0378, 0x0370, 0x0370, 0x0370, 0x0370,
+    0x0370, 0x0370, 0x0370, 0x0370, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x077f, 0x077e, 0x077c, 0x077c,
+    0x0778, 0x0778, 0x0778, 0x0778, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770,
+    0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760,
+    0x0760, 0x0760, 0x0760, 0x0760, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x037f, 0x037e, 0x037c, 0x037c, 0x0378, 0x0378, 0x0378, 0x0378,
+    0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0f7f, 0x0f7e, 0x0f7c, 0x0f7c, 0x0f78, 0x0f78, 0x0f78, 0x0f78, 0x0f70, 0x0f70, 0x0f70, 0x0f70,
+    0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60,
+    0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x03ff, 0x03fe, 0x03fc, 0x03fc, 0x03f8, 0x03f8, 0x03f8, 0x03f8,
+    0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x037f, 0x037e, 0x037c, 0x037c,
+    0x0378, 0x0378, 0x0378, 0x0378, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370, 0x0370,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x077f, 0x077e, 0x077c, 0x077c, 0x0778, 0x0778, 0x0778, 0x0778,
+    0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0760, 0x0760, 0x0760, 0x0760,
+    0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x03ff, 0x03fe, 0x03fc, 0x03fc,
+    0x03f8, 0x03f8, 0x03f8, 0x03f8, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0, 0x03f0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03e0,
+    0x03e0, 0x03e0, 0x03e0, 0x03e0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0,
+    0x037f, 0x037e, 0x037c, 0x037c, 0x0378, 0x0378, 0x0378, 0x0378, 0x0370, 0x0370, 0x0370, 0x0370,
+    0x0370, 0x0370, 0x0370, 0x0370, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360,
+    0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0360, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3f7f, 0x3f7e, 0x3f7c, 0x3f7c,
+    0x3f78, 0x3f78, 0x3f78, 0x3f78, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70,
+    0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60,
+    0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3e7f, 0x3e7e, 0x3e7c, 0x3e7c, 0x3e78, 0x3e78, 0x3e78, 0x3e78, 0x3e70, 0x3e70, 0x3e70, 0x3e70,
+    0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e7f, 0x3e7e, 0x3e7c, 0x3e7c, 0x3e78, 0x3e78, 0x3e78, 0x3e78,
+    0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x077f, 0x077e, 0x077c, 0x077c, 0x0778, 0x0778, 0x0778, 0x0778, 0x0770, 0x0770, 0x0770, 0x0770,
+    0x0770, 0x0770, 0x0770, 0x0770, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760,
+    0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x067f, 0x067e, 0x067c, 0x067c, 0x0678, 0x0678, 0x0678, 0x0678,
+    0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0660, 0x0660, 0x0660, 0x0660,
+    0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x067f, 0x067e, 0x067c, 0x067c,
+    0x0678, 0x0678, 0x0678, 0x0678, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670,
+    0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660,
+    0x0660, 0x0660, 0x0660, 0x0660, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0f7f, 0x0f7e, 0x0f7c, 0x0f7c, 0x0f78, 0x0f78, 0x0f78, 0x0f78,
+    0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f60, 0x0f60, 0x0f60, 0x0f60,
+    0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0e7f, 0x0e7e, 0x0e7c, 0x0e7c,
+    0x0e78, 0x0e78, 0x0e78, 0x0e78, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70,
+    0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60,
+    0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e7f, 0x0e7e, 0x0e7c, 0x0e7c, 0x0e78, 0x0e78, 0x0e78, 0x0e78, 0x0e70, 0x0e70, 0x0e70, 0x0e70,
+    0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60,
+    0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x077f, 0x077e, 0x077c, 0x077c,
+    0x0778, 0x0778, 0x0778, 0x0778, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770,
+    0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760,
+    0x0760, 0x0760, 0x0760, 0x0760, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x067f, 0x067e, 0x067c, 0x067c, 0x0678, 0x0678, 0x0678, 0x0678, 0x0670, 0x0670, 0x0670, 0x0670,
+    0x0670, 0x0670, 0x0670, 0x0670, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660,
+    0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x067f, 0x067e, 0x067c, 0x067c, 0x0678, 0x0678, 0x0678, 0x0678,
+    0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0660, 0x0660, 0x0660, 0x0660,
+    0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc,
+    0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0,
+    0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1f7f, 0x1f7e, 0x1f7c, 0x1f7c, 0x1f78, 0x1f78, 0x1f78, 0x1f78, 0x1f70, 0x1f70, 0x1f70, 0x1f70,
+    0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60,
+    0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f40, 0x1f40, 0x1f40, 0x1f40,
+    0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40,
+    0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40,
+    0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1e7f, 0x1e7e, 0x1e7c, 0x1e7c, 0x1e78, 0x1e78, 0x1e78, 0x1e78,
+    0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e60, 0x1e60, 0x1e60, 0x1e60,
+    0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e7f, 0x1e7e, 0x1e7c, 0x1e7c,
+    0x1e78, 0x1e78, 0x1e78, 0x1e78, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70,
+    0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60,
+    0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x07ff, 0x07fe, 0x07fc, 0x07fc, 0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x077f, 0x077e, 0x077c, 0x077c, 0x0778, 0x0778, 0x0778, 0x0778,
+    0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0770, 0x0760, 0x0760, 0x0760, 0x0760,
+    0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x067f, 0x067e, 0x067c, 0x067c,
+    0x0678, 0x0678, 0x0678, 0x0678, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670,
+    0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660,
+    0x0660, 0x0660, 0x0660, 0x0660, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x067f, 0x067e, 0x067c, 0x067c, 0x0678, 0x0678, 0x0678, 0x0678, 0x0670, 0x0670, 0x0670, 0x0670,
+    0x0670, 0x0670, 0x0670, 0x0670, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660,
+    0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8,
+    0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0f7f, 0x0f7e, 0x0f7c, 0x0f7c,
+    0x0f78, 0x0f78, 0x0f78, 0x0f78, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70,
+    0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60,
+    0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0e7f, 0x0e7e, 0x0e7c, 0x0e7c, 0x0e78, 0x0e78, 0x0e78, 0x0e78, 0x0e70, 0x0e70, 0x0e70, 0x0e70,
+    0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60,
+    0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e7f, 0x0e7e, 0x0e7c, 0x0e7c, 0x0e78, 0x0e78, 0x0e78, 0x0e78,
+    0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e60, 0x0e60, 0x0e60, 0x0e60,
+    0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x07ff, 0x07fe, 0x07fc, 0x07fc,
+    0x07f8, 0x07f8, 0x07f8, 0x07f8, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0, 0x07f0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
+    0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
+    0x077f, 0x077e, 0x077c, 0x077c, 0x0778, 0x0778, 0x0778, 0x0778, 0x0770, 0x0770, 0x0770, 0x0770,
+    0x0770, 0x0770, 0x0770, 0x0770, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760,
+    0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0760, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740, 0x0740,
+    0x0740, 0x0740, 0x0740, 0x0740, 0x067f, 0x067e, 0x067c, 0x067c, 0x0678, 0x0678, 0x0678, 0x0678,
+    0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0660, 0x0660, 0x0660, 0x0660,
+    0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x067f, 0x067e, 0x067c, 0x067c,
+    0x0678, 0x0678, 0x0678, 0x0678, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670, 0x0670,
+    0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660, 0x0660,
+    0x0660, 0x0660, 0x0660, 0x0660, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640, 0x0640,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3f7f, 0x3f7e, 0x3f7c, 0x3f7c, 0x3f78, 0x3f78, 0x3f78, 0x3f78,
+    0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f60, 0x3f60, 0x3f60, 0x3f60,
+    0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3e7f, 0x3e7e, 0x3e7c, 0x3e7c,
+    0x3e78, 0x3e78, 0x3e78, 0x3e78, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e7f, 0x3e7e, 0x3e7c, 0x3e7c, 0x3e78, 0x3e78, 0x3e78, 0x3e78, 0x3e70, 0x3e70, 0x3e70, 0x3e70,
+    0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c78, 0x3c78, 0x3c78, 0x3c78,
+    0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c,
+    0x3c78, 0x3c78, 0x3c78, 0x3c78, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c78, 0x3c78, 0x3c78, 0x3c78, 0x3c70, 0x3c70, 0x3c70, 0x3c70,
+    0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c78, 0x3c78, 0x3c78, 0x3c78,
+    0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x0fff, 0x0ffe, 0x0ffc, 0x0ffc,
+    0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0f7f, 0x0f7e, 0x0f7c, 0x0f7c, 0x0f78, 0x0f78, 0x0f78, 0x0f78, 0x0f70, 0x0f70, 0x0f70, 0x0f70,
+    0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60,
+    0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0e7f, 0x0e7e, 0x0e7c, 0x0e7c, 0x0e78, 0x0e78, 0x0e78, 0x0e78,
+    0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e60, 0x0e60, 0x0e60, 0x0e60,
+    0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e7f, 0x0e7e, 0x0e7c, 0x0e7c,
+    0x0e78, 0x0e78, 0x0e78, 0x0e78, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70,
+    0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60,
+    0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c78, 0x0c78, 0x0c78, 0x0c78, 0x0c70, 0x0c70, 0x0c70, 0x0c70,
+    0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60,
+    0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c78, 0x0c78, 0x0c78, 0x0c78,
+    0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c60, 0x0c60, 0x0c60, 0x0c60,
+    0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c78, 0x0c78, 0x0c78, 0x0c78, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70,
+    0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60,
+    0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c78, 0x0c78, 0x0c78, 0x0c78, 0x0c70, 0x0c70, 0x0c70, 0x0c70,
+    0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60,
+    0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1f7f, 0x1f7e, 0x1f7c, 0x1f7c,
+    0x1f78, 0x1f78, 0x1f78, 0x1f78, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70,
+    0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60,
+    0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40,
+    0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40,
+    0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40,
+    0x1e7f, 0x1e7e, 0x1e7c, 0x1e7c, 0x1e78, 0x1e78, 0x1e78, 0x1e78, 0x1e70, 0x1e70, 0x1e70, 0x1e70,
+    0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60,
+    0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e7f, 0x1e7e, 0x1e7c, 0x1e7c, 0x1e78, 0x1e78, 0x1e78, 0x1e78,
+    0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e60, 0x1e60, 0x1e60, 0x1e60,
+    0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c,
+    0x1c78, 0x1c78, 0x1c78, 0x1c78, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70,
+    0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60,
+    0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c78, 0x1c78, 0x1c78, 0x1c78, 0x1c70, 0x1c70, 0x1c70, 0x1c70,
+    0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60,
+    0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c78, 0x1c78, 0x1c78, 0x1c78,
+    0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c60, 0x1c60, 0x1c60, 0x1c60,
+    0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c,
+    0x1c78, 0x1c78, 0x1c78, 0x1c78, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70,
+    0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60,
+    0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x0fff, 0x0ffe, 0x0ffc, 0x0ffc, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff8, 0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0,
+    0x0ff0, 0x0ff0, 0x0ff0, 0x0ff0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0,
+    0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fe0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0,
+    0x0fc0, 0x0fc0, 0x0fc0, 0x0fc0, 0x0f7f, 0x0f7e, 0x0f7c, 0x0f7c, 0x0f78, 0x0f78, 0x0f78, 0x0f78,
+    0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f70, 0x0f60, 0x0f60, 0x0f60, 0x0f60,
+    0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60, 0x0f60,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40,
+    0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0f40, 0x0e7f, 0x0e7e, 0x0e7c, 0x0e7c,
+    0x0e78, 0x0e78, 0x0e78, 0x0e78, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e70,
+    0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60,
+    0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e7f, 0x0e7e, 0x0e7c, 0x0e7c, 0x0e78, 0x0e78, 0x0e78, 0x0e78, 0x0e70, 0x0e70, 0x0e70, 0x0e70,
+    0x0e70, 0x0e70, 0x0e70, 0x0e70, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60,
+    0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e60, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0e40,
+    0x0e40, 0x0e40, 0x0e40, 0x0e40, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c78, 0x0c78, 0x0c78, 0x0c78,
+    0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c60, 0x0c60, 0x0c60, 0x0c60,
+    0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c,
+    0x0c78, 0x0c78, 0x0c78, 0x0c78, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70,
+    0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60,
+    0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c78, 0x0c78, 0x0c78, 0x0c78, 0x0c70, 0x0c70, 0x0c70, 0x0c70,
+    0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60,
+    0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c7f, 0x0c7e, 0x0c7c, 0x0c7c, 0x0c78, 0x0c78, 0x0c78, 0x0c78,
+    0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c70, 0x0c60, 0x0c60, 0x0c60, 0x0c60,
+    0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60, 0x0c60,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40,
+    0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x0c40, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc,
+    0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3f7f, 0x3f7e, 0x3f7c, 0x3f7c, 0x3f78, 0x3f78, 0x3f78, 0x3f78, 0x3f70, 0x3f70, 0x3f70, 0x3f70,
+    0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60,
+    0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3e7f, 0x3e7e, 0x3e7c, 0x3e7c, 0x3e78, 0x3e78, 0x3e78, 0x3e78,
+    0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e7f, 0x3e7e, 0x3e7c, 0x3e7c,
+    0x3e78, 0x3e78, 0x3e78, 0x3e78, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c78, 0x3c78, 0x3c78, 0x3c78, 0x3c70, 0x3c70, 0x3c70, 0x3c70,
+    0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c78, 0x3c78, 0x3c78, 0x3c78,
+    0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c,
+    0x3c78, 0x3c78, 0x3c78, 0x3c78, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c78, 0x3c78, 0x3c78, 0x3c78, 0x3c70, 0x3c70, 0x3c70, 0x3c70,
+    0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x1fff, 0x1ffe, 0x1ffc, 0x1ffc, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff8, 0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0,
+    0x1ff0, 0x1ff0, 0x1ff0, 0x1ff0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0,
+    0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fe0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0,
+    0x1fc0, 0x1fc0, 0x1fc0, 0x1fc0, 0x1f7f, 0x1f7e, 0x1f7c, 0x1f7c, 0x1f78, 0x1f78, 0x1f78, 0x1f78,
+    0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f70, 0x1f60, 0x1f60, 0x1f60, 0x1f60,
+    0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60, 0x1f60,
+    0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40,
+    0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40,
+    0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1f40, 0x1e7f, 0x1e7e, 0x1e7c, 0x1e7c,
+    0x1e78, 0x1e78, 0x1e78, 0x1e78, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e70,
+    0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60,
+    0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e7f, 0x1e7e, 0x1e7c, 0x1e7c, 0x1e78, 0x1e78, 0x1e78, 0x1e78, 0x1e70, 0x1e70, 0x1e70, 0x1e70,
+    0x1e70, 0x1e70, 0x1e70, 0x1e70, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60,
+    0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e60, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1e40,
+    0x1e40, 0x1e40, 0x1e40, 0x1e40, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c78, 0x1c78, 0x1c78, 0x1c78,
+    0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c60, 0x1c60, 0x1c60, 0x1c60,
+    0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c,
+    0x1c78, 0x1c78, 0x1c78, 0x1c78, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70,
+    0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60,
+    0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c78, 0x1c78, 0x1c78, 0x1c78, 0x1c70, 0x1c70, 0x1c70, 0x1c70,
+    0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60,
+    0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c7f, 0x1c7e, 0x1c7c, 0x1c7c, 0x1c78, 0x1c78, 0x1c78, 0x1c78,
+    0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c70, 0x1c60, 0x1c60, 0x1c60, 0x1c60,
+    0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40,
+    0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x1c40, 0x187f, 0x187e, 0x187c, 0x187c,
+    0x1878, 0x1878, 0x1878, 0x1878, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870,
+    0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860,
+    0x1860, 0x1860, 0x1860, 0x1860, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878, 0x1870, 0x1870, 0x1870, 0x1870,
+    0x1870, 0x1870, 0x1870, 0x1870, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860,
+    0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878,
+    0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1860, 0x1860, 0x1860, 0x1860,
+    0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x187f, 0x187e, 0x187c, 0x187c,
+    0x1878, 0x1878, 0x1878, 0x1878, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870,
+    0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860,
+    0x1860, 0x1860, 0x1860, 0x1860, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878, 0x1870, 0x1870, 0x1870, 0x1870,
+    0x1870, 0x1870, 0x1870, 0x1870, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860,
+    0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878,
+    0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1860, 0x1860, 0x1860, 0x1860,
+    0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x187f, 0x187e, 0x187c, 0x187c,
+    0x1878, 0x1878, 0x1878, 0x1878, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870, 0x1870,
+    0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860,
+    0x1860, 0x1860, 0x1860, 0x1860, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x187f, 0x187e, 0x187c, 0x187c, 0x1878, 0x1878, 0x1878, 0x1878, 0x1870, 0x1870, 0x1870, 0x1870,
+    0x1870, 0x1870, 0x1870, 0x1870, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860,
+    0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840, 0x1840,
+    0x1840, 0x1840, 0x1840, 0x1840, 0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3f7f, 0x3f7e, 0x3f7c, 0x3f7c,
+    0x3f78, 0x3f78, 0x3f78, 0x3f78, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70,
+    0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60,
+    0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3e7f, 0x3e7e, 0x3e7c, 0x3e7c, 0x3e78, 0x3e78, 0x3e78, 0x3e78, 0x3e70, 0x3e70, 0x3e70, 0x3e70,
+    0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e7f, 0x3e7e, 0x3e7c, 0x3e7c, 0x3e78, 0x3e78, 0x3e78, 0x3e78,
+    0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c,
+    0x3c78, 0x3c78, 0x3c78, 0x3c78, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c78, 0x3c78, 0x3c78, 0x3c78, 0x3c70, 0x3c70, 0x3c70, 0x3c70,
+    0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c78, 0x3c78, 0x3c78, 0x3c78,
+    0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c,
+    0x3c78, 0x3c78, 0x3c78, 0x3c78, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3fff, 0x3ffe, 0x3ffc, 0x3ffc, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff8, 0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0,
+    0x3ff0, 0x3ff0, 0x3ff0, 0x3ff0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0,
+    0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fe0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0,
+    0x3fc0, 0x3fc0, 0x3fc0, 0x3fc0, 0x3f7f, 0x3f7e, 0x3f7c, 0x3f7c, 0x3f78, 0x3f78, 0x3f78, 0x3f78,
+    0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f70, 0x3f60, 0x3f60, 0x3f60, 0x3f60,
+    0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60, 0x3f60,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40,
+    0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3f40, 0x3e7f, 0x3e7e, 0x3e7c, 0x3e7c,
+    0x3e78, 0x3e78, 0x3e78, 0x3e78, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e70,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e7f, 0x3e7e, 0x3e7c, 0x3e7c, 0x3e78, 0x3e78, 0x3e78, 0x3e78, 0x3e70, 0x3e70, 0x3e70, 0x3e70,
+    0x3e70, 0x3e70, 0x3e70, 0x3e70, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60,
+    0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e60, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3e40,
+    0x3e40, 0x3e40, 0x3e40, 0x3e40, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c78, 0x3c78, 0x3c78, 0x3c78,
+    0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c,
+    0x3c78, 0x3c78, 0x3c78, 0x3c78, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c78, 0x3c78, 0x3c78, 0x3c78, 0x3c70, 0x3c70, 0x3c70, 0x3c70,
+    0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c7f, 0x3c7e, 0x3c7c, 0x3c7c, 0x3c78, 0x3c78, 0x3c78, 0x3c78,
+    0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c70, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60, 0x3c60,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40,
+    0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x3c40, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x387f, 0x387e, 0x387c, 0x387c,
+    0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x387f, 0x387e, 0x387c, 0x387c, 0x3878, 0x3878, 0x3878, 0x3878, 0x3870, 0x3870, 0x3870, 0x3870,
+    0x3870, 0x3870, 0x3870, 0x3870, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860,
+    0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3860, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840, 0x3840,
+    0x3840, 0x3840, 0x3840, 0x3840, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c,
+    0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078, 0x3070, 0x3070, 0x3070, 0x3070,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x307f, 0x307e, 0x307c, 0x307c, 0x3078, 0x3078, 0x3078, 0x3078,
+    0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3070, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060, 0x3060,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040,
+    0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x3040, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x207f, 0x207e, 0x207c, 0x207c,
+    0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x207f, 0x207e, 0x207c, 0x207c, 0x2078, 0x2078, 0x2078, 0x2078, 0x2070, 0x2070, 0x2070, 0x2070,
+    0x2070, 0x2070, 0x2070, 0x2070, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060,
+    0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2060, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040,
+};
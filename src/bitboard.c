@@ -18,6 +18,7 @@
 
 #include "bitboard.h"
 #include "board.h"
+#include "startup.h"
 
 
 const Bitboard FileBB[FILE_NB] = {
@@ -29,12 +30,54 @@ const Bitboard RankBB[RANK_NB] = {
 };
 
 Bitboard BetweenBB[64][64];
+Bitboard LineBB[64][64];
 
+// Only built when the magic lookup is used, the pext tables are embedded
 static Bitboard BishopAttacks[5248];
 static Bitboard RookAttacks[102400];
 
+static Bitboard Rays[2][4][64];
+
 Magic Magics[64][2];
 
+static const uint64_t RookMagics[64] = {
+    0xA180022080400230ull, 0x0040100040022000ull, 0x0080088020001002ull, 0x0080080280841000ull,
+    0x4200042010460008ull, 0x04800A0003040080ull, 0x0400110082041008ull, 0x008000A041000880ull,
+    0x10138001A080C010ull, 0x0000804008200480ull, 0x00010011012000C0ull, 0x0022004128102200ull,
+    0x000200081201200Cull, 0x202A001048460004ull, 0x0081000100420004ull, 0x4000800380004500ull,
+    0x0000208002904001ull, 0x0090004040026008ull, 0x0208808010002001ull, 0x2002020020704940ull,
+    0x8048010008110005ull, 0x6820808004002200ull, 0x0A80040008023011ull, 0x00B1460000811044ull,
+    0x4204400080008EA0ull, 0xB002400180200184ull, 0x2020200080100380ull, 0x0010080080100080ull,
+    0x2204080080800400ull, 0x0000A40080360080ull, 0x02040604002810B1ull, 0x008C218600004104ull,
+    0x8180004000402000ull, 0x488C402000401001ull, 0x4018A00080801004ull, 0x1230002105001008ull,
+    0x8904800800800400ull, 0x0042000C42003810ull, 0x008408110400B012ull, 0x0018086182000401ull,
+    0x2240088020C28000ull, 0x001001201040C004ull, 0x0A02008010420020ull, 0x0010003009010060ull,
+    0x0004008008008014ull, 0x0080020004008080ull, 0x0282020001008080ull, 0x50000181204A0004ull,
+    0x48FFFE99FECFAA00ull, 0x48FFFE99FECFAA00ull, 0x497FFFADFF9C2E00ull, 0x613FFFDDFFCE9200ull,
+    0xFFFFFFE9FFE7CE00ull, 0xFFFFFFF5FFF3E600ull, 0x0010301802830400ull, 0x510FFFF5F63C96A0ull,
+    0xEBFFFFB9FF9FC526ull, 0x61FFFEDDFEEDAEAEull, 0x53BFFFEDFFDEB1A2ull, 0x127FFFB9FFDFB5F6ull,
+    0x411FFFDDFFDBF4D6ull, 0x0801000804000603ull, 0x0003FFEF27EEBE74ull, 0x7645FFFECBFEA79Eull,
+};
+
+static const uint64_t BishopMagics[64] = {
+    0xFFEDF9FD7CFCFFFFull, 0xFC0962854A77F576ull, 0x5822022042000000ull, 0x2CA804A100200020ull,
+    0x0204042200000900ull, 0x2002121024000002ull, 0xFC0A66C64A7EF576ull, 0x7FFDFDFCBD79FFFFull,
+    0xFC0846A64A34FFF6ull, 0xFC087A874A3CF7F6ull, 0x1001080204002100ull, 0x1810080489021800ull,
+    0x0062040420010A00ull, 0x5028043004300020ull, 0xFC0864AE59B4FF76ull, 0x3C0860AF4B35FF76ull,
+    0x73C01AF56CF4CFFBull, 0x41A01CFAD64AAFFCull, 0x040C0422080A0598ull, 0x4228020082004050ull,
+    0x0200800400E00100ull, 0x020B001230021040ull, 0x7C0C028F5B34FF76ull, 0xFC0A028E5AB4DF76ull,
+    0x0020208050A42180ull, 0x001004804B280200ull, 0x2048020024040010ull, 0x0102C04004010200ull,
+    0x020408204C002010ull, 0x02411100020080C1ull, 0x102A008084042100ull, 0x0941030000A09846ull,
+    0x0244100800400200ull, 0x4000901010080696ull, 0x0000280404180020ull, 0x0800042008240100ull,
+    0x0220008400088020ull, 0x04020182000904C9ull, 0x0023010400020600ull, 0x0041040020110302ull,
+    0xDCEFD9B54BFCC09Full, 0xF95FFA765AFD602Bull, 0x1401210240484800ull, 0x0022244208010080ull,
+    0x1105040104000210ull, 0x2040088800C40081ull, 0x43FF9A5CF4CA0C01ull, 0x4BFFCD8E7C587601ull,
+    0xFC0FF2865334F576ull, 0xFC0BF6CE5924F576ull, 0x80000B0401040402ull, 0x0020004821880A00ull,
+    0x8200002022440100ull, 0x0009431801010068ull, 0xC3FFB7DC36CA8C89ull, 0xC3FF8A54F4CA2C89ull,
+    0xFFFFFCFCFD79EDFFull, 0xFC0863FCCB147576ull, 0x040C000022013020ull, 0x2000104000420600ull,
+    0x0400000260142410ull, 0x0800633408100500ull, 0xFC087E8E4BB2F736ull, 0x43FF9E4EF4CA2C89ull,
+};
+
 Bitboard PseudoAttacks[TYPE_NB][64];
 Bitboard PawnAttacks[COLOR_NB][64];
 
@@ -55,20 +98,35 @@ static Bitboard MakeSliderAttackBB(const Square sq, const PieceType pt, const Bi
 
     Bitboard attacks = 0;
 
-    const int BSteps[] = { 7, 9, -7, -9 };
-    const int RSteps[] = { 8, 1, -8, -1 };
-    const int *steps = pt == BISHOP ? BSteps : RSteps;
-
     for (int dir = 0; dir < 4; ++dir) {
-        Square s = sq;
-        // Step in the direction until hitting a piece or the edge of the board
-        while(!(occupied & BB(s)) && LandingSquareBB(s, steps[dir]))
-            attacks |= BB(s += steps[dir]);
+        Bitboard ray = Rays[pt - BISHOP][dir][sq];
+        Bitboard blockers = ray & occupied;
+
+        // Cut the ray off behind the nearest blocker
+        if (blockers)
+            ray ^= Rays[pt - BISHOP][dir][dir < 2 ? Lsb(blockers) : Msb(blockers)];
+
+        attacks |= ray;
     }
 
     return attacks;
 }
 
+// Initializes the empty board rays of each slider direction
+static void InitRays() {
+
+    const int steps[2][4] = { { 7, 9, -7, -9 }, { 8, 1, -8, -1 } };
+
+    for (int pt = 0; pt < 2; ++pt)
+        for (int dir = 0; dir < 4; ++dir)
+            for (Square sq = A1; sq <= H8; ++sq) {
+                Square s = sq;
+                // Step in the direction until hitting the edge of the board
+                while (LandingSquareBB(s, steps[pt][dir]))
+                    Rays[pt][dir][sq] |= BB(s += steps[pt][dir]);
+            }
+}
+
 // Initializes non-slider attack lookups
 static void InitNonSliderAttacks() {
 
@@ -91,30 +149,48 @@ static void InitNonSliderAttacks() {
     }
 }
 
-// Initializes slider attack lookups
-static void InitSliderAttacks(PieceType pt, Bitboard table[]) {
+// Initializes slider attack lookups, filling the magic table
+// unless the embedded pext table is used
+static void InitSliderAttacks(PieceType pt, Bitboard table[], const uint16_t compressed[]) {
 
     for (Square sq = A1; sq <= H8; ++sq) {
 
         Magic *m = &Magics[sq][pt - BISHOP];
-        (*m).attacks = table;
 
         Bitboard edges = ((rank1BB | rank8BB) & ~RankBB[RankOf(sq)])
                        | ((fileABB | fileHBB) & ~FileBB[FileOf(sq)]);
 
-        (*m).mask = MakeSliderAttackBB(sq, pt, 0) & ~edges;
+        m->rays  = MakeSliderAttackBB(sq, pt, 0);
+        m->mask  = m->rays & ~edges;
+        m->magic = pt == BISHOP ? BishopMagics[sq] : RookMagics[sq];
+        m->shift = 64 - PopCount(m->mask);
+
+        int size = 1 << PopCount(m->mask);
 
-#ifndef USE_PEXT
-        (*m).magic = MagicNumber(pt, sq);
-        (*m).shift = 64 - PopCount((*m).mask);
+        if (HasPext) {
+            m->compressed = compressed;
+            compressed += size;
+#ifdef NDEBUG
+            continue;
 #endif
+        } else
+            m->attacks = table,
+            table += size;
 
-        // Loop through all possible combinations of occupied squares, filling the table
+        // Loop through all possible combinations of occupied squares, filling the table.
+        // They come in increasing order, which is also the order of their pext indices.
         Bitboard occupied = 0;
+        int index = 0;
         do {
-            MagicAttack(sq, pt, occupied) = MakeSliderAttackBB(sq, pt, occupied);
-            occupied = (occupied - (*m).mask) & (*m).mask; // Carry rippler
-            table++;
+            Bitboard attacks = MakeSliderAttackBB(sq, pt, occupied);
+
+            if (HasPext)
+                assert(Pdep(m->compressed[index], m->rays) == attacks);
+            else
+                m->attacks[(occupied * m->magic) >> m->shift] = attacks;
+
+            occupied = (occupied - m->mask) & m->mask; // Carry rippler
+            index++;
         } while (occupied);
     }
 }
@@ -124,14 +200,16 @@ CONSTR(2) InitBitboards() {
 
     InitNonSliderAttacks();
 
-    InitSliderAttacks(BISHOP, BishopAttacks);
-    InitSliderAttacks(ROOK, RookAttacks);
+    InitRays();
+    InitSliderAttacks(BISHOP, BishopAttacks, BishopPextAttacks);
+    InitSliderAttacks(ROOK, RookAttacks, RookPextAttacks);
 
     for (Square sq1 = A1; sq1 <= H8; sq1++)
         for (Square sq2 = A1; sq2 <= H8; sq2++)
             for (PieceType pt = BISHOP; pt <= ROOK; pt++)
                 if (AttackBB(pt, sq1, BB(sq2)) & BB(sq2))
-                    BetweenBB[sq1][sq2] = AttackBB(pt, sq1, BB(sq2)) & AttackBB(pt, sq2, BB(sq1));
+                    BetweenBB[sq1][sq2] = AttackBB(pt, sq1, BB(sq2)) & AttackBB(pt, sq2, BB(sq1)),
+                    LineBB[sq1][sq2] = (AttackBB(pt, sq1, 0) & AttackBB(pt, sq2, 0)) | BB(sq1) | BB(sq2);
 
     for (Square sq = A1; sq <= H8; ++sq) {
 
@@ -143,11 +221,18 @@ CONSTR(2) InitBitboards() {
         PassedMask[BLACK][sq] = ShiftBB(~rank8BB, SOUTH * RelativeRank(BLACK, RankOf(sq)))
                               & (FileBB[FileOf(sq)] | AdjacentFilesBB(sq));
     }
+
+    StartupMark("InitBitboards");
 }
 
 // Returns a bitboard with all attackers of a square
 Bitboard Attackers(const Position *pos, const Square sq, const Bitboard occ) {
 
+#ifdef USE_ATTACK_MAPS
+    if (occ == pieceBB(ALL))
+        return pos->attackersTo[sq];
+#endif
+
     const Bitboard bishops = pieceBB(BISHOP) | pieceBB(QUEEN);
     const Bitboard rooks   = pieceBB(ROOK)   | pieceBB(QUEEN);
 
@@ -162,6 +247,9 @@ Bitboard Attackers(const Position *pos, const Square sq, const Bitboard occ) {
 // Checks whether a square is attacked by the given color
 bool SqAttacked(const Position *pos, const Square sq, const Color color) {
 
+#ifdef USE_ATTACK_MAPS
+    return pos->attackersTo[sq] & colorBB(color);
+#else
     const Bitboard bishops = colorBB(color) & (pieceBB(BISHOP) | pieceBB(QUEEN));
     const Bitboard rooks   = colorBB(color) & (pieceBB(ROOK)   | pieceBB(QUEEN));
 
@@ -170,6 +258,7 @@ bool SqAttacked(const Position *pos, const Square sq, const Color color) {
             || AttackBB(KING,   sq, 0)  & colorPieceBB(color, KING)
             || AttackBB(BISHOP, sq, pieceBB(ALL)) & bishops
             || AttackBB(ROOK,   sq, pieceBB(ALL)) & rooks);
+#endif
 }
 
 // Checks whether a king is attacked
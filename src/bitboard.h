@@ -20,66 +20,53 @@
 
 #include "types.h"
 #include "board.h"
+#include "cpu.h"
 
 
-#ifdef USE_PEXT
-// Uses the bmi2 pext instruction in place of magic bitboards
-#include "x86intrin.h"
-#define AttackIndex(sq, pt, occ) (_pext_u64(occ, Magics[sq][pt - BISHOP].mask))
+#if defined(__x86_64__) && !defined(__BMI2__)
+// The bmi2 pext and pdep instructions, usable without compiling the whole engine for bmi2
+INLINE uint64_t Pext(const uint64_t bb, const uint64_t mask) {
+    uint64_t result;
+    __asm__("pextq %2, %1, %0" : "=r" (result) : "r" (bb), "rm" (mask));
+    return result;
+}
 
+INLINE uint64_t Pdep(const uint64_t bits, const uint64_t mask) {
+    uint64_t result;
+    __asm__("pdepq %2, %1, %0" : "=r" (result) : "r" (bits), "rm" (mask));
+    return result;
+}
+#elif defined(__BMI2__)
+#include "x86intrin.h"
+#define Pext(bb, mask) _pext_u64(bb, mask)
+#define Pdep(bits, mask) _pdep_u64(bits, mask)
 #else
-// Uses magic bitboards as explained on https://www.chessprogramming.org/Magic_Bitboards
-#define AttackIndex(sq, pt, occ) (((occ & Magics[sq][pt - BISHOP].mask) * Magics[sq][pt - BISHOP].magic) >> Magics[sq][pt - BISHOP].shift)
-#define MagicNumber(pt, sq) (pt == BISHOP ? BishopMagics[sq] : RookMagics[sq])
-
-static const uint64_t RookMagics[64] = {
-    0xA180022080400230ull, 0x0040100040022000ull, 0x0080088020001002ull, 0x0080080280841000ull,
-    0x4200042010460008ull, 0x04800A0003040080ull, 0x0400110082041008ull, 0x008000A041000880ull,
-    0x10138001A080C010ull, 0x0000804008200480ull, 0x00010011012000C0ull, 0x0022004128102200ull,
-    0x000200081201200Cull, 0x202A001048460004ull, 0x0081000100420004ull, 0x4000800380004500ull,
-    0x0000208002904001ull, 0x0090004040026008ull, 0x0208808010002001ull, 0x2002020020704940ull,
-    0x8048010008110005ull, 0x6820808004002200ull, 0x0A80040008023011ull, 0x00B1460000811044ull,
-    0x4204400080008EA0ull, 0xB002400180200184ull, 0x2020200080100380ull, 0x0010080080100080ull,
-    0x2204080080800400ull, 0x0000A40080360080ull, 0x02040604002810B1ull, 0x008C218600004104ull,
-    0x8180004000402000ull, 0x488C402000401001ull, 0x4018A00080801004ull, 0x1230002105001008ull,
-    0x8904800800800400ull, 0x0042000C42003810ull, 0x008408110400B012ull, 0x0018086182000401ull,
-    0x2240088020C28000ull, 0x001001201040C004ull, 0x0A02008010420020ull, 0x0010003009010060ull,
-    0x0004008008008014ull, 0x0080020004008080ull, 0x0282020001008080ull, 0x50000181204A0004ull,
-    0x48FFFE99FECFAA00ull, 0x48FFFE99FECFAA00ull, 0x497FFFADFF9C2E00ull, 0x613FFFDDFFCE9200ull,
-    0xFFFFFFE9FFE7CE00ull, 0xFFFFFFF5FFF3E600ull, 0x0010301802830400ull, 0x510FFFF5F63C96A0ull,
-    0xEBFFFFB9FF9FC526ull, 0x61FFFEDDFEEDAEAEull, 0x53BFFFEDFFDEB1A2ull, 0x127FFFB9FFDFB5F6ull,
-    0x411FFFDDFFDBF4D6ull, 0x0801000804000603ull, 0x0003FFEF27EEBE74ull, 0x7645FFFECBFEA79Eull,
-};
-
-static const uint64_t BishopMagics[64] = {
-    0xFFEDF9FD7CFCFFFFull, 0xFC0962854A77F576ull, 0x5822022042000000ull, 0x2CA804A100200020ull,
-    0x0204042200000900ull, 0x2002121024000002ull, 0xFC0A66C64A7EF576ull, 0x7FFDFDFCBD79FFFFull,
-    0xFC0846A64A34FFF6ull, 0xFC087A874A3CF7F6ull, 0x1001080204002100ull, 0x1810080489021800ull,
-    0x0062040420010A00ull, 0x5028043004300020ull, 0xFC0864AE59B4FF76ull, 0x3C0860AF4B35FF76ull,
-    0x73C01AF56CF4CFFBull, 0x41A01CFAD64AAFFCull, 0x040C0422080A0598ull, 0x4228020082004050ull,
-    0x0200800400E00100ull, 0x020B001230021040ull, 0x7C0C028F5B34FF76ull, 0xFC0A028E5AB4DF76ull,
-    0x0020208050A42180ull, 0x001004804B280200ull, 0x2048020024040010ull, 0x0102C04004010200ull,
-    0x020408204C002010ull, 0x02411100020080C1ull, 0x102A008084042100ull, 0x0941030000A09846ull,
-    0x0244100800400200ull, 0x4000901010080696ull, 0x0000280404180020ull, 0x0800042008240100ull,
-    0x0220008400088020ull, 0x04020182000904C9ull, 0x0023010400020600ull, 0x0041040020110302ull,
-    0xDCEFD9B54BFCC09Full, 0xF95FFA765AFD602Bull, 0x1401210240484800ull, 0x0022244208010080ull,
-    0x1105040104000210ull, 0x2040088800C40081ull, 0x43FF9A5CF4CA0C01ull, 0x4BFFCD8E7C587601ull,
-    0xFC0FF2865334F576ull, 0xFC0BF6CE5924F576ull, 0x80000B0401040402ull, 0x0020004821880A00ull,
-    0x8200002022440100ull, 0x0009431801010068ull, 0xC3FFB7DC36CA8C89ull, 0xC3FF8A54F4CA2C89ull,
-    0xFFFFFCFCFD79EDFFull, 0xFC0863FCCB147576ull, 0x040C000022013020ull, 0x2000104000420600ull,
-    0x0400000260142410ull, 0x0800633408100500ull, 0xFC087E8E4BB2F736ull, 0x43FF9E4EF4CA2C89ull,
-};
+#define Pext(bb, mask) 0
+#define Pdep(bits, mask) 0
 #endif
 
-#define MagicAttack(sq, pt, occ) (Magics[sq][pt - BISHOP].attacks[AttackIndex(sq, pt, occ)])
+/* Slider attacks are looked up in one of two ways, picked at compile time when
+   the build targets bmi2 and at startup otherwise:
+
+   pext:  the occupancy bits in the mask are extracted to index a table of 16 bit
+          entries, holding the attacks compressed to the squares of the empty board
+          attack set, which are deposited back with pdep. At most 14 squares can be
+          attacked so it fits, and the table is a quarter of the size. The tables
+          are generated ahead of time and embedded (attacks.c), so nothing is built
+          at startup.
 
+   magic: the occupancy is hashed with a multiplication to index a table of full
+          bitboards built at startup, see https://www.chessprogramming.org/Magic_Bitboards
+*/
 typedef struct {
     Bitboard mask;
-    Bitboard *attacks;
-#ifndef USE_PEXT
+    Bitboard rays;
+    union {
+        Bitboard *attacks;
+        const uint16_t *compressed;
+    };
     uint64_t magic;
     int shift;
-#endif
 } Magic;
 
 enum {
@@ -111,9 +98,13 @@ extern const Bitboard FileBB[FILE_NB];
 extern const Bitboard RankBB[RANK_NB];
 
 extern Bitboard BetweenBB[64][64];
+extern Bitboard LineBB[64][64];
 
 extern Magic Magics[64][2];
 
+extern const uint16_t BishopPextAttacks[5248];
+extern const uint16_t RookPextAttacks[102400];
+
 extern Bitboard PseudoAttacks[TYPE_NB][64];
 extern Bitboard PawnAttacks[COLOR_NB][64];
 
@@ -153,6 +144,13 @@ INLINE Bitboard AdjacentFilesBB(const Square sq) {
 
 // Population count/Hamming weight
 INLINE int PopCount(const Bitboard bb) {
+#if defined(__x86_64__) && !defined(__POPCNT__)
+    if (HasPopcnt) {
+        uint64_t count;
+        __asm__("popcntq %1, %0" : "=r" (count) : "rm" (bb));
+        return count;
+    }
+#endif
     return __builtin_popcountll(bb);
 }
 
@@ -162,6 +160,12 @@ INLINE int Lsb(const Bitboard bb) {
     return __builtin_ctzll(bb);
 }
 
+// Returns the index of the most significant bit
+INLINE int Msb(const Bitboard bb) {
+    assert(bb);
+    return 63 ^ __builtin_clzll(bb);
+}
+
 // Returns the index of the least significant bit and unsets it
 INLINE int PopLsb(Bitboard *bb) {
     int lsb = Lsb(*bb);
@@ -183,6 +187,13 @@ INLINE int PieceCount(const Position *pos, Piece piece) {
     return PopCount(colorPieceBB(ColorOf(piece), PieceTypeOf(piece)));
 }
 
+// Returns the attack bitboard for a bishop or rook on the given square
+INLINE Bitboard SliderAttackBB(PieceType pt, Square sq, Bitboard occupied) {
+    const Magic *m = &Magics[sq][pt - BISHOP];
+    return HasPext ? Pdep(m->compressed[Pext(occupied, m->mask)], m->rays)
+                   : m->attacks[((occupied & m->mask) * m->magic) >> m->shift];
+}
+
 // Returns the attack bitboard for the piecetype on the given square
 INLINE Bitboard AttackBB(PieceType pt, Square sq, Bitboard occupied) {
 
@@ -190,7 +201,7 @@ INLINE Bitboard AttackBB(PieceType pt, Square sq, Bitboard occupied) {
 
     switch (pt) {
         case BISHOP:
-        case ROOK  : return MagicAttack(sq, pt, occupied);
+        case ROOK  : return SliderAttackBB(pt, sq, occupied);
         case QUEEN : return AttackBB(ROOK, sq, occupied) | AttackBB(BISHOP, sq, occupied);
         default    : return PseudoAttacks[pt][sq];
     }
@@ -213,6 +224,12 @@ INLINE Bitboard PawnAttackBB(Color color, Square sq) {
     return PawnAttacks[color][sq];
 }
 
+// Returns the attack bitboard for any piece
+INLINE Bitboard PieceAttackBB(Piece piece, Square sq, Bitboard occupied) {
+    return PieceTypeOf(piece) == PAWN ? PawnAttackBB(ColorOf(piece), sq)
+                                      : AttackBB(PieceTypeOf(piece), sq, occupied);
+}
+
 // Returns the combined attack bitboard of all pawns in the given bitboard
 INLINE Bitboard PawnBBAttackBB(Bitboard pawns, Color color) {
     const Direction up = color == WHITE ? NORTH : SOUTH;
@@ -225,5 +242,29 @@ bool KingAttacked(const Position *pos, Color color);
 
 // Returns a bitboard with all pieces checking the king of the current side to move
 INLINE Bitboard Checkers(const Position *pos) {
+#ifdef USE_ATTACK_MAPS
+    return colorBB(!sideToMove) & pos->attackersTo[kingSq(sideToMove)];
+#else
     return colorBB(!sideToMove) & Attackers(pos, kingSq(sideToMove), pieceBB(ALL));
+#endif
+}
+
+// Returns a bitboard with all pieces pinned to the king of the current side to move
+INLINE Bitboard Pinned(const Position *pos) {
+
+    const Color color = sideToMove;
+    const Square kingSq = kingSq(color);
+
+    Bitboard snipers = colorBB(!color)
+                     & (  (AttackBB(BISHOP, kingSq, 0) & (pieceBB(BISHOP) | pieceBB(QUEEN)))
+                        | (AttackBB(ROOK,   kingSq, 0) & (pieceBB(ROOK)   | pieceBB(QUEEN))));
+    Bitboard pinned = 0;
+
+    while (snipers) {
+        Bitboard between = BetweenBB[kingSq][PopLsb(&snipers)] & pieceBB(ALL);
+        if (Single(between))
+            pinned |= between & colorBB(color);
+    }
+
+    return pinned;
 }
@@ -25,6 +25,7 @@
 #include "evaluate.h"
 #include "move.h"
 #include "psqt.h"
+#include "startup.h"
 
 
 bool Chess960 = false;
@@ -56,6 +57,8 @@ CONSTR(1) InitDistance() {
             int horizontal = abs(FileOf(sq1) - FileOf(sq2));
             SqDistance[sq1][sq2] = MAX(vertical, horizontal);
         }
+
+    StartupMark("InitDistance");
 }
 
 int Distance(Square sq1, Square sq2) { return SqDistance[sq1][sq2]; }
@@ -97,6 +100,8 @@ CONSTR(1) InitHashKeys() {
     // Castling rights
     for (int i = 0; i < 16; ++i)
         CastleKeys[i] = Rand64();
+
+    StartupMark("InitHashKeys");
 }
 
 // Generates a hash key from scratch
@@ -201,6 +206,22 @@ static void AddPiece(Position *pos, const Square sq, const Piece piece) {
     colorBB(color) |= BB(sq);
 }
 
+#ifdef USE_ATTACK_MAPS
+// Build the attack maps from scratch
+static void InitAttackMaps(Position *pos) {
+
+    Bitboard pieces = pieceBB(ALL);
+
+    while (pieces) {
+        Square sq = PopLsb(&pieces);
+        Bitboard attacks = pos->attacks[sq] = PieceAttackBB(pieceOn(sq), sq, pieceBB(ALL));
+
+        while (attacks)
+            pos->attackersTo[PopLsb(&attacks)] |= BB(sq);
+    }
+}
+#endif
+
 static void InitCastlingRight(Position *pos, Color color, int file) {
 
     if (   FileOf(kingSq(color)) != FILE_E
@@ -272,7 +293,11 @@ void ParseFen(const char *fen, Position *pos) {
     pos->gameMoves = atoi(strtok(NULL, " "));
 
     // Final initializations
+#ifdef USE_ATTACK_MAPS
+    InitAttackMaps(pos);
+#endif
     pos->checkers = Checkers(pos);
+    pos->pinned = Pinned(pos);
     pos->key = GenPosKey(pos);
     pos->materialKey = GenMaterialKey(pos);
     pos->minorKey = GenMinorKey(pos);
@@ -346,8 +371,8 @@ static int SEEValues[TYPE_NB] = {
     0, 100, 450, 450, 650, 1250
 };
 
-// Static Exchange Evaluation
-bool SEE(const Position *pos, const Move move, const int threshold) {
+// Static Exchange Evaluation, the cache is optional
+bool SEE(const Position *pos, const Move move, const int threshold, SEECache *cache) {
 
     assert(MoveIsPseudoLegal(pos, move));
 
@@ -367,11 +392,31 @@ bool SEE(const Position *pos, const Move move, const int threshold) {
 
     // It doesn't matter if the to square is occupied or not
     Bitboard occupied = pieceBB(ALL) ^ BB(from);
-    Bitboard attackers = Attackers(pos, to, occupied);
 
     Bitboard bishops = pieceBB(BISHOP) | pieceBB(QUEEN);
     Bitboard rooks   = pieceBB(ROOK  ) | pieceBB(QUEEN);
 
+#ifdef USE_ATTACK_MAPS
+    (void)cache;
+    Bitboard attackers = pos->attackersTo[to];
+#else
+    Bitboard attackers;
+    if (cache && cache->known & BB(to))
+        attackers = cache->attackers[to];
+    else {
+        attackers = Attackers(pos, to, pieceBB(ALL));
+        if (cache)
+            cache->attackers[to] = attackers,
+            cache->known |= BB(to);
+    }
+#endif
+
+    // Add any slider uncovered by the moving piece
+    if (BB(from) & AttackBB(BISHOP, to, 0))
+        attackers |= AttackBB(BISHOP, to, occupied) & bishops;
+    else if (BB(from) & AttackBB(ROOK, to, 0))
+        attackers |= AttackBB(ROOK, to, occupied) & rooks;
+
     Color side = !ColorOf(pieceOn(from));
 
     // Make captures until one side runs out, or fail to beat threshold
@@ -437,7 +482,7 @@ CONSTR(3) InitCuckoo() {
                         continue;
 
                     Piece pc  = MakePiece(c, pt);
-                    Move move = MOVE(sq1, sq2, pc, EMPTY, EMPTY, FLAG_NONE);
+                    Move move = MOVE(sq1, sq2, FLAG_NONE);
                     Key hash  = PieceKeys[pc][sq1] ^ PieceKeys[pc][sq2] ^ SideKey;
 
                     uint32_t i = Hash1(hash);
@@ -456,12 +501,16 @@ CONSTR(3) InitCuckoo() {
 
     if (validate != 3668)
         puts("Failed to set cuckoo tables."), exit(EXIT_FAILURE);
+
+    StartupMark("InitCuckoo");
 }
 
 // Upcoming repetition detection
 bool HasCycle(const Position *pos, int ply) {
 
-    for (int i = 3; i <= pos->rule50; i += 2) {
+    const int end = MIN(pos->rule50, pos->histPly);
+
+    for (int i = 3; i <= end; i += 2) {
 
         const History *prev = &history(-i);
         uint32_t j;
@@ -481,7 +530,7 @@ bool HasCycle(const Position *pos, int ply) {
             if (ColorOf(pieceOn(from) ?: pieceOn(to)) != sideToMove)
                 continue;
 
-            for (int k = i + 4; k <= pos->rule50; k += 2) {
+            for (int k = i + 4; k <= end; k += 2) {
                 const History *prev2 = &history(-k);
                 if (prev2->key == prev->key)
                     return true;
@@ -532,7 +581,7 @@ static Key GenPawnKey(const Position *pos) {
 // Check board state makes sense
 bool PositionOk(const Position *pos) {
 
-    assert(0 <= pos->histPly && pos->histPly < 256);
+    assert(0 <= pos->histPly);
 
     int counts[PIECE_NB] = { 0 };
     int nonPawnCount[COLOR_NB] = { 0, 0 };
@@ -559,6 +608,8 @@ bool PositionOk(const Position *pos) {
 
     assert(sideToMove == WHITE || sideToMove == BLACK);
 
+    assert(Pinned(pos) == pos->pinned);
+
     assert(!pos->epSquare || RelativeRank(sideToMove, RankOf(pos->epSquare)) == RANK_6);
 
     assert(pos->castlingRights >= 0 && pos->castlingRights <= 15);
@@ -573,6 +624,21 @@ bool PositionOk(const Position *pos) {
 
     assert(!KingAttacked(pos, !sideToMove));
 
+#ifdef USE_ATTACK_MAPS
+    Bitboard attackersTo[64] = { 0 };
+
+    for (Square sq = A1; sq <= H8; ++sq) {
+        Bitboard attacks = pieceOn(sq) ? PieceAttackBB(pieceOn(sq), sq, pieceBB(ALL)) : 0;
+        assert(pos->attacks[sq] == attacks);
+
+        while (attacks)
+            attackersTo[PopLsb(&attacks)] |= BB(sq);
+    }
+
+    for (Square sq = A1; sq <= H8; ++sq)
+        assert(pos->attackersTo[sq] == attackersTo[sq]);
+#endif
+
     return true;
 }
 #endif
@@ -18,24 +18,19 @@
 
 #pragma once
 
+#include <stddef.h>
+
 #include "types.h"
 
 
-typedef struct {
-    Key key;
-    Key materialKey;
-    Bitboard checkers;
-    Move move;
-    Square epSquare;
-    int rule50;
-    int castlingRights;
-} History;
+typedef struct History History;
 
 typedef struct Position {
     uint8_t board[64];
     Bitboard pieceBB[7];
     Bitboard colorBB[COLOR_NB];
     Bitboard checkers;
+    Bitboard pinned;
 
     int nonPawnCount[COLOR_NB];
     int material;
@@ -47,7 +42,7 @@ typedef struct Position {
     int rule50;
     int castlingRights;
 
-    uint16_t histPly;
+    int histPly;
     uint16_t gameMoves;
 
     Key key;
@@ -57,12 +52,34 @@ typedef struct Position {
     Key majorKey;
     Key nonPawnKey[COLOR_NB];
 
+#ifdef USE_ATTACK_MAPS
+    Bitboard attacks[64];     // Squares attacked by the piece on each square
+    Bitboard attackersTo[64]; // Pieces attacking each square
+#endif
+
     uint64_t nodes;
     int trend;
 
-    History gameHistory[256];
+    // Kept outside the position so copies stay small, history(0) is gameHistory[histPly]
+    History *gameHistory;
 } Position;
 
+// Copy-make builds only need the key for repetitions and the move,
+// the rest is there for the takeback to restore
+struct History {
+    Key key;
+    Move move;
+    Piece capture;
+#ifndef COPY_MAKE
+    Key materialKey;
+    Bitboard checkers;
+    Bitboard pinned;
+    Square epSquare;
+    int rule50;
+    int castlingRights;
+#endif
+};
+
 
 extern bool Chess960;
 
@@ -77,10 +94,17 @@ extern uint8_t CastlePerm[64];
 extern Bitboard CastlePath[16];
 extern Square RookSquare[16];
 
+// Attackers of each target square seen by SEE, filled in as needed so
+// that moves to the same square in a node don't recompute them
+typedef struct SEECache {
+    Bitboard known;
+    Bitboard attackers[64];
+} SEECache;
+
 
 void ParseFen(const char *fen, Position *pos);
 Key KeyAfter(const Position *pos, Move move);
-bool SEE(const Position *pos, const Move move, const int threshold);
+bool SEE(const Position *pos, const Move move, const int threshold, SEECache *cache);
 bool HasCycle(const Position *pos, int ply);
 char *BoardToFen(const Position *pos);
 #ifndef NDEBUG
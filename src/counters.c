@@ -0,0 +1,120 @@
+/*
+  Weiss is a UCI compliant chess engine.
+  Copyright (C) 2019-2026 Terje Kirstihagen
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <errno.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "counters.h"
+
+
+const char *PerfCounterNames[PC_NB] = {
+    "cycles", "instructions", "branch-misses", "L1d-misses", "LLC-misses", "dTLB-misses"
+};
+
+bool PerfCounterOpen[PC_NB];
+
+#ifdef __linux__
+
+#define CACHE_READ_MISS(cache) \
+    ((cache) | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+static const struct { uint32_t type; uint64_t config; } Events[PC_NB] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES                },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS              },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES             },
+    { PERF_TYPE_HW_CACHE, CACHE_READ_MISS(PERF_COUNT_HW_CACHE_L1D) },
+    { PERF_TYPE_HW_CACHE, CACHE_READ_MISS(PERF_COUNT_HW_CACHE_LL)  },
+    { PERF_TYPE_HW_CACHE, CACHE_READ_MISS(PERF_COUNT_HW_CACHE_DTLB)},
+};
+
+static int fds[PC_NB] = { -1, -1, -1, -1, -1, -1 };
+
+// Opens the counters for this process and any threads it starts later,
+// counters the cpu or kernel doesn't support are left out
+bool OpenPerfCounters() {
+
+    bool any = false;
+    int error = 0;
+
+    for (PerfCounter c = 0; c < PC_NB; ++c) {
+
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size           = sizeof(attr);
+        attr.type           = Events[c].type;
+        attr.config         = Events[c].config;
+        attr.inherit        = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        fds[c] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        PerfCounterOpen[c] = fds[c] != -1;
+        any |= PerfCounterOpen[c];
+        if (fds[c] == -1 && !error)
+            error = errno;
+    }
+
+    if (!any)
+        fprintf(stderr, "Performance counters unavailable: %s%s\n", strerror(error),
+               error == EACCES || error == EPERM ? " (check /proc/sys/kernel/perf_event_paranoid)"
+             : error == ENOENT || error == ENODEV ? " (no PMU exposed, e.g. in a VM or container)" : "");
+
+    return any;
+}
+
+// Reads the current totals, scaled up if the kernel had to multiplex counters.
+// Threads started after opening are included once they have been joined.
+void ReadPerfCounters(PerfCounts *counts) {
+
+    for (PerfCounter c = 0; c < PC_NB; ++c) {
+
+        uint64_t data[3] = { 0 }; // value, time enabled, time running
+
+        counts->value[c] =
+            fds[c] != -1 && read(fds[c], data, sizeof(data)) == sizeof(data) && data[2]
+            ? (uint64_t)((double)data[0] * data[1] / data[2]) : 0;
+    }
+}
+
+void ClosePerfCounters() {
+    for (PerfCounter c = 0; c < PC_NB; ++c)
+        if (fds[c] != -1)
+            close(fds[c]), fds[c] = -1, PerfCounterOpen[c] = false;
+}
+
+#else
+
+bool OpenPerfCounters() {
+    fputs("Performance counters are only supported on linux\n", stderr);
+    return false;
+}
+
+void ReadPerfCounters(PerfCounts *counts) {
+    memset(counts, 0, sizeof(PerfCounts));
+}
+
+void ClosePerfCounters() {}
+
+#endif
@@ -0,0 +1,39 @@
+/*
+  Weiss is a UCI compliant chess engine.
+  Copyright (C) 2019-2026 Terje Kirstihagen
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "types.h"
+
+
+// Hardware performance counters read around bench searches
+typedef enum PerfCounter {
+    PC_CYCLES, PC_INSTRUCTIONS, PC_BRANCH_MISSES, PC_L1D_MISSES, PC_LLC_MISSES, PC_DTLB_MISSES, PC_NB
+} PerfCounter;
+
+typedef struct PerfCounts {
+    uint64_t value[PC_NB];
+} PerfCounts;
+
+extern const char *PerfCounterNames[PC_NB];
+extern bool PerfCounterOpen[PC_NB];
+
+
+bool OpenPerfCounters();
+void ReadPerfCounters(PerfCounts *counts);
+void ClosePerfCounters();
@@ -0,0 +1,71 @@
+/*
+  Weiss is a UCI compliant chess engine.
+  Copyright (C) 2019-2026 Terje Kirstihagen
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "cpu.h"
+#include "startup.h"
+
+
+CPUFeatures CPU;
+
+
+// Runs before the other initializers as the attack tables depend on it
+CONSTR(0) InitCPU() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+
+    CPU.popcnt      = __builtin_cpu_supports("popcnt");
+    CPU.slowPext    = __builtin_cpu_is("amdfam15h") || __builtin_cpu_is("amdfam17h");
+    CPU.pext        = __builtin_cpu_supports("bmi2") && !CPU.slowPext;
+    CPU.avx2        = __builtin_cpu_supports("avx2");
+    CPU.avx512vbmi2 = __builtin_cpu_supports("avx512vbmi2");
+#endif
+
+    StartupMark("InitCPU");
+}
+
+// Describes the code paths in use
+const char *CPUDescription() {
+
+    static char str[128];
+
+    snprintf(str, sizeof(str), "%s, %s%s%s",
+             HasPopcnt      ? "popcnt" : "software popcount",
+             HasPext        ? "pext attacks" : CPU.slowPext ? "magic attacks (slow pext)" : "magic attacks",
+             HasAVX2        ? ", avx2 eval" : "",
+             HasAVX512VBMI2 ? ", avx512 movegen" : "");
+
+    return str;
+}
+
+// Number of hardware threads available
+int CPUThreads() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+#else
+    return MAX(1, sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+}
@@ -0,0 +1,64 @@
+/*
+  Weiss is a UCI compliant chess engine.
+  Copyright (C) 2019-2026 Terje Kirstihagen
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "types.h"
+
+
+// Instruction set extensions detected at startup, so one binary
+// can pick the fastest available paths on any x86-64 cpu
+typedef struct CPUFeatures {
+    bool popcnt;
+    bool pext;     // Only set when bmi2 is present and pext is fast
+    bool slowPext; // Zen 1/2 and older AMD implement pext in microcode
+    bool avx2;
+    bool avx512vbmi2;
+} CPUFeatures;
+
+extern CPUFeatures CPU;
+
+// The paths in use. When the build flags already guarantee an extension
+// this is known at compile time and there is nothing left to check.
+#if defined(__POPCNT__)
+#define HasPopcnt true
+#else
+#define HasPopcnt CPU.popcnt
+#endif
+
+#if defined(__BMI2__) && !defined(__bdver4__) && !defined(__znver1__) && !defined(__znver2__)
+#define HasPext true
+#else
+#define HasPext CPU.pext
+#endif
+
+#if defined(__AVX2__)
+#define HasAVX2 true
+#else
+#define HasAVX2 CPU.avx2
+#endif
+
+#if defined(__AVX512VBMI2__) && defined(__AVX512BW__)
+#define HasAVX512VBMI2 true
+#else
+#define HasAVX512VBMI2 CPU.avx512vbmi2
+#endif
+
+
+const char *CPUDescription();
+int CPUThreads();
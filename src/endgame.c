@@ -16,14 +16,154 @@
   along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
+#include <ctype.h>
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "bitboard.h"
 #include "endgame.h"
+#include "movegen.h"
+#include "startup.h"
 
 
 Endgame EndgameTable[ENDGAME_TABLE_SIZE] = { 0 };
 
+// Base score for positions known to be won, added to a heuristic
+// that guides the winning side towards mate or promotion
+const int KnownWin = 10000;
+
+
+// KPK bitbase, one bit per position telling whether it is won for the side with the pawn.
+// Positions are normalized so the strong side is white and the pawn is on files A-D.
+#define KPK_SIZE (2 * 24 * 64 * 64)
+
+static uint32_t KPKBitbase[KPK_SIZE / 32];
+static pthread_once_t KPKGenerated = PTHREAD_ONCE_INIT;
+
+enum { KPK_INVALID = 0, KPK_UNKNOWN = 1, KPK_DRAW = 2, KPK_WIN = 4 };
+
+INLINE int KPKIndex(Color stm, Square wKing, Square bKing, Square pawn) {
+    return wKing | bKing << 6 | stm << 12 | FileOf(pawn) << 13 | (RANK_7 - RankOf(pawn)) << 15;
+}
+
+// Classifies a position before any moves are considered
+static uint8_t KPKInitial(int idx) {
+
+    const Square wKing = idx & 63;
+    const Square bKing = (idx >> 6) & 63;
+    const Color stm    = (idx >> 12) & 1;
+    const Square pawn  = MakeSquare(RANK_7 - (idx >> 15), (idx >> 13) & 3);
+    const Square push  = pawn + NORTH;
+
+    // Kings touching, pieces overlapping, or the side not to move in check
+    if (   Distance(wKing, bKing) <= 1
+        || wKing == pawn
+        || bKing == pawn
+        || (stm == WHITE && (PawnAttackBB(WHITE, pawn) & BB(bKing))))
+        return KPK_INVALID;
+
+    // The pawn promotes without being captured
+    if (   stm == WHITE
+        && RankOf(pawn) == RANK_7
+        && wKing != push
+        && bKing != push
+        && (Distance(bKing, push) > 1 || Distance(wKing, push) == 1))
+        return KPK_WIN;
+
+    // Stalemate, or the pawn is lost
+    if (stm == BLACK) {
+        Bitboard kingMoves = AttackBB(KING, bKing, 0);
+        Bitboard covered = AttackBB(KING, wKing, 0) | PawnAttackBB(WHITE, pawn);
+
+        if (   !(kingMoves & ~covered)
+            || (kingMoves & BB(pawn) & ~AttackBB(KING, wKing, 0)))
+            return KPK_DRAW;
+    }
+
+    return KPK_UNKNOWN;
+}
+
+// Classifies a position based on the positions reachable from it
+static uint8_t KPKClassify(const uint8_t *db, int idx) {
+
+    const Square wKing = idx & 63;
+    const Square bKing = (idx >> 6) & 63;
+    const Color stm    = (idx >> 12) & 1;
+    const Square pawn  = MakeSquare(RANK_7 - (idx >> 15), (idx >> 13) & 3);
+
+    int result = KPK_INVALID;
+
+    if (stm == WHITE) {
+        Bitboard moves = AttackBB(KING, wKing, 0);
+        while (moves)
+            result |= db[KPKIndex(BLACK, PopLsb(&moves), bKing, pawn)];
+
+        if (RankOf(pawn) < RANK_7)
+            result |= db[KPKIndex(BLACK, wKing, bKing, pawn + NORTH)];
+
+        if (   RankOf(pawn) == RANK_2
+            && pawn + NORTH != wKing
+            && pawn + NORTH != bKing)
+            result |= db[KPKIndex(BLACK, wKing, bKing, pawn + 2 * NORTH)];
+
+        return result & KPK_WIN     ? KPK_WIN
+             : result & KPK_UNKNOWN ? KPK_UNKNOWN
+                                    : KPK_DRAW;
+    } else {
+        Bitboard moves = AttackBB(KING, bKing, 0);
+        while (moves)
+            result |= db[KPKIndex(WHITE, wKing, PopLsb(&moves), pawn)];
+
+        return result & KPK_DRAW    ? KPK_DRAW
+             : result & KPK_UNKNOWN ? KPK_UNKNOWN
+                                    : KPK_WIN;
+    }
+}
+
+// Generates the KPK bitbase by retrograde iteration until no unknown positions change
+static void InitKPK() {
+
+    uint8_t *db = malloc(KPK_SIZE);
+
+    for (int idx = 0; idx < KPK_SIZE; ++idx)
+        db[idx] = KPKInitial(idx);
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int idx = 0; idx < KPK_SIZE; ++idx)
+            if (db[idx] == KPK_UNKNOWN && (db[idx] = KPKClassify(db, idx)) != KPK_UNKNOWN)
+                changed = true;
+    }
+
+    for (int idx = 0; idx < KPK_SIZE; ++idx)
+        if (db[idx] == KPK_WIN)
+            KPKBitbase[idx / 32] |= 1u << (idx % 32);
+
+    free(db);
+}
+
+// Probes the KPK bitbase, returns true if the side with the pawn wins.
+// The bitbase is generated on first use, as few searches ever need it.
+static bool ProbeKPK(const Position *pos, const Color strong) {
+
+    pthread_once(&KPKGenerated, InitKPK);
+
+    Square wKing = RelativeSquare(strong, kingSq(strong));
+    Square bKing = RelativeSquare(strong, kingSq(!strong));
+    Square pawn  = RelativeSquare(strong, Lsb(pieceBB(PAWN)));
+    Color stm    = strong == sideToMove ? WHITE : BLACK;
+
+    // Mirror the pawn onto files A-D
+    if (FileOf(pawn) > FILE_D)
+        wKing ^= 7, bKing ^= 7, pawn ^= 7;
+
+    int idx = KPKIndex(stm, wKing, bKing, pawn);
+
+    return KPKBitbase[idx / 32] & (1u << (idx % 32));
+}
+
 
 // Generates a material key from a string like "KRPkr"
 static Key GenMaterialKey(const char *white, const char *black) {
@@ -44,18 +184,160 @@ static int TrivialDraw(__attribute__((unused)) const Position *pos, __attribute_
     return 0;
 }
 
+// Bonus for driving the king towards the edge of the board
+INLINE int PushToEdge(const Square sq) {
+    int file = FileOf(sq), rank = RankOf(sq);
+    return 20 * (MAX(3 - file, file - 4) + MAX(3 - rank, rank - 4));
+}
+
+// Bonus for driving the king towards a corner of the given square color
+INLINE int PushToCorner(const Square sq, const bool darkCorners) {
+    int file = darkCorners ? FileOf(sq) : 7 - FileOf(sq);
+    int rank = RankOf(sq);
+    return 30 * (7 - MIN(file + rank, 14 - file - rank));
+}
+
+// Bonus for bringing two squares close to each other
+INLINE int PushClose(const Square sq1, const Square sq2) {
+    return 140 - 20 * Distance(sq1, sq2);
+}
+
+// King and pawn vs king, exact win/draw from the bitbase
+static int KPK(const Position *pos, Color color) {
+
+    Color strong = colorBB(WHITE) & pieceBB(PAWN) ? WHITE : BLACK;
+
+    if (!ProbeKPK(pos, strong))
+        return 0;
+
+    Square pawn = Lsb(pieceBB(PAWN));
+    int eval = KnownWin + P_EG + 20 * RelativeRank(strong, RankOf(pawn));
+
+    return color == strong ? eval : -eval;
+}
+
+// Lone king vs enough material to force mate, drive the king to the edge
+static int KXK(const Position *pos, Color color) {
+
+    Color strong = pos->nonPawnCount[WHITE] ? WHITE : BLACK;
+    Square weakKing = kingSq(!strong);
+
+    // The lone king may be stalemated
+    if (color != strong && !pos->checkers && !HasLegalMove(pos))
+        return 0;
+
+    int eval =  KnownWin
+              + PopCount(colorPieceBB(strong, QUEEN))  * Q_EG
+              + PopCount(colorPieceBB(strong, ROOK))   * R_EG
+              + PopCount(colorPieceBB(strong, BISHOP)) * B_EG
+              + PopCount(colorPieceBB(strong, KNIGHT)) * N_EG
+              + PushToEdge(weakKing)
+              + PushClose(kingSq(strong), weakKing);
+
+    return color == strong ? eval : -eval;
+}
+
+// King, bishop and knight vs king, drive the king to a corner the bishop controls
+static int KBNK(const Position *pos, Color color) {
+
+    Color strong = pos->nonPawnCount[WHITE] ? WHITE : BLACK;
+    Square weakKing = kingSq(!strong);
+    bool darkBishop = pieceBB(BISHOP) & BlackSquaresBB;
+
+    int eval =  KnownWin + B_EG + N_EG
+              + PushToCorner(weakKing, darkBishop)
+              + PushToEdge(weakKing)
+              + PushClose(kingSq(strong), weakKing);
+
+    return color == strong ? eval : -eval;
+}
+
+// King and rook vs king and pawn, won unless the pawn is far advanced with king support
+static int KRKP(const Position *pos, Color color) {
+
+    Color strong = pieceBB(ROOK) & colorBB(WHITE) ? WHITE : BLACK;
+
+    // Seen from the strong side, the pawn runs towards rank 1
+    Square strongKing = RelativeSquare(strong, kingSq(strong));
+    Square weakKing   = RelativeSquare(strong, kingSq(!strong));
+    Square rook       = RelativeSquare(strong, Lsb(pieceBB(ROOK)));
+    Square pawn       = RelativeSquare(strong, Lsb(pieceBB(PAWN)));
+    Square queening   = MakeSquare(RANK_1, FileOf(pawn));
+    Square forward    = pawn + SOUTH;
+
+    int eval;
+
+    // The strong king stands in front of the pawn
+    if (FileOf(strongKing) == FileOf(pawn) && strongKing < pawn)
+        eval = R_EG - Distance(strongKing, pawn);
+
+    // The weak king is too far away from the pawn and the rook
+    else if (   Distance(weakKing, pawn) >= 3 + (sideToMove != strong)
+             && Distance(weakKing, rook) >= 3)
+        eval = R_EG - Distance(strongKing, pawn);
+
+    // The pawn is far advanced and supported by its king
+    else if (   RankOf(weakKing) <= RANK_3
+             && Distance(weakKing, pawn) == 1
+             && RankOf(strongKing) >= RANK_4
+             && Distance(strongKing, pawn) > 2 + (sideToMove == strong))
+        eval = 80 - 8 * Distance(strongKing, pawn);
+
+    else
+        eval = 200 - 8 * (  Distance(strongKing, forward)
+                          - Distance(weakKing, forward)
+                          - Distance(pawn, queening));
+
+    return color == strong ? eval : -eval;
+}
+
+// King and queen vs king and pawn, won unless a rook or bishop pawn is on the 7th with king support
+static int KQKP(const Position *pos, Color color) {
+
+    Color strong = pieceBB(QUEEN) & colorBB(WHITE) ? WHITE : BLACK;
+    Square weakKing = kingSq(!strong);
+    Square pawn = Lsb(pieceBB(PAWN));
+
+    int eval = PushClose(kingSq(strong), weakKing);
+
+    if (   RelativeRank(!strong, RankOf(pawn)) != RANK_7
+        || Distance(weakKing, pawn) != 1
+        || (BB(pawn) & (fileBBB | fileDBB | fileEBB | fileGBB)))
+        eval += Q_EG - P_EG;
+
+    return color == strong ? eval : -eval;
+}
+
 static void AddEndgame(const char *white, const char *black, SpecializedEval ef) {
 
     Key key = GenMaterialKey(white, black);
 
-    Endgame *eg = &EndgameTable[EndgameIndex(key)];
+    int i = EndgameIndex(key);
 
-    if (eg->evalFunc != NULL) {
-        puts("Collision in endgame table.");
-        exit(EXIT_FAILURE);
+    // Linear probing to the first free slot
+    while (EndgameTable[i].evalFunc != NULL) {
+
+        if (EndgameTable[i].key == key) {
+            puts("Duplicate entry in endgame table.");
+            exit(EXIT_FAILURE);
+        }
+
+        i = (i + 1) & (ENDGAME_TABLE_SIZE - 1);
     }
 
-    *eg = (Endgame) { key, ef };
+    EndgameTable[i] = (Endgame) { key, ef };
+}
+
+// Adds an endgame for both colors
+static void AddEndgames(const char *strong, const char *weak, SpecializedEval ef) {
+
+    char white[8], black[8];
+
+    for (int i = 0; (black[i] = tolower(strong[i])); ++i);
+    for (int i = 0; (white[i] = toupper(weak[i]));   ++i);
+
+    AddEndgame(strong, weak, ef);
+    AddEndgame(white, black, ef);
 }
 
 CONSTR(3) InitEndgames() {
@@ -77,4 +359,25 @@ CONSTR(3) InitEndgames() {
     // 2 knights vs lone king
     AddEndgame("KNN", "k", &TrivialDraw);
     AddEndgame("K", "knn", &TrivialDraw);
+
+    // King and pawn vs king
+    AddEndgames("KP", "k", &KPK);
+
+    // Mating material vs lone king
+    AddEndgames("KQ",  "k", &KXK);
+    AddEndgames("KR",  "k", &KXK);
+    AddEndgames("KQQ", "k", &KXK);
+    AddEndgames("KQR", "k", &KXK);
+    AddEndgames("KQB", "k", &KXK);
+    AddEndgames("KQN", "k", &KXK);
+    AddEndgames("KRR", "k", &KXK);
+    AddEndgames("KRB", "k", &KXK);
+    AddEndgames("KRN", "k", &KXK);
+    AddEndgames("KBN", "k", &KBNK);
+
+    // Rook or queen vs pawn
+    AddEndgames("KR", "kp", &KRKP);
+    AddEndgames("KQ", "kp", &KQKP);
+
+    StartupMark("InitEndgames");
 }
@@ -22,7 +22,7 @@
 #include "types.h"
 
 
-#define ENDGAME_TABLE_SIZE 64
+#define ENDGAME_TABLE_SIZE 1024
 
 
 typedef int (*SpecializedEval) (const Position *pos, Color color);
@@ -39,3 +39,12 @@ extern Endgame EndgameTable[ENDGAME_TABLE_SIZE];
 INLINE int EndgameIndex(Key materialKey) {
     return materialKey & (ENDGAME_TABLE_SIZE - 1);
 }
+
+// Returns the specialized eval for the material configuration, if any.
+// Collisions are resolved by linear probing, an empty slot ends the search.
+INLINE SpecializedEval ProbeEndgame(Key materialKey) {
+    for (int i = EndgameIndex(materialKey); EndgameTable[i].evalFunc; i = (i + 1) & (ENDGAME_TABLE_SIZE - 1))
+        if (EndgameTable[i].key == materialKey)
+            return EndgameTable[i].evalFunc;
+    return NULL;
+}
@@ -24,6 +24,11 @@
 #include "endgame.h"
 
 
+#ifdef SIMD_EVAL
+#include <immintrin.h>
+#endif
+
+
 typedef struct EvalInfo {
     Bitboard attackedBy[COLOR_NB][TYPE_NB];
     Bitboard passedPawns;
@@ -53,6 +58,9 @@ const int PieceValue[2][PIECE_NB] = {
 // Bonus for being the side to move
 const int Tempo = 18;
 
+// Margin beyond which the terms skipped by lazy eval are assumed unable to bring the eval back
+const int LazyMargin = 1000;
+
 // Misc bonuses and maluses
 const int PawnDoubled  = S(-11,-48);
 const int PawnDoubled2 = S(-10,-25);
@@ -142,15 +150,15 @@ const int CheckPower[4]  = { 68, 44, 88, 92 };
 const int CountModifier[8] = { 0, 0, 63, 126, 96, 124, 124, 128 };
 
 
-// Evaluates pawns
-INLINE int EvalPawns(const Position *pos, EvalInfo *ei, const Color color) {
+// Evaluates pawn structure terms that only depend on counts
+INLINE int EvalPawnStructure(const Position *pos, const EvalInfo *ei, const Color color) {
 
     const Direction down = color == WHITE ? SOUTH : NORTH;
 
     int count, eval = 0;
 
     Bitboard pawns = colorPieceBB(color, PAWN);
-    Bitboard pawnAttacks = PawnBBAttackBB(pawns, color);
+    Bitboard pawnAttacks = ei->attackedBy[color][PAWN];
 
     // Doubled pawns (one directly in front of the other)
     count = PopCount(pawns & ShiftBB(pawns, NORTH));
@@ -173,6 +181,17 @@ INLINE int EvalPawns(const Position *pos, EvalInfo *ei, const Color color) {
     eval += PawnOpen * count;
     TraceCount(PawnOpen);
 
+    return eval;
+}
+
+// Evaluates pawns
+INLINE int EvalPawns(const Position *pos, EvalInfo *ei, const Color color) {
+
+    int eval = 0;
+
+    Bitboard pawns = colorPieceBB(color, PAWN);
+    Bitboard pawnAttacks = ei->attackedBy[color][PAWN];
+
     // Phalanx
     Bitboard phalanx = pawns & ShiftBB(pawns, WEST);
     while (phalanx) {
@@ -215,24 +234,6 @@ INLINE int EvalPawns(const Position *pos, EvalInfo *ei, const Color color) {
     return eval;
 }
 
-// Tries to get pawn eval from cache, otherwise evaluates and saves
-static int ProbePawnCache(const Position *pos, EvalInfo *ei, PawnCache pc) {
-
-    // Can't cache when tuning as full trace is needed
-    if (TRACE) return EvalPawns(pos, ei, WHITE) - EvalPawns(pos, ei, BLACK);
-
-    Key key = pos->pawnKey;
-    PawnEntry *pe = &pc[key % PAWN_CACHE_SIZE];
-
-    if (pe->key != key) {
-        pe->key  = key;
-        pe->eval = EvalPawns(pos, ei, WHITE) - EvalPawns(pos, ei, BLACK);
-        pe->passedPawns = ei->passedPawns;
-    }
-
-    return ei->passedPawns = pe->passedPawns, pe->eval;
-}
-
 // Evaluates knights, bishops, rooks, or queens
 INLINE int EvalPiece(const Position *pos, EvalInfo *ei, const Color color, const PieceType pt) {
 
@@ -425,19 +426,18 @@ INLINE int EvalPassedPawns(const Position *pos, const EvalInfo *ei, const Color
     return eval;
 }
 
-// Evaluates threats
-INLINE int EvalThreats(const Position *pos, const EvalInfo *ei, const Color color) {
+// Evaluates threats by pawns
+INLINE int EvalPawnThreats(const Position *pos, const EvalInfo *ei, const Color color) {
 
     const Direction up = color == WHITE ? NORTH : SOUTH;
 
     int count, eval = 0;
-    Bitboard threats;
 
     // Our pawns threatening their non-pawns
     Bitboard ourPawns = colorPieceBB(color, PAWN);
     Bitboard theirNonPawns = colorBB(!color) ^ colorPieceBB(!color, PAWN);
 
-    count = PopCount(PawnBBAttackBB(ourPawns, color) & theirNonPawns);
+    count = PopCount(ei->attackedBy[color][PAWN] & theirNonPawns);
     eval += PawnThreat * count;
     TraceCount(PawnThreat);
 
@@ -448,7 +448,17 @@ INLINE int EvalThreats(const Position *pos, const EvalInfo *ei, const Color colo
     eval += PushThreat * count;
     TraceCount(PushThreat);
 
+    return eval;
+}
+
+// Evaluates threats by pieces
+INLINE int EvalThreats(const Position *pos, const EvalInfo *ei, const Color color) {
+
+    Bitboard threats;
+    int eval = 0;
+
     // Threats by minor pieces
+    Bitboard theirNonPawns = colorBB(!color) ^ colorPieceBB(!color, PAWN);
     Bitboard targets = theirNonPawns & ~pieceBB(KING);
     threats = targets & (ei->attackedBy[color][KNIGHT] | ei->attackedBy[color][BISHOP]);
     while (threats) {
@@ -495,6 +505,157 @@ INLINE void InitEvalInfo(const Position *pos, EvalInfo *ei, const Color color) {
     ei->attackedBy[color][ALL] = ei->attackedBy[color][KING] | ei->attackedBy[color][PAWN];
 }
 
+#ifdef SIMD_EVAL
+
+// A pair of bitboards, white in lane 0 and black in lane 1
+typedef Bitboard Bitboard2 __attribute__((vector_size(16)));
+
+INLINE Bitboard2 Pair(const Bitboard white, const Bitboard black) {
+    return (Bitboard2) { white, black };
+}
+
+// Swaps the lanes, giving each color the bitboard of the other
+INLINE Bitboard2 Swap(const Bitboard2 bb) {
+    return __builtin_shuffle(bb, Pair(1, 0));
+}
+
+// Shifts each lane n ranks forward/backward as seen by that color
+INLINE Bitboard2 ShiftUp2(const Bitboard2 bb, const int n) {
+    return (bb << Pair(8 * n, 0)) >> Pair(0, 8 * n);
+}
+
+INLINE Bitboard2 ShiftDown2(const Bitboard2 bb, const int n) {
+    return (bb >> Pair(8 * n, 0)) << Pair(0, 8 * n);
+}
+
+INLINE Bitboard2 FillDown2(Bitboard2 bb) {
+    bb |= ShiftDown2(bb, 1);
+    bb |= ShiftDown2(bb, 2);
+    bb |= ShiftDown2(bb, 4);
+    return bb;
+}
+
+// Squares diagonally forward/backward of the pawns of each color
+INLINE Bitboard2 Sideways2(const Bitboard2 bb) {
+    return ((bb & ~fileABB) >> 1) | ((bb & ~fileHBB) << 1);
+}
+
+INLINE Bitboard2 PawnAttackBB2(const Bitboard2 pawns) {
+    return Sideways2(ShiftUp2(pawns, 1));
+}
+
+// Population count of the white lane minus that of the black lane
+INLINE int PopCountDiff(const Bitboard2 bb) {
+#if defined(__AVX512VPOPCNTDQ__) && defined(__AVX512VL__)
+    const Bitboard2 count = (Bitboard2)_mm_popcnt_epi64((__m128i)bb);
+    return (int)count[WHITE] - (int)count[BLACK];
+#else
+    return PopCount(bb[WHITE]) - PopCount(bb[BLACK]);
+#endif
+}
+
+// Initializes the eval info struct for both colors
+INLINE void InitEvalInfoSIMD(const Position *pos, EvalInfo *ei) {
+
+    const Bitboard2 occupied = Pair(pieceBB(ALL), pieceBB(ALL));
+    const Bitboard2 pawns = Pair(colorPieceBB(WHITE, PAWN), colorPieceBB(BLACK, PAWN));
+    const Bitboard2 pawnAttacks = PawnAttackBB2(pawns);
+    const Bitboard2 kingAttacks = Pair(AttackBB(KING, kingSq(WHITE), 0), AttackBB(KING, kingSq(BLACK), 0));
+
+    // Mobility area is defined as any square not attacked by an enemy pawn, nor
+    // occupied by our own pawn either on its starting square or blocked from advancing.
+    const Bitboard2 b = pawns & (Pair(rank2BB, rank7BB) | ShiftDown2(occupied, 1));
+    const Bitboard2 mobilityArea = ~(b | Swap(pawnAttacks));
+    const Bitboard2 attacked = kingAttacks | pawnAttacks;
+
+    for (Color color = WHITE; color <= BLACK; ++color) {
+        ei->mobilityArea[color] = mobilityArea[color];
+        ei->kingZone[color] = kingAttacks[color];
+        ei->attackPower[color] = -30;
+        ei->attackCount[color] = 0;
+        ei->attackedBy[color][KING] = kingAttacks[color];
+        ei->attackedBy[color][PAWN] = pawnAttacks[color];
+        ei->attackedBy[color][ALL]  = attacked[color];
+    }
+
+    // Clear passed pawns, filled in during pawn eval
+    ei->passedPawns = 0;
+}
+
+// Evaluates pawn structure terms that only depend on counts for both colors
+INLINE int EvalPawnStructureSIMD(const Position *pos, const EvalInfo *ei) {
+
+    const Bitboard2 pawns = Pair(colorPieceBB(WHITE, PAWN), colorPieceBB(BLACK, PAWN));
+    const Bitboard2 pawnAttacks = Pair(ei->attackedBy[WHITE][PAWN], ei->attackedBy[BLACK][PAWN]);
+    const Bitboard2 open = ~FillDown2(Swap(pawns));
+
+    return  PawnDoubled  * PopCountDiff(pawns & (pawns << 8))
+          + PawnDoubled2 * PopCountDiff(pawns & (pawns << 16))
+          + PawnSupport  * PopCountDiff(pawns & Sideways2(ShiftDown2(pawns, 1)))
+          + PawnOpen     * PopCountDiff(pawns & open & ~pawnAttacks);
+}
+
+// Evaluates threats by pawns for both colors
+INLINE int EvalPawnThreatsSIMD(const Position *pos, const EvalInfo *ei) {
+
+    const Bitboard2 pawns = Pair(colorPieceBB(WHITE, PAWN), colorPieceBB(BLACK, PAWN));
+    const Bitboard2 pawnAttacks = Pair(ei->attackedBy[WHITE][PAWN], ei->attackedBy[BLACK][PAWN]);
+    const Bitboard2 theirNonPawns = Swap(Pair(colorBB(WHITE), colorBB(BLACK)) ^ pawns);
+    const Bitboard2 pawnPushes = ShiftUp2(pawns, 1) & ~pieceBB(ALL);
+
+    return  PawnThreat * PopCountDiff(pawnAttacks & theirNonPawns)
+          + PushThreat * PopCountDiff(PawnAttackBB2(pawnPushes) & theirNonPawns);
+}
+
+#endif
+
+// The terms with a vector version use it when simd is set
+INLINE void InitEvalInfoBoth(const Position *pos, EvalInfo *ei, const bool simd) {
+#ifdef SIMD_EVAL
+    if (simd) return InitEvalInfoSIMD(pos, ei);
+#else
+    (void)simd;
+#endif
+    InitEvalInfo(pos, ei, WHITE);
+    InitEvalInfo(pos, ei, BLACK);
+}
+
+INLINE int EvalPawnStructureBoth(const Position *pos, const EvalInfo *ei, const bool simd) {
+#ifdef SIMD_EVAL
+    if (simd) return EvalPawnStructureSIMD(pos, ei);
+#else
+    (void)simd;
+#endif
+    return EvalPawnStructure(pos, ei, WHITE) - EvalPawnStructure(pos, ei, BLACK);
+}
+
+INLINE int EvalPawnThreatsBoth(const Position *pos, const EvalInfo *ei, const bool simd) {
+#ifdef SIMD_EVAL
+    if (simd) return EvalPawnThreatsSIMD(pos, ei);
+#else
+    (void)simd;
+#endif
+    return EvalPawnThreats(pos, ei, WHITE) - EvalPawnThreats(pos, ei, BLACK);
+}
+
+// Tries to get pawn eval from cache, otherwise evaluates and saves
+INLINE int ProbePawnCache(const Position *pos, EvalInfo *ei, PawnCache pc, const bool simd) {
+
+    // Can't cache when tuning as full trace is needed
+    if (TRACE) return EvalPawns(pos, ei, WHITE) - EvalPawns(pos, ei, BLACK) + EvalPawnStructureBoth(pos, ei, simd);
+
+    Key key = pos->pawnKey;
+    PawnEntry *pe = &pc[key % PAWN_CACHE_SIZE];
+
+    if (pe->key != key) {
+        pe->key  = key;
+        pe->eval = EvalPawns(pos, ei, WHITE) - EvalPawns(pos, ei, BLACK) + EvalPawnStructureBoth(pos, ei, simd);
+        pe->passedPawns = ei->passedPawns;
+    }
+
+    return ei->passedPawns = pe->passedPawns, pe->eval;
+}
+
 // Calculate scale factor to lower overall eval based on various features
 static int ScaleFactor(const Position *pos, const int eval) {
 
@@ -522,23 +683,46 @@ static int ScaleFactor(const Position *pos, const int eval) {
     return pawnScale;
 }
 
-// Calculate a static evaluation of a position
-int EvalPosition(const Position *pos, PawnCache pc) {
+// Scales and tapers the eval, and returns it from the side to move's point of view
+INLINE int TaperedEval(const Position *pos, int eval, const int scale) {
+
+    // Adjust score by phase
+    eval = (  MgScore(eval) * pos->phase
+            + EgScore(eval) * (MidGame - pos->phase) * scale / 128)
+          / MidGame;
 
-    Endgame *eg = &EndgameTable[EndgameIndex(pos->materialKey)];
+    // Return the evaluation, negated if we are black + tempo bonus
+    return (sideToMove == WHITE ? eval : -eval) + Tempo;
+}
+
+// Calculate a static evaluation of a position, stopping early if the
+// result is sure to be far outside the alpha-beta window (sets lazy)
+INLINE int Evaluate(const Position *pos, PawnCache pc, const int alpha, const int beta, bool *lazy, const bool simd) {
 
-    if (eg->key == pos->materialKey && eg->evalFunc != NULL)
-        return eg->evalFunc(pos, sideToMove);
+    *lazy = false;
+
+    SpecializedEval egEval = ProbeEndgame(pos->materialKey);
+
+    if (egEval != NULL)
+        return egEval(pos, sideToMove);
 
     EvalInfo ei;
-    InitEvalInfo(pos, &ei, WHITE);
-    InitEvalInfo(pos, &ei, BLACK);
+    InitEvalInfoBoth(pos, &ei, simd);
 
     // Material (includes PSQT) + trend
     int eval = pos->material + pos->trend;
 
     // Evaluate pawns
-    eval += ProbePawnCache(pos, &ei, pc);
+    eval += ProbePawnCache(pos, &ei, pc, simd);
+
+    // Lazy eval - skip the remaining terms when they are unlikely to change the outcome.
+    // Only with a window, full evals would pay for the scale factor twice.
+    // The tuner always needs the full trace.
+    if (!TRACE && (alpha > -INFINITE || beta < INFINITE)) {
+        int partial = TaperedEval(pos, eval, ScaleFactor(pos, eval));
+        if (partial - LazyMargin >= beta || partial + LazyMargin <= alpha)
+            return *lazy = true, partial;
+    }
 
     // Evaluate pieces
     eval += EvalPieces(pos, &ei);
@@ -548,7 +732,8 @@ int EvalPosition(const Position *pos, PawnCache pc) {
            - EvalPassedPawns(pos, &ei, BLACK);
 
     // Evaluate threats
-    eval +=  EvalThreats(pos, &ei, WHITE)
+    eval +=  EvalPawnThreatsBoth(pos, &ei, simd)
+           + EvalThreats(pos, &ei, WHITE)
            - EvalThreats(pos, &ei, BLACK);
 
     TraceEval(eval);
@@ -557,11 +742,77 @@ int EvalPosition(const Position *pos, PawnCache pc) {
     int scale = ScaleFactor(pos, eval);
     TraceScale(scale);
 
-    // Adjust score by phase
-    eval = (  MgScore(eval) * pos->phase
-            + EgScore(eval) * (MidGame - pos->phase) * scale / 128)
-          / MidGame;
+    return TaperedEval(pos, eval, scale);
+}
 
-    // Return the evaluation, negated if we are black + tempo bonus
-    return (sideToMove == WHITE ? eval : -eval) + Tempo;
+#if defined(SIMD_EVAL) && !defined(__AVX2__)
+// A copy of the eval compiled for AVX2, for generic builds running on cpus that have it
+__attribute__((target("avx2,popcnt")))
+static int EvaluateAVX2(const Position *pos, PawnCache pc, const int alpha, const int beta, bool *lazy) {
+    return Evaluate(pos, pc, alpha, beta, lazy, true);
+}
+#endif
+
+// Picks the eval for the instruction set, known at compile time unless this is a generic build
+INLINE int EvaluateDispatch(const Position *pos, PawnCache pc, const int alpha, const int beta, bool *lazy) {
+#if defined(SIMD_EVAL) && defined(__AVX2__)
+    return Evaluate(pos, pc, alpha, beta, lazy, true);
+#elif defined(SIMD_EVAL)
+    return HasAVX2 ? EvaluateAVX2(pos, pc, alpha, beta, lazy)
+                   : Evaluate(pos, pc, alpha, beta, lazy, false);
+#else
+    return Evaluate(pos, pc, alpha, beta, lazy, false);
+#endif
+}
+
+#ifdef SIMD_EVAL
+// Checks that the vector terms and the whole eval are identical to the scalar ones in the position
+bool SIMDEvalMatches(const Position *pos) {
+
+    EvalInfo simd, scalar;
+    InitEvalInfoSIMD(pos, &simd);
+    InitEvalInfo(pos, &scalar, WHITE);
+    InitEvalInfo(pos, &scalar, BLACK);
+
+    bool match = true;
+
+    for (Color color = WHITE; color <= BLACK; ++color)
+        match &=   simd.mobilityArea[color]     == scalar.mobilityArea[color]
+                && simd.kingZone[color]         == scalar.kingZone[color]
+                && simd.attackPower[color]      == scalar.attackPower[color]
+                && simd.attackCount[color]      == scalar.attackCount[color]
+                && simd.attackedBy[color][KING] == scalar.attackedBy[color][KING]
+                && simd.attackedBy[color][PAWN] == scalar.attackedBy[color][PAWN]
+                && simd.attackedBy[color][ALL]  == scalar.attackedBy[color][ALL];
+
+    match &=   EvalPawnStructureSIMD(pos, &scalar) == EvalPawnStructure(pos, &scalar, WHITE) - EvalPawnStructure(pos, &scalar, BLACK)
+            && EvalPawnThreatsSIMD(pos, &scalar)   == EvalPawnThreats(pos, &scalar, WHITE)   - EvalPawnThreats(pos, &scalar, BLACK);
+
+    // The whole eval, through the AVX2 copy where the search would use it.
+    // Separate pawn caches so neither side reuses the other's pawn eval.
+    static PawnCache simdCache, scalarCache;
+    bool lazy;
+#ifdef __AVX2__
+    int simdEval = Evaluate(pos, simdCache, -INFINITE, INFINITE, &lazy, true);
+#else
+    int simdEval = HasAVX2 ? EvaluateAVX2(pos, simdCache, -INFINITE, INFINITE, &lazy)
+                           : Evaluate(pos, simdCache, -INFINITE, INFINITE, &lazy, true);
+#endif
+
+    return match && simdEval == Evaluate(pos, scalarCache, -INFINITE, INFINITE, &lazy, false);
+}
+
+#endif
+
+// Calculate a static evaluation of a position
+int EvalPosition(const Position *pos, PawnCache pc) {
+    bool lazy;
+    return EvaluateDispatch(pos, pc, -INFINITE, INFINITE, &lazy);
+}
+
+// Calculate a static evaluation of a position, which is inexact if it is
+// far outside the alpha-beta window. Such lazy evals are only good for
+// deciding cutoffs and must not be stored or reused.
+int EvalPositionBounded(const Position *pos, PawnCache pc, int alpha, int beta, bool *lazy) {
+    return EvaluateDispatch(pos, pc, alpha, beta, lazy);
 }
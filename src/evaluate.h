@@ -24,6 +24,13 @@
 
 #define PAWN_CACHE_SIZE 128 * 1024
 
+// Evaluate both colors side by side in vector lanes where AVX2 is available,
+// generic x86-64 builds carry an AVX2 compiled copy of the eval picked at
+// startup. The tuner traces each color separately and always uses the scalar path.
+#if defined(__x86_64__) && !defined(TUNE) && !defined(NO_SIMD_EVAL)
+#define SIMD_EVAL
+#endif
+
 typedef struct PawnEntry {
     Key key;
     Bitboard passedPawns;
@@ -54,6 +61,10 @@ INLINE int UpdatePhase(int value) {
 
 // Returns a static evaluation of the position from the side to move's point of view
 int EvalPosition(const Position *pos, PawnCache pc);
+int EvalPositionBounded(const Position *pos, PawnCache pc, int alpha, int beta, bool *lazy);
+#ifdef SIMD_EVAL
+bool SIMDEvalMatches(const Position *pos);
+#endif
 
 // Returns a static evaluation of the position from whites point of view
 INLINE int EvalPositionWhitePov(const Position *pos, PawnCache pc) {
@@ -26,15 +26,15 @@
 #include "types.h"
 
 
-#define QuietEntry(move)        (&thread->history[thread->pos.stm][fromSq(move)][toSq(move)])
-#define PawnEntry(move)         (&thread->pawnHistory[PawnStructure(&thread->pos)][piece(move)][toSq(move)])
+#define QuietEntry(move)        (&thread->history[thread->pos->stm][fromSq(move)][toSq(move)])
+#define PawnEntry(move)         (&thread->pawnHistory[PawnStructure(thread->pos)][piece(move)][toSq(move)])
 #define NoisyEntry(move)        (&thread->captureHistory[piece(move)][toSq(move)][PieceTypeOf(capturing(move))])
 #define ContEntry(offset, move) (&(*(ss-offset)->continuation)[piece(move)][toSq(move)])
-#define PawnCorrEntry()         (&thread->pawnCorrHistory[thread->pos.stm][PawnCorrIndex(&thread->pos)])
-#define MinorCorrEntry()        (&thread->minorCorrHistory[thread->pos.stm][MinorCorrIndex(&thread->pos)])
-#define MajorCorrEntry()        (&thread->majorCorrHistory[thread->pos.stm][MajorCorrIndex(&thread->pos)])
-#define ContCorrEntry(offset)   (&(*(ss-offset)->contCorr)[piece((ss-1)->move)][toSq((ss-1)->move)])
-#define NonPawnCorrEntry(color) (&thread->nonPawnCorrHistory[color][thread->pos.stm][NonPawnCorrIndex(&thread->pos, color)])
+#define PawnCorrEntry()         (&thread->pawnCorrHistory[thread->pos->stm][PawnCorrIndex(thread->pos)])
+#define MinorCorrEntry()        (&thread->minorCorrHistory[thread->pos->stm][MinorCorrIndex(thread->pos)])
+#define MajorCorrEntry()        (&thread->majorCorrHistory[thread->pos->stm][MajorCorrIndex(thread->pos)])
+#define ContCorrEntry(offset)   (&(*(ss-offset)->contCorr)[LastMoved(ss)][toSq((ss-1)->move)])
+#define NonPawnCorrEntry(color) (&thread->nonPawnCorrHistory[color][thread->pos->stm][NonPawnCorrIndex(thread->pos, color)])
 
 #define QuietHistoryUpdate(move, bonus)        (HistoryBonus(QuietEntry(move),        bonus,  4373))
 #define PawnHistoryUpdate(move, bonus)         (HistoryBonus(PawnEntry(move),         bonus,  8663))
@@ -53,6 +53,9 @@ INLINE int MinorCorrIndex(const Position *pos) { return pos->minorKey & (CORRECT
 INLINE int MajorCorrIndex(const Position *pos) { return pos->majorKey & (CORRECTION_HISTORY_SIZE - 1); }
 INLINE int NonPawnCorrIndex(const Position *pos, Color c) { return pos->nonPawnKey[c] & (CORRECTION_HISTORY_SIZE - 1); }
 
+// The piece that made the previous move, which now stands on its destination
+#define LastMoved(ss) ((ss-1)->move ? pieceOn(toSq((ss-1)->move)) : EMPTY)
+
 
 INLINE void HistoryBonus(int16_t *entry, int bonus, int div) {
     assert(abs(bonus) <= div);
@@ -72,7 +75,8 @@ INLINE int CorrectionBonus(int score, int eval, Depth depth) {
     return CLAMP((score - eval) * depth / 4, -172, 289);
 }
 
-INLINE void UpdateContHistories(Stack *ss, Move move, int bonus) {
+INLINE void UpdateContHistories(const Thread *thread, Stack *ss, Move move, int bonus) {
+    const Position *pos = thread->pos;
     ContHistoryUpdate(1, move, bonus);
     ContHistoryUpdate(2, move, bonus);
     ContHistoryUpdate(4, move, bonus);
@@ -80,6 +84,7 @@ INLINE void UpdateContHistories(Stack *ss, Move move, int bonus) {
 
 // Updates history heuristics when a quiet move is the best move
 INLINE void UpdateQuietHistory(Thread *thread, Stack *ss, Move bestMove, Depth depth, Move quiets[], int qCount) {
+    const Position *pos = thread->pos;
 
     int bonus = Bonus(depth);
     int malus = Malus(depth);
@@ -91,19 +96,20 @@ INLINE void UpdateQuietHistory(Thread *thread, Stack *ss, Move bestMove, Depth d
     if (depth > 2) {
         QuietHistoryUpdate(bestMove, bonus);
         PawnHistoryUpdate(bestMove, bonus);
-        UpdateContHistories(ss, bestMove, bonus);
+        UpdateContHistories(thread, ss, bestMove, bonus);
     }
 
     // Penalize quiet moves that failed to produce a cut
     for (Move *move = quiets; move < quiets + qCount; ++move) {
         QuietHistoryUpdate(*move, malus);
         PawnHistoryUpdate(*move, malus);
-        UpdateContHistories(ss, *move, malus);
+        UpdateContHistories(thread, ss, *move, malus);
     }
 }
 
 // Updates history heuristics
 INLINE void UpdateHistory(Thread *thread, Stack *ss, Move bestMove, Depth depth, Move quiets[], int qCount, Move noisys[], int nCount) {
+    const Position *pos = thread->pos;
 
     int bonus = Bonus(depth);
     int malus = Malus(depth);
@@ -122,6 +128,7 @@ INLINE void UpdateHistory(Thread *thread, Stack *ss, Move bestMove, Depth depth,
 }
 
 INLINE void UpdateCorrectionHistory(Thread *thread, Stack *ss, int bestScore, int eval, Depth depth) {
+    const Position *pos = thread->pos;
     int bonus = CorrectionBonus(bestScore, eval, depth);
     PawnCorrHistoryUpdate(bonus);
     MinorCorrHistoryUpdate(bonus);
@@ -137,6 +144,7 @@ INLINE void UpdateCorrectionHistory(Thread *thread, Stack *ss, int bestScore, in
 }
 
 INLINE int GetQuietHistory(const Thread *thread, Stack *ss, Move move) {
+    const Position *pos = thread->pos;
     return  *QuietEntry(move)
           + *PawnEntry(move)
           + *ContEntry(1, move)
@@ -145,14 +153,17 @@ INLINE int GetQuietHistory(const Thread *thread, Stack *ss, Move move) {
 }
 
 INLINE int GetCaptureHistory(const Thread *thread, Move move) {
+    const Position *pos = thread->pos;
     return *NoisyEntry(move);
 }
 
 INLINE int GetHistory(const Thread *thread, Stack *ss, Move move) {
+    const Position *pos = thread->pos;
     return moveIsQuiet(move) ? GetQuietHistory(thread, ss, move) : GetCaptureHistory(thread, move);
 }
 
 INLINE int GetCorrectionHistory(const Thread *thread, const Stack *ss) {
+    const Position *pos = thread->pos;
     int c =  5868 * *PawnCorrEntry()
            + 7217 * *MinorCorrEntry()
            + 4416 * *MajorCorrEntry()
@@ -16,6 +16,8 @@
   along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
+#include <string.h>
+
 #include "bitboard.h"
 #include "board.h"
 #include "evaluate.h"
@@ -31,6 +33,30 @@
 #define HASH_EP             (pos->key ^= PieceKeys[EMPTY][pos->epSquare])
 
 
+#ifdef USE_ATTACK_MAPS
+// Toggle the attacks of the piece on sq in the attack maps
+static void ToggleAttacks(Position *pos, const Square sq, Bitboard attacks) {
+
+    pos->attacks[sq] ^= attacks;
+
+    while (attacks)
+        pos->attackersTo[PopLsb(&attacks)] ^= BB(sq);
+}
+
+// Update the attacks of sliders whose rays pass through a square that changed occupancy
+static void UpdateSliders(Position *pos, const Square sq) {
+
+    Bitboard sliders = pos->attackersTo[sq] & (pieceBB(BISHOP) | pieceBB(ROOK) | pieceBB(QUEEN));
+
+    while (sliders) {
+        Square slider = PopLsb(&sliders);
+        Bitboard attacks = AttackBB(pieceTypeOn(slider), slider, pieceBB(ALL));
+        ToggleAttacks(pos, slider, attacks ^ pos->attacks[slider]);
+    }
+}
+#endif
+
+
 // Remove a piece from a square sq
 static void ClearPiece(Position *pos, const Square sq, const bool hash) {
 
@@ -58,6 +84,10 @@ static void ClearPiece(Position *pos, const Square sq, const bool hash) {
             pos->minorKey ^= PieceKeys[piece][sq];
     }
 
+#ifdef USE_ATTACK_MAPS
+    ToggleAttacks(pos, sq, pos->attacks[sq]);
+#endif
+
     // Set square to empty
     pieceOn(sq) = EMPTY;
 
@@ -76,6 +106,10 @@ static void ClearPiece(Position *pos, const Square sq, const bool hash) {
     pieceBB(pt)    ^= BB(sq);
     colorBB(color) ^= BB(sq);
 
+#ifdef USE_ATTACK_MAPS
+    UpdateSliders(pos, sq);
+#endif
+
     pos->materialKey ^= PieceKeys[piece][PieceCount(pos, piece)];
 }
 
@@ -122,6 +156,11 @@ static void AddPiece(Position *pos, const Square sq, const Piece piece, const bo
     pieceBB(ALL)   |= BB(sq);
     pieceBB(pt)    |= BB(sq);
     colorBB(color) |= BB(sq);
+
+#ifdef USE_ATTACK_MAPS
+    UpdateSliders(pos, sq);
+    ToggleAttacks(pos, sq, PieceAttackBB(piece, sq, pieceBB(ALL)));
+#endif
 }
 
 // Move a piece from one square to another
@@ -153,6 +192,10 @@ static void MovePiece(Position *pos, const Square from, const Square to, const b
             pos->minorKey ^= PieceKeys[piece][from] ^ PieceKeys[piece][to];
     }
 
+#ifdef USE_ATTACK_MAPS
+    ToggleAttacks(pos, from, pos->attacks[from]);
+#endif
+
     // Set old square to empty, new to piece
     pieceOn(from) = EMPTY;
     pieceOn(to)   = piece;
@@ -164,11 +207,24 @@ static void MovePiece(Position *pos, const Square from, const Square to, const b
     pieceBB(ALL)   ^= BB(from) ^ BB(to);
     pieceBB(pt)    ^= BB(from) ^ BB(to);
     colorBB(color) ^= BB(from) ^ BB(to);
+
+#ifdef USE_ATTACK_MAPS
+    UpdateSliders(pos, from);
+    UpdateSliders(pos, to);
+    ToggleAttacks(pos, to, PieceAttackBB(piece, to, pieceBB(ALL)));
+#endif
 }
 
 // Take back the previous move
-void TakeMove(Position *pos) {
+Position *TakeMove(Position *pos) {
+
+#ifdef COPY_MAKE
+    // The parent is untouched, only the node count is carried back
+    (pos-1)->nodes = pos->nodes;
 
+    assert(PositionOk(pos-1));
+    return pos - 1;
+#else
     // Incremental updates
     pos->histPly--;
     sideToMove ^= 1;
@@ -199,16 +255,15 @@ void TakeMove(Position *pos) {
     MovePiece(pos, to, from, false);
 
     // Add back captured piece if any
-    Piece capt = capturing(move);
+    Piece capt = history(0).capture;
     if (capt != EMPTY) {
         assert(ValidCapture(capt));
         AddPiece(pos, to, capt, false);
     }
 
     // Remove promoted piece and put back the pawn
-    Piece promo = promotion(move);
-    if (promo != EMPTY) {
-        assert(ValidPromotion(promo));
+    if (promotion(move)) {
+        assert(ValidPromotion(pieceOn(from)));
         ClearPiece(pos, from, false);
         AddPiece(pos, from, MakePiece(sideToMove, PAWN), false);
     }
@@ -219,26 +274,37 @@ done:
     pos->key            = history(0).key;
     pos->materialKey    = history(0).materialKey;
     pos->checkers       = history(0).checkers;
+    pos->pinned         = history(0).pinned;
     pos->epSquare       = history(0).epSquare;
     pos->rule50         = history(0).rule50;
     pos->castlingRights = history(0).castlingRights;
 
     assert(PositionOk(pos));
+    return pos;
+#endif
 }
 
-// Make a move - take it back and return false if move was illegal
-void MakeMove(Position *pos, const Move move) {
+// Make a move, returning the position after it
+Position *MakeMove(Position *pos, const Move move) {
 
     TTPrefetch(KeyAfter(pos, move));
 
     // Save position
     history(0).key            = pos->key;
+    history(0).move           = move;
+    history(0).capture        = moveIsCastle(move) ? EMPTY : capturing(move);
+#ifdef COPY_MAKE
+    // Make the move in a copy of the position
+    memcpy(pos + 1, pos, sizeof(Position));
+    pos++;
+#else
     history(0).materialKey    = pos->materialKey;
     history(0).checkers       = pos->checkers;
-    history(0).move           = move;
+    history(0).pinned         = pos->pinned;
     history(0).epSquare       = pos->epSquare;
     history(0).rule50         = pos->rule50;
     history(0).castlingRights = pos->castlingRights;
+#endif
 
     // Incremental updates
     pos->histPly++;
@@ -269,7 +335,7 @@ void MakeMove(Position *pos, const Move move) {
     }
 
     // Remove captured piece if any
-    Piece capt = capturing(move);
+    Piece capt = history(-1).capture;
     if (capt != EMPTY) {
         assert(ValidCapture(capt));
         ClearPiece(pos, to, true);
@@ -283,7 +349,7 @@ void MakeMove(Position *pos, const Move move) {
     if (pieceTypeOn(to) == PAWN) {
 
         pos->rule50 = 0;
-        Piece promo = promotion(move);
+        PieceType promo = promotion(move);
 
         // Set en passant square if applicable
         if (moveIsPStart(move)) {
@@ -299,10 +365,10 @@ void MakeMove(Position *pos, const Move move) {
             ClearPiece(pos, to ^ 8, true);
 
         // Replace promoting pawn with new piece
-        else if (promo != EMPTY) {
-            assert(ValidPromotion(promo));
+        else if (promo) {
+            assert(ValidPromotion(MakePiece(sideToMove, promo)));
             ClearPiece(pos, to, true);
-            AddPiece(pos, to, promo, true);
+            AddPiece(pos, to, MakePiece(sideToMove, promo), true);
         }
     }
 
@@ -313,20 +379,28 @@ done:
     HASH_SIDE;
 
     pos->checkers = Checkers(pos);
+    pos->pinned = Pinned(pos);
     pos->nodes++;
 
     assert(PositionOk(pos));
+    return pos;
 }
 
-// Pass the turn without moving
-void MakeNullMove(Position *pos) {
+// Pass the turn without moving, returning the position after it
+Position *MakeNullMove(Position *pos) {
 
     // Save misc info for takeback
     history(0).key            = pos->key;
     history(0).move           = NOMOVE;
+#ifdef COPY_MAKE
+    memcpy(pos + 1, pos, sizeof(Position));
+    pos++;
+#else
+    history(0).pinned         = pos->pinned;
     history(0).epSquare       = pos->epSquare;
     history(0).rule50         = pos->rule50;
     history(0).castlingRights = pos->castlingRights;
+#endif
 
     // Incremental updates
     pos->histPly++;
@@ -338,22 +412,32 @@ void MakeNullMove(Position *pos) {
     HASH_EP;
     pos->epSquare = 0;
 
+    pos->pinned = Pinned(pos);
+
     TTPrefetch(pos->key);
 
     assert(PositionOk(pos));
+    return pos;
 }
 
 // Take back a null move
-void TakeNullMove(Position *pos) {
+Position *TakeNullMove(Position *pos) {
 
+#ifdef COPY_MAKE
+    (pos-1)->nodes = pos->nodes;
+    return pos - 1;
+#else
     // Incremental updates
     pos->histPly--;
     sideToMove ^= 1;
 
     // Get info from history
     pos->key      = history(0).key;
+    pos->pinned   = history(0).pinned;
     pos->epSquare = history(0).epSquare;
     pos->rule50   = history(0).rule50;
 
     assert(PositionOk(pos));
+    return pos;
+#endif
 }
@@ -22,7 +22,12 @@
 #include "types.h"
 
 
-void MakeMove(Position *pos, Move move);
-void TakeMove(Position *pos);
-void MakeNullMove(Position *pos);
-void TakeNullMove(Position *pos);
+/* Moves are made and taken back in place, and the same position is returned.
+ * Copy-make builds (-DCOPY_MAKE) instead copy the position to the slot after it
+ * and make the move there, so taking it back is stepping back to the parent.
+ * Callers continue with the returned position, and keep room for one position
+ * per ply after the first. */
+Position *MakeMove(Position *pos, Move move);
+Position *TakeMove(Position *pos);
+Position *MakeNullMove(Position *pos);
+Position *TakeNullMove(Position *pos);
@@ -25,7 +25,8 @@
 #include "transposition.h"
 
 
-// Checks whether a move is pseudo-legal (assuming it is pseudo-legal in some position)
+// Checks whether a move is pseudo-legal. As moves don't store the pieces involved,
+// the move may have been made by a different piece type in some other position.
 bool MoveIsPseudoLegal(const Position *pos, const Move move) {
 
     if (!move) return false;
@@ -33,17 +34,26 @@ bool MoveIsPseudoLegal(const Position *pos, const Move move) {
     const Color color = sideToMove;
     const Square from = fromSq(move);
     const Square to = toSq(move);
+    const PieceType pt = pieceTypeOn(from);
 
     // Must move our own piece
-    if (ColorOf(piece(move)) != color)
+    if (piece(move) == EMPTY || ColorOf(piece(move)) != color)
         return false;
 
     // Castling
     if (moveIsCastle(move))
-        return CastleLegal(pos, to);
+        return   pt == KING
+              && (to == RelativeSquare(color, G1) || to == RelativeSquare(color, C1))
+              && CastleLegal(pos, to);
 
-    // Must move the specified piece and capture the specified piece (or not capture)
-    if (piece(move) != pieceOn(from) || capturing(move) != pieceOn(to))
+    // Can't capture our own pieces
+    if (capturing(move) != EMPTY && ColorOf(capturing(move)) == color)
+        return false;
+
+    // Only pawns have special moves other than castling, and
+    // pawns moving to the last rank must promote
+    if (pt != PAWN ? moveIsSpecial(move)
+                   : !promotion(move) != !(BB(to) & (rank1BB | rank8BB)))
         return false;
 
     // Filter some illegal moves due to check
@@ -62,13 +72,25 @@ bool MoveIsPseudoLegal(const Position *pos, const Move move) {
     }
 
     // Pawn moves
-    if (pieceTypeOn(from) == PAWN)
-        return  moveIsEnPas(move)  ? to == pos->epSquare
-              : moveIsPStart(move) ? pieceOn(to ^ 8) == EMPTY
-                                   : true;
+    if (pt == PAWN) {
+
+        const Direction up = color == WHITE ? NORTH : SOUTH;
+
+        if (moveIsEnPas(move))
+            return to == pos->epSquare && PawnAttackBB(color, from) & BB(to);
+
+        if (moveIsPStart(move))
+            return   to == from + 2 * up
+                  && RelativeRank(color, RankOf(from)) == RANK_2
+                  && pieceOn(from + up) == EMPTY
+                  && pieceOn(to) == EMPTY;
+
+        return PawnAttackBB(color, from) & BB(to) ? capturing(move) != EMPTY
+                                                   : to == from + up && capturing(move) == EMPTY;
+    }
 
     // All other moves
-    return BB(to) & AttackBB(pieceTypeOn(from), from, pieceBB(ALL));
+    return BB(to) & AttackBB(pt, from, pieceBB(ALL));
 }
 
 // Checks whether a move is legal
@@ -78,28 +100,32 @@ bool MoveIsLegal(const Position *pos, const Move move) {
     Color color = sideToMove;
     Square from = fromSq(move);
     Square to = toSq(move);
+    Square kingSq = kingSq(color);
 
-    Square kingSq = PieceTypeOf(pieceOn(from)) == KING ? to : (Square)kingSq(color);
+    // CastleLegal already checks the king path
+    if (moveIsCastle(move))
+        return true;
 
-    Bitboard occ = (pieceBB(ALL) ^ BB(from)) | BB(to);
-    Bitboard exclude = BB(to);
+    // The king can't move to an attacked square, including those
+    // behind it on the line of a checking slider
+    if (from == kingSq)
+        return !(colorBB(!color) & Attackers(pos, to, pieceBB(ALL) ^ BB(from)));
 
-    if (moveIsEnPas(move))
-        occ ^= BB(to ^ 8),
-        exclude ^= BB(to ^ 8);
+    // En passant removes two pieces from the same rank at once,
+    // which may expose the king in ways the pins don't cover
+    if (moveIsEnPas(move)) {
 
-    Bitboard bishops = colorBB(!color) & (pieceBB(BISHOP) | pieceBB(QUEEN));
-    Bitboard rooks   = colorBB(!color) & (pieceBB(ROOK)   | pieceBB(QUEEN));
+        Bitboard occ = pieceBB(ALL) ^ BB(from) ^ BB(to) ^ BB(to ^ 8);
 
-    Bitboard kingAttackers =
-        (  (PawnAttackBB(color, kingSq)   & colorPieceBB(!color, PAWN))
-         | (AttackBB(KING,   kingSq, occ) & colorPieceBB(!color, KING))
-         | (AttackBB(KNIGHT, kingSq, occ) & colorPieceBB(!color, KNIGHT))
-         | (AttackBB(BISHOP, kingSq, occ) & bishops)
-         | (AttackBB(ROOK,   kingSq, occ) & rooks));
+        Bitboard bishops = colorBB(!color) & (pieceBB(BISHOP) | pieceBB(QUEEN));
+        Bitboard rooks   = colorBB(!color) & (pieceBB(ROOK)   | pieceBB(QUEEN));
 
-    // If any non-excluded piece is attacking the king, the move is illegal
-    return !(kingAttackers & ~exclude);
+        return !(  (AttackBB(BISHOP, kingSq, occ) & bishops)
+                 | (AttackBB(ROOK,   kingSq, occ) & rooks));
+    }
+
+    // Pinned pieces can only move along the pin
+    return !(pos->pinned & BB(from)) || LineBB[kingSq][from] & BB(to);
 }
 
 // Translates a move to a string
@@ -109,11 +135,11 @@ char *MoveToStr(const Move move) {
 
     SqToStr(fromSq(move), moveStr);
     SqToStr(  toSq(move), moveStr + 2);
-    moveStr[4] = "\0.nbrq"[PieceTypeOf(promotion(move))];
+    moveStr[4] = "\0.nbrq"[promotion(move)];
 
     // Encode castling as KxR for chess 960
     if (Chess960 && moveIsCastle(move)) {
-        int color = ColorOf(piece(move)) == WHITE ? WHITE_CASTLE : BLACK_CASTLE;
+        int color = RankOf(toSq(move)) == RANK_1 ? WHITE_CASTLE : BLACK_CASTLE;
         int side = FileOf(toSq(move)) == FILE_G ? OO : OOO;
         SqToStr(RookSquare[color & side], moveStr + 2);
     }
@@ -127,15 +153,13 @@ Move ParseMove(const char *str, const Position *pos) {
     Square from = StrToSq(str);
     Square to   = StrToSq(str+2);
 
-    Piece promo = str[4] == 'q' ? MakePiece(sideToMove, QUEEN)
-                : str[4] == 'n' ? MakePiece(sideToMove, KNIGHT)
-                : str[4] == 'r' ? MakePiece(sideToMove, ROOK)
-                : str[4] == 'b' ? MakePiece(sideToMove, BISHOP)
-                                : 0;
-
     PieceType pt = pieceTypeOn(from);
 
-    int flag = pt == KING && Distance(from, to) > 1           ? FLAG_CASTLE
+    int flag = str[4] == 'q'                                  ? PromoFlag(QUEEN)
+             : str[4] == 'n'                                  ? PromoFlag(KNIGHT)
+             : str[4] == 'r'                                  ? PromoFlag(ROOK)
+             : str[4] == 'b'                                  ? PromoFlag(BISHOP)
+             : pt == KING && Distance(from, to) > 1           ? FLAG_CASTLE
              : pt == PAWN && Distance(from, to) > 1           ? FLAG_PAWNSTART
              : pt == PAWN && str[0] != str[2] && !pieceOn(to) ? FLAG_ENPAS
                                                               : 0;
@@ -145,7 +169,7 @@ Move ParseMove(const char *str, const Position *pos) {
         flag = FLAG_CASTLE;
     }
 
-    return MOVE(from, to, pieceOn(from), pieceOn(to), promo, flag);
+    return MOVE(from, to, flag);
 }
 
 // Checks if the move is in the list of searchmoves if any were given
@@ -21,51 +21,50 @@
 #include "bitboard.h"
 #include "types.h"
 
-/* Move contents - total 27 bits used
-0000 0000 0000 0000 0000 0000 0011 1111 -> From       <<  0
-0000 0000 0000 0000 0000 1111 1100 0000 -> To         <<  6
-0000 0000 0000 0000 1111 0000 0000 0000 -> Piece      << 12
-0000 0000 0000 1111 0000 0000 0000 0000 -> Captured   << 16
-0000 0000 1111 0000 0000 0000 0000 0000 -> Promotion  << 20
-0000 0001 0000 0000 0000 0000 0000 0000 -> En passant << 24
-0000 0010 0000 0000 0000 0000 0000 0000 -> Pawn Start << 25
-0000 0100 0000 0000 0000 0000 0000 0000 -> Castle     << 26
+/* Move contents - 16 bits
+0000 0000 0011 1111 -> From      <<  0
+0000 1111 1100 0000 -> To        <<  6
+1111 0000 0000 0000 -> Flag      << 12
+
+The moving and captured pieces are not stored, they are read from the
+board of the position the move belongs to (before it is made), which
+requires a 'pos' in scope like the other board macros.
 */
 
 #define NOMOVE 0
 
 // Fields
-#define MOVE_FROM       0x000003F
-#define MOVE_TO         0x0000FC0
-#define MOVE_PIECE      0x000F000
-#define MOVE_CAPT       0x00F0000
-#define MOVE_PROMO      0x0F00000
-#define MOVE_FLAGS      0x7000000
-
-// Special move flags
+#define MOVE_FROM       0x003F
+#define MOVE_TO         0x0FC0
+#define MOVE_FLAGS      0xF000
+
+// Special move flags, promotions also encode the piece type
 #define FLAG_NONE       0
-#define FLAG_ENPAS      0x1000000
-#define FLAG_PAWNSTART  0x2000000
-#define FLAG_CASTLE     0x4000000
+#define FLAG_PAWNSTART  0x1000
+#define FLAG_CASTLE     0x2000
+#define FLAG_ENPAS      0x3000
+#define FLAG_PROMO      0x4000
+
+#define PromoFlag(pt) (FLAG_PROMO | (((pt) - KNIGHT) << 12))
 
 // Move constructor
-#define MOVE(f, t, pc, ca, pro, fl) ((f) | ((t) << 6) | ((pc) << 12) | ((ca) << 16) | ((pro) << 20) | (fl))
+#define MOVE(f, t, fl) ((Move)((f) | ((t) << 6) | (fl)))
 
 // Extract info from a move
 #define fromSq(move)     ((move) & MOVE_FROM)
-#define toSq(move)      (((move) & MOVE_TO)    >>  6)
-#define piece(move)     (((move) & MOVE_PIECE) >> 12)
-#define capturing(move) (((move) & MOVE_CAPT)  >> 16)
-#define promotion(move) (((move) & MOVE_PROMO) >> 20)
+#define toSq(move)      (((move) & MOVE_TO) >> 6)
+#define piece(move)     (pieceOn(fromSq(move)))
+#define capturing(move) (pieceOn(toSq(move)))
+#define promotion(move) ((move) & FLAG_PROMO ? (PieceType)((((move) >> 12) & 3) + KNIGHT) : 0)
 
 // Move types
-#define moveIsEnPas(move)   ((bool)(move & FLAG_ENPAS))
-#define moveIsPStart(move)  ((bool)(move & FLAG_PAWNSTART))
-#define moveIsCastle(move)  ((bool)(move & FLAG_CASTLE))
-#define moveIsSpecial(move) ((bool)(move & (MOVE_FLAGS | MOVE_PROMO)))
-#define moveIsCapture(move) ((bool)(move & MOVE_CAPT))
-#define moveIsNoisy(move)   ((bool)(move & (MOVE_CAPT | MOVE_PROMO | FLAG_ENPAS)))
-#define moveIsQuiet(move)   ((bool)(!moveIsNoisy(move)))
+#define moveIsEnPas(move)   (((move) & MOVE_FLAGS) == FLAG_ENPAS)
+#define moveIsPStart(move)  (((move) & MOVE_FLAGS) == FLAG_PAWNSTART)
+#define moveIsCastle(move)  (((move) & MOVE_FLAGS) == FLAG_CASTLE)
+#define moveIsSpecial(move) ((bool)((move) & MOVE_FLAGS))
+#define moveIsCapture(move) (capturing(move) != EMPTY && !moveIsCastle(move))
+#define moveIsNoisy(move)   (moveIsCapture(move) || (move) & FLAG_PROMO || moveIsEnPas(move))
+#define moveIsQuiet(move)   (!moveIsNoisy(move))
 
 
 // Checks legality of a specific castle move given the current position
@@ -16,6 +16,10 @@
   along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
+
 #include "bitboard.h"
 #include "makemove.h"
 #include "move.h"
@@ -24,21 +28,76 @@
 
 enum { QUIET, NOISY };
 
+
+#ifdef __x86_64__
+// Encodes the moves to 32 consecutive squares at once and packs the ones with
+// a target bit set using vpcompressw, then widens them into list entries eight
+// at a time. The score is written by the move picker later. Up to 7 entries
+// past the new end may be overwritten, the list has ample room for that.
+__attribute__((target("avx512f,avx512bw,avx512vbmi2")))
+static void CompressMoves(MoveList *list, const Square from, const Bitboard targets) {
+
+    const __m512i steps = _mm512_set_epi16(31 << 6, 30 << 6, 29 << 6, 28 << 6, 27 << 6, 26 << 6, 25 << 6, 24 << 6,
+                                           23 << 6, 22 << 6, 21 << 6, 20 << 6, 19 << 6, 18 << 6, 17 << 6, 16 << 6,
+                                           15 << 6, 14 << 6, 13 << 6, 12 << 6, 11 << 6, 10 << 6,  9 << 6,  8 << 6,
+                                            7 << 6,  6 << 6,  5 << 6,  4 << 6,  3 << 6,  2 << 6,  1 << 6,  0 << 6);
+
+    for (int base = 0; base < 64; base += 32) {
+
+        const __mmask32 mask = targets >> base;
+        if (!mask) continue;
+
+        const __m512i first = _mm512_set1_epi16(MOVE(from, base, FLAG_NONE));
+        const __m512i moves = _mm512_maskz_compress_epi16(mask, _mm512_add_epi16(first, steps));
+        const int count = PopCount(mask);
+
+        MoveListEntry *entry = &list->moves[list->count];
+        _mm512_storeu_si512(entry, _mm512_cvtepu16_epi64(_mm512_castsi512_si128(moves)));
+        if (count > 8)
+            _mm512_storeu_si512(entry + 8, _mm512_cvtepu16_epi64(_mm512_extracti32x4_epi32(moves, 1)));
+        if (count > 16)
+            _mm512_storeu_si512(entry + 16, _mm512_cvtepu16_epi64(_mm512_extracti32x4_epi32(moves, 2)));
+        if (count > 24)
+            _mm512_storeu_si512(entry + 24, _mm512_cvtepu16_epi64(_mm512_extracti32x4_epi32(moves, 3)));
+
+        list->count += count;
+    }
+}
+#endif
+
 // Constructs and adds a move to the move list
-INLINE void AddMove(const Position *pos, MoveList *list, const Square from, const Square to, const Piece promo, const int flag) {
-    list->moves[list->count++].move = MOVE(from, to, pieceOn(from), pieceOn(to), promo, flag);
+INLINE void AddMove(MoveList *list, const Square from, const Square to, const int flag) {
+    list->moves[list->count++].move = MOVE(from, to, flag);
+}
+
+// Adds a normal move from the given square to each target square
+INLINE void AddMoves(MoveList *list, const Square from, Bitboard targets) {
+#ifdef __x86_64__
+    // Only worth it for larger target sets, popping a few bits is faster
+    if (HasAVX512VBMI2 && PopCount(targets) > 8)
+        return CompressMoves(list, from, targets);
+#endif
+    while (targets)
+        AddMove(list, from, PopLsb(&targets), FLAG_NONE);
+}
+
+// Pinned pieces may only move along the line through their king
+INLINE bool PinAllows(const Position *pos, const Square from, const Square to) {
+    return !(pos->pinned & BB(from)) || LineBB[kingSq(sideToMove)][from] & BB(to);
 }
 
 // Adds promotions
-INLINE void AddPromotions(const Position *pos, MoveList *list, const Color color, Bitboard moves, const Direction dir) {
+INLINE void AddPromotions(const Position *pos, MoveList *list, Bitboard moves, const Direction dir) {
     while (moves) {
         Square to = PopLsb(&moves);
         Square from = to - dir;
 
-        AddMove(pos, list, from, to, MakePiece(color, QUEEN ), FLAG_NONE);
-        AddMove(pos, list, from, to, MakePiece(color, KNIGHT), FLAG_NONE);
-        AddMove(pos, list, from, to, MakePiece(color, ROOK  ), FLAG_NONE);
-        AddMove(pos, list, from, to, MakePiece(color, BISHOP), FLAG_NONE);
+        if (!PinAllows(pos, from, to)) continue;
+
+        AddMove(list, from, to, PromoFlag(QUEEN ));
+        AddMove(list, from, to, PromoFlag(KNIGHT));
+        AddMove(list, from, to, PromoFlag(ROOK  ));
+        AddMove(list, from, to, PromoFlag(BISHOP));
     }
 }
 
@@ -46,7 +105,8 @@ INLINE void AddPromotions(const Position *pos, MoveList *list, const Color color
 INLINE void AddPawnMoves(const Position *pos, MoveList *list, Bitboard moves, const Direction dir, const int flag) {
     while (moves) {
         Square to = PopLsb(&moves);
-        AddMove(pos, list, to - dir, to, EMPTY, flag);
+        if (PinAllows(pos, to - dir, to))
+            AddMove(list, to - dir, to, flag);
     }
 }
 
@@ -60,12 +120,12 @@ INLINE void GenCastling(const Position *pos, MoveList *list, const Color color,
     // King side castle
     Square toShort = RelativeSquare(color, G1);
     if (CastleLegal(pos, toShort))
-        AddMove(pos, list, from, toShort, EMPTY, FLAG_CASTLE);
+        AddMove(list, from, toShort, FLAG_CASTLE);
 
     // Queen side castle
     Square toLong = RelativeSquare(color, C1);
     if (CastleLegal(pos, toLong))
-        AddMove(pos, list, from, toLong, EMPTY, FLAG_CASTLE);
+        AddMove(list, from, toLong, FLAG_CASTLE);
 }
 
 // Pawns are a mess
@@ -101,11 +161,11 @@ INLINE void GenPawn(const Position *pos, MoveList *list, const Color color, cons
 
     // Promotions & Captures
     if (type == NOISY) {
-        AddPromotions(pos, list, color, lCap & promo, up+left);
-        AddPromotions(pos, list, color, rCap & promo, up+right);
+        AddPromotions(pos, list, lCap & promo, up+left);
+        AddPromotions(pos, list, rCap & promo, up+right);
         Bitboard pushPromos = push & promo;
         if (pos->checkers) pushPromos &= BetweenBB[kingSq(color)][Lsb(pos->checkers)];
-        AddPromotions(pos, list, color, pushPromos, up);
+        AddPromotions(pos, list, pushPromos, up);
 
         AddPawnMoves(pos, list, lCap & normal, up+left,  FLAG_NONE);
         AddPawnMoves(pos, list, rCap & normal, up+right, FLAG_NONE);
@@ -115,8 +175,11 @@ INLINE void GenPawn(const Position *pos, MoveList *list, const Color color, cons
             if (pos->checkers && !(pos->checkers & BB(pos->epSquare ^ 8)))
                 return;
             Bitboard enPassers = pawns & PawnAttackBB(!color, pos->epSquare);
-            while (enPassers)
-                AddMove(pos, list, PopLsb(&enPassers), pos->epSquare, EMPTY, FLAG_ENPAS);
+            while (enPassers) {
+                Move move = MOVE(PopLsb(&enPassers), pos->epSquare, FLAG_ENPAS);
+                if (MoveIsLegal(pos, move))
+                    list->moves[list->count++].move = move;
+            }
         }
     }
 }
@@ -132,15 +195,33 @@ INLINE void GenPieceType(const Position *pos, MoveList *list, const Color color,
 
     Bitboard pieces = colorPieceBB(color, pt);
 
+    // Pinned knights can never move
+    if (pt == KNIGHT)
+        pieces &= ~pos->pinned;
+
     while (pieces) {
         Square from = PopLsb(&pieces);
         Bitboard moves = targets & AttackBB(pt, from, occupied);
-        while (moves)
-            AddMove(pos, list, from, PopLsb(&moves), EMPTY, FLAG_NONE);
+
+        if (pos->pinned & BB(from))
+            moves &= LineBB[kingSq(color)][from];
+
+        // The king must not step into check, the king itself
+        // is removed so squares behind it along a ray are seen
+        if (pt == KING) {
+            Bitboard squares = moves;
+            while (squares) {
+                Square to = PopLsb(&squares);
+                if (colorBB(!color) & Attackers(pos, to, occupied ^ BB(from)))
+                    moves ^= BB(to);
+            }
+        }
+
+        AddMoves(list, from, moves);
     }
 }
 
-// Generate all quiet or noisy moves for the given color
+// Generate all legal quiet or noisy moves for the given color
 static void GenMoves(const Position *pos, MoveList *list, const Color color, const int type) {
 
     if (Multiple(pos->checkers))
@@ -168,21 +249,169 @@ void GenAllMoves(const Position *pos, MoveList *list) {
     GenQuietMoves(pos, list);
 }
 
-void GenLegalMoves(const Position *pos, MoveList *list) {
-    MoveList allMoves;
-    allMoves.count = allMoves.next = 0;
-    GenAllMoves(pos, &allMoves);
+// Generates quiet moves that give check, either directly or by moving
+// a piece out of the way of one of our sliders
+void GenQuietChecks(const Position *pos, MoveList *list) {
+
+    const Color color = sideToMove;
+    const Direction up = color == WHITE ? NORTH : SOUTH;
+    const Square theirKing = kingSq(!color);
+    const Bitboard occupied = pieceBB(ALL);
+    const Bitboard empty = ~occupied;
+
+    assert(!pos->checkers);
+
+    // Our pieces that are the only blocker between one of our sliders and their king
+    Bitboard snipers = colorBB(color)
+                     & (  (AttackBB(BISHOP, theirKing, 0) & (pieceBB(BISHOP) | pieceBB(QUEEN)))
+                        | (AttackBB(ROOK,   theirKing, 0) & (pieceBB(ROOK)   | pieceBB(QUEEN))));
+    Bitboard discoverers = 0;
+
+    while (snipers) {
+        Bitboard between = BetweenBB[theirKing][PopLsb(&snipers)] & occupied;
+        if (Single(between))
+            discoverers |= between & colorBB(color);
+    }
+
+    // Pawn pushes, promotions are already part of the noisy moves
+    const Bitboard pawnChecks = PawnAttackBB(!color, theirKing);
+    const Bitboard pawns = colorPieceBB(color, PAWN);
+    const Bitboard push = empty & ShiftBB(pawns, up) & ~(rank8BB | rank1BB);
+    const Bitboard doubles = empty & ShiftBB(push, up) & RankBB[RelativeRank(color, RANK_4)];
+
+    Bitboard moves = push & (pawnChecks | ShiftBB(discoverers, up));
+    while (moves) {
+        Square to = PopLsb(&moves);
+        if (   (BB(to) & pawnChecks || !(LineBB[theirKing][to - up] & BB(to)))
+            && PinAllows(pos, to - up, to))
+            AddMove(list, to - up, to, FLAG_NONE);
+    }
 
-    for (int i = 0; i < allMoves.count; ++i) {
-        Move move = allMoves.moves[i].move;
-        if (!MoveIsLegal(pos, move)) continue;
-        list->moves[list->count++].move = move;
+    moves = doubles & (pawnChecks | ShiftBB(discoverers, 2 * up));
+    while (moves) {
+        Square to = PopLsb(&moves);
+        if (   (BB(to) & pawnChecks || !(LineBB[theirKing][to - 2 * up] & BB(to)))
+            && PinAllows(pos, to - 2 * up, to))
+            AddMove(list, to - 2 * up, to, FLAG_PAWNSTART);
     }
+
+    // Pieces moving to a square attacking the king, or off the line of a slider
+    for (PieceType pt = KNIGHT; pt <= QUEEN; ++pt) {
+
+        const Bitboard checks = AttackBB(pt, theirKing, occupied);
+        Bitboard pieces = colorPieceBB(color, pt);
+
+        while (pieces) {
+            Square from = PopLsb(&pieces);
+            Bitboard targets = discoverers & BB(from) ? checks | ~LineBB[theirKing][from] : checks;
+
+            moves = empty & targets & AttackBB(pt, from, occupied);
+
+            if (pos->pinned & BB(from))
+                moves &= LineBB[kingSq(color)][from];
+
+            while (moves)
+                AddMove(list, from, PopLsb(&moves), FLAG_NONE);
+        }
+    }
+
+    // The king can only give discovered checks
+    const Square kingSq = kingSq(color);
+
+    if (discoverers & BB(kingSq)) {
+        moves = empty & AttackBB(KING, kingSq, 0) & ~LineBB[theirKing][kingSq];
+        while (moves) {
+            Square to = PopLsb(&moves);
+            if (!(colorBB(!color) & Attackers(pos, to, occupied ^ BB(kingSq))))
+                AddMove(list, kingSq, to, FLAG_NONE);
+        }
+    }
+}
+
+// Counts pawn moves landing on the given targets, promotions count as four moves
+INLINE int CountPawnMoves(const Position *pos, const Color color, const Bitboard pawns, const Bitboard targets) {
+
+    const Direction up = color == WHITE ? NORTH : SOUTH;
+
+    const Bitboard empty   = ~pieceBB(ALL);
+    const Bitboard enemies = colorBB(!color);
+    const Bitboard promo   = rank8BB | rank1BB;
+
+    const Bitboard push    = empty & ShiftBB(pawns, up);
+    const Bitboard doubles = empty & ShiftBB(push, up) & RankBB[RelativeRank(color, RANK_4)];
+    const Bitboard lCap    = enemies & ShiftBB(pawns, up+WEST);
+    const Bitboard rCap    = enemies & ShiftBB(pawns, up+EAST);
+
+    return      PopCount(push & targets & ~promo)
+         +      PopCount(doubles & targets)
+         +      PopCount(lCap & targets & ~promo)
+         +      PopCount(rCap & targets & ~promo)
+         + 4 * (PopCount(push & targets & promo)
+              + PopCount(lCap & targets & promo)
+              + PopCount(rCap & targets & promo));
+}
+
+// Counts legal moves using popcounts of the target sets rather than
+// building a move list, optionally stopping once any move is found
+INLINE int CountMoves(const Position *pos, const bool stopAtFirst) {
+
+    const Color color = sideToMove;
+    const Square kingSq = kingSq(color);
+    const Bitboard occupied = pieceBB(ALL);
+    const Bitboard pinned = pos->pinned;
+
+    int count = 0;
+
+    // King moves are tested one by one as they rarely number more than a few
+    Bitboard kingMoves = AttackBB(KING, kingSq, 0) & ~colorBB(color);
+    while (kingMoves)
+        if (!(colorBB(!color) & Attackers(pos, PopLsb(&kingMoves), occupied ^ BB(kingSq))))
+            if (++count && stopAtFirst)
+                return count;
+
+    if (Multiple(pos->checkers))
+        return count;
+
+    const Bitboard targets = pos->checkers ? BetweenBB[kingSq][Lsb(pos->checkers)] | pos->checkers
+                                           : ~colorBB(color);
+
+    count += CastleLegal(pos, RelativeSquare(color, G1))
+           + CastleLegal(pos, RelativeSquare(color, C1));
+
+    count += CountPawnMoves(pos, color, colorPieceBB(color, PAWN) & ~pinned, targets);
+
+    for (PieceType pt = KNIGHT; pt <= QUEEN; ++pt) {
+        Bitboard pieces = colorPieceBB(color, pt) & ~pinned;
+        while (pieces)
+            count += PopCount(AttackBB(pt, PopLsb(&pieces), occupied) & targets);
+    }
+
+    if (count && stopAtFirst)
+        return count;
+
+    // Pinned pieces can only move along the pin, which never resolves a check
+    Bitboard pinners = pos->checkers ? 0 : pinned & ~pieceBB(KNIGHT);
+    while (pinners) {
+        Square sq = PopLsb(&pinners);
+        Bitboard line = LineBB[kingSq][sq] & targets;
+        count += pieceTypeOn(sq) == PAWN ? CountPawnMoves(pos, color, BB(sq), line)
+                                         : PopCount(AttackBB(pieceTypeOn(sq), sq, occupied) & line);
+    }
+
+    // En passant
+    if (pos->epSquare && (!pos->checkers || pos->checkers & BB(pos->epSquare ^ 8))) {
+        Bitboard enPassers = colorPieceBB(color, PAWN) & PawnAttackBB(!color, pos->epSquare);
+        while (enPassers)
+            count += MoveIsLegal(pos, MOVE(PopLsb(&enPassers), pos->epSquare, FLAG_ENPAS));
+    }
+
+    return count;
 }
 
 int LegalMoveCount(const Position *pos) {
-    MoveList list;
-    list.count = list.next = 0;
-    GenLegalMoves(pos, &list);
-    return list.count;
+    return CountMoves(pos, false);
+}
+
+bool HasLegalMove(const Position *pos) {
+    return CountMoves(pos, true);
 }
@@ -37,5 +37,6 @@ typedef struct {
 void GenNoisyMoves(const Position *pos, MoveList *list);
 void GenQuietMoves(const Position *pos, MoveList *list);
 void GenAllMoves(const Position *pos, MoveList *list);
-void GenLegalMoves(const Position *pos, MoveList *list);
+void GenQuietChecks(const Position *pos, MoveList *list);
 int LegalMoveCount(const Position *pos);
+bool HasLegalMove(const Position *pos);
@@ -60,6 +60,7 @@ static void SortMoves(MoveList *list, int threshold) {
 static void ScoreMoves(MovePicker *mp, const int stage) {
 
     const Thread *thread = mp->thread;
+    const Position *pos = thread->pos;
     MoveList *list = &mp->list;
 
     for (int i = list->next; i < list->count; ++i) {
@@ -76,7 +77,7 @@ static void ScoreMoves(MovePicker *mp, const int stage) {
 Move NextMove(MovePicker *mp) {
 
     Move move;
-    Position *pos = &mp->thread->pos;
+    Position *pos = mp->thread->pos;
 
     // Switch on stage, falls through to the next stage
     // if a move isn't returned in the current stage.
@@ -97,18 +98,35 @@ Move NextMove(MovePicker *mp) {
             // Save seemingly bad noisy moves for later
             while ((move = PickNextMove(mp)))
                 if (    mp->list.moves[mp->list.next-1].score >  11046
-                    || (mp->list.moves[mp->list.next-1].score > - 9543 && SEE(pos, move, mp->threshold)))
+                    || (mp->list.moves[mp->list.next-1].score > - 9543 && MoveSEE(mp, move, mp->threshold)))
                     return move;
                 else
                     mp->list.moves[mp->bads++].move = move;
 
             mp->stage++;
 
+            // fall through
+        case GEN_CHECKS:
+            if (mp->checks)
+                GenQuietChecks(pos, &mp->list),
+                ScoreMoves(mp, GEN_QUIET);
+
+            mp->stage++;
+
+            // fall through
+        case QUIET_CHECKS:
+            if (mp->checks)
+                if ((move = PickNextMove(mp)))
+                    return move;
+
+            mp->stage++;
+
             // fall through
         case KILLER:
             mp->stage++;
             if (   mp->killer != mp->ttMove
-                && MoveIsPseudoLegal(pos, mp->killer))
+                && MoveIsPseudoLegal(pos, mp->killer)
+                && MoveIsLegal(pos, mp->killer))
                 return mp->killer;
 
             // fall through
@@ -139,6 +157,29 @@ Move NextMove(MovePicker *mp) {
     }
 }
 
+// SEE sharing work between the moves of a node. Attackers of each target square
+// are only found once, and the result for the last move tested is remembered,
+// as the picker and the search often test the same move at different thresholds.
+bool MoveSEE(MovePicker *mp, const Move move, const int threshold) {
+
+    if (move != mp->seeMove)
+        mp->seeMove   = move,
+        mp->seePassed = -INFINITE,
+        mp->seeFailed =  INFINITE;
+
+    if (threshold <= mp->seePassed) return true;
+    if (threshold >= mp->seeFailed) return false;
+
+    bool result = SEE(mp->thread->pos, move, threshold, &mp->see);
+
+    if (result)
+        mp->seePassed = threshold;
+    else
+        mp->seeFailed = threshold;
+
+    return result;
+}
+
 // Init normal movepicker
 void InitNormalMP(MovePicker *mp, Thread *thread, Stack *ss, Depth depth, Move ttMove, Move killer) {
     mp->list.count = mp->list.next = 0;
@@ -151,15 +192,19 @@ void InitNormalMP(MovePicker *mp, Thread *thread, Stack *ss, Depth depth, Move t
     mp->bads      = 0;
     mp->threshold = 0;
     mp->onlyNoisy = false;
+    mp->checks    = false;
+    mp->seeMove   = NOMOVE;
+    mp->see.known = 0;
 }
 
 // Init noisy movepicker
-void InitNoisyMP(MovePicker *mp, Thread *thread, Stack *ss, Move ttMove) {
+void InitNoisyMP(MovePicker *mp, Thread *thread, Stack *ss, Move ttMove, bool checks) {
     InitNormalMP(mp, thread, ss, 0, ttMove, NOMOVE);
     mp->onlyNoisy = true;
+    mp->checks    = checks;
 }
 
 void InitProbcutMP(MovePicker *mp, Thread *thread, Stack *ss, int threshold) {
-    InitNoisyMP(mp, thread, ss, NOMOVE);
+    InitNoisyMP(mp, thread, ss, NOMOVE, false);
     mp->threshold = threshold;
 }
@@ -22,7 +22,7 @@
 
 
 typedef enum MPStage {
-    TTMOVE, GEN_NOISY, NOISY_GOOD, KILLER, GEN_QUIET, QUIET, NOISY_BAD
+    TTMOVE, GEN_NOISY, NOISY_GOOD, GEN_CHECKS, QUIET_CHECKS, KILLER, GEN_QUIET, QUIET, NOISY_BAD
 } MPStage;
 
 typedef struct MovePicker {
@@ -35,10 +35,16 @@ typedef struct MovePicker {
     int bads;
     int threshold;
     bool onlyNoisy;
+    bool checks;
+    // Known SEE bounds of the last move tested
+    Move seeMove;
+    int seePassed, seeFailed;
+    SEECache see;
 } MovePicker;
 
 
 Move NextMove(MovePicker *mp);
+bool MoveSEE(MovePicker *mp, const Move move, const int threshold);
 void InitNormalMP(MovePicker *mp, Thread *thread, Stack *ss, Depth depth, Move ttMove, Move killer);
-void InitNoisyMP(MovePicker *mp, Thread *thread, Stack *ss, Move ttMove);
+void InitNoisyMP(MovePicker *mp, Thread *thread, Stack *ss, Move ttMove, bool checks);
 void InitProbcutMP(MovePicker *mp, Thread *thread, Stack *ss, int threshold);
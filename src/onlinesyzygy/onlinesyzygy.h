@@ -25,4 +25,4 @@
 extern bool OnlineSyzygy;
 
 
-bool QueryRoot(const Position *pos, unsigned *wdl, unsigned *dtz, Move *move);
+bool QueryRoot(const Position *pos, Move *move, unsigned *wdl, unsigned *dtz);
@@ -0,0 +1,286 @@
+/*
+  Weiss is a UCI compliant chess engine.
+  Copyright (C) 2019-2026 Terje Kirstihagen
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <ctype.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
+#include "makemove.h"
+#include "move.h"
+#include "movegen.h"
+#include "perft.h"
+#include "time.h"
+
+
+/* Usage: perft [<depth> | suite] [divide] [threads <n>] [hash <MB>] [<fen>]
+ *
+ * Available both as a UCI command and from the command line. The suite
+ * runs a set of reference positions and compares against known counts. */
+
+typedef struct PerftTest {
+    const char *fen;
+    Depth depth;
+    uint64_t nodes;
+    bool chess960;
+} PerftTest;
+
+static const PerftTest PerftSuite[] = {
+    { "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",                 6, 119060324, false },
+    { "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",     5, 193690690, false },
+    { "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",                                7, 178633661, false },
+    { "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",         5,  15833292, false },
+    { "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",                5,  89941194, false },
+    { "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", 5, 164075551, false },
+    { "8/8/1k6/2b5/2pP4/8/5K2/8 b - d3 0 1",                                      6,   1440467, false },
+    { "r3k2r/1b4bq/8/8/8/8/7B/R3K2R w KQkq - 1 1",                                4,   1274206, false },
+    { "3k4/3p4/8/K1P4r/8/8/8/8 b - - 0 1",                                        6,   1134888, false },
+    { "2K2r2/4P3/8/8/8/8/8/3k4 w - - 0 1",                                        6,   3821001, false },
+    { "8/P1k5/K7/8/8/8/8/8 w - - 0 1",                                            6,     92683, false },
+    { "bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/BQ1BNRKR w HFhf - 2 9",        5,   8146062, true  },
+    { "2nnrbkr/p1qppppp/8/1ppb4/6PP/3PP3/PPP2P2/BQNNRBKR w HEhe - 1 9",           5,  16253601, true  },
+};
+
+typedef struct PerftEntry {
+    Key check; // Key xor nodes, so torn writes from other threads are detected
+    uint64_t nodes;
+} PerftEntry;
+
+static PerftEntry *PerftHash;
+static uint64_t PerftHashCount;
+
+// Shared state for splitting the root moves between threads
+typedef struct PerftRoot {
+    Position pos;
+    MoveList list;
+    uint64_t counts[256];
+    atomic_int next;
+    Depth depth;
+} PerftRoot;
+
+
+// Mixes the depth into the key so counts for different depths don't clash
+INLINE Key PerftKey(const Position *pos, const Depth depth) {
+    return pos->key ^ (depth * 0x9E3779B97F4A7C15ull);
+}
+
+// Counts leaf nodes, the moves at depth 1 are counted without being made
+static uint64_t RecursivePerft(Position *pos, const Depth depth) {
+
+    Key key = PerftKey(pos, depth);
+    PerftEntry *entry = PerftHash && depth > 1 ? &PerftHash[key & (PerftHashCount - 1)] : NULL;
+
+    if (entry && (entry->check ^ entry->nodes) == key)
+        return entry->nodes;
+
+    if (depth == 1) return LegalMoveCount(pos);
+
+    MoveList list;
+    list.count = list.next = 0;
+    GenAllMoves(pos, &list);
+
+    uint64_t leafnodes = 0;
+
+    for (int i = 0; i < list.count; i++) {
+        Position *child = MakeMove(pos, list.moves[i].move);
+        leafnodes += RecursivePerft(child, depth - 1);
+        TakeMove(child);
+    }
+
+    if (entry)
+        entry->check = key ^ leafnodes,
+        entry->nodes = leafnodes;
+
+    return leafnodes;
+}
+
+// Takes root moves one at a time until none are left
+static void *PerftWorker(void *arg) {
+
+    PerftRoot *root = arg;
+    // Copy-make builds make each move in the next of these
+    Position *pos = malloc((root->depth + 1) * sizeof(Position));
+    memcpy(pos, &root->pos, sizeof(Position));
+    pos->gameHistory = malloc(root->depth * sizeof(History));
+
+    int i;
+    while ((i = atomic_fetch_add(&root->next, 1)) < root->list.count) {
+        Position *child = MakeMove(pos, root->list.moves[i].move);
+        root->counts[i] = root->depth > 1 ? RecursivePerft(child, root->depth - 1) : 1;
+        TakeMove(child);
+    }
+
+    free(pos->gameHistory);
+    free(pos);
+    return NULL;
+}
+
+// Runs perft on a position, splitting the root moves between threads
+static uint64_t RunPerft(const char *fen, const Depth depth, const int threadCount, const bool divide) {
+
+    PerftRoot *root = calloc(1, sizeof(PerftRoot));
+    ParseFen(fen, &root->pos);
+    root->depth = depth;
+    GenAllMoves(&root->pos, &root->list);
+
+    if (depth == 0)
+        return free(root), 1;
+
+    pthread_t threads[threadCount];
+    for (int i = 1; i < threadCount; ++i)
+        pthread_create(&threads[i], NULL, PerftWorker, root);
+    PerftWorker(root);
+    for (int i = 1; i < threadCount; ++i)
+        pthread_join(threads[i], NULL);
+
+    uint64_t leafNodes = 0;
+    for (int i = 0; i < root->list.count; ++i) {
+        if (divide)
+            printf("%s: %" PRIu64 "\n", MoveToStr(root->list.moves[i].move), root->counts[i]);
+        leafNodes += root->counts[i];
+    }
+
+    free(root);
+    return leafNodes;
+}
+
+// Allocates a power of two sized perft hash table, or frees it with size 0
+static void SetPerftHash(const int megabytes) {
+
+    free(PerftHash);
+    PerftHash = NULL;
+    PerftHashCount = 0;
+
+    if (megabytes <= 0) return;
+
+    PerftHashCount = 1;
+    while (2 * PerftHashCount * sizeof(PerftEntry) <= (uint64_t)megabytes * 1024 * 1024)
+        PerftHashCount *= 2;
+
+    PerftHash = calloc(PerftHashCount, sizeof(PerftEntry));
+}
+
+// Runs all reference positions and compares against the known counts
+static void RunSuite(const int threadCount) {
+
+    const bool chess960 = Chess960;
+    const int count = sizeof(PerftSuite) / sizeof(PerftTest);
+    TimePoint totalElapsed = 1; // Avoid possible div/0
+    uint64_t totalNodes = 0;
+    int passed = 0;
+
+    for (int i = 0; i < count; ++i) {
+
+        const PerftTest *test = &PerftSuite[i];
+
+        Chess960 = test->chess960;
+
+        const TimePoint start = Now();
+        uint64_t nodes = RunPerft(test->fen, test->depth, threadCount, false);
+        const TimePoint elapsed = TimeSince(start);
+
+        bool ok = nodes == test->nodes;
+        passed += ok;
+        totalElapsed += elapsed;
+        totalNodes += nodes;
+
+        printf("[# %2d] %-4s d%d %11" PRIu64 " nodes %7" PRId64 " ms  %s\n",
+               i + 1, ok ? "ok" : "FAIL", test->depth, nodes, elapsed, test->fen);
+        if (!ok)
+            printf("        expected %" PRIu64 " nodes\n", test->nodes);
+        fflush(stdout);
+
+        if (PerftHash)
+            memset(PerftHash, 0, PerftHashCount * sizeof(PerftEntry));
+    }
+
+    Chess960 = chess960;
+
+    puts("======================================================");
+
+    printf("OVERALL: %7" PRIi64 " ms %13" PRIu64 " nodes %10" PRIu64 " nps\n"
+           "PASSED : %d / %d\n",
+           totalElapsed, totalNodes, totalNodes * 1000 / totalElapsed, passed, count);
+    fflush(stdout);
+}
+
+// Parses and runs a perft command
+void Perft(char *str) {
+
+    char *default_fen = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+
+    // The fen, if any, is everything from the first token containing a '/'
+    char *fen = strchr(str, '/');
+    if (fen) {
+        while (fen > str && *(fen - 1) != ' ') fen--;
+        if (fen > str) *(fen - 1) = '\0';
+    } else
+        fen = default_fen;
+
+    Depth depth = 5;
+    int threadCount = 1, hashMB = 0;
+    bool divide = false, suite = false;
+
+    strtok(str, " ");
+    for (char *token; (token = strtok(NULL, " "));) {
+        if      (!strcmp(token, "suite"  )) suite = true;
+        else if (!strcmp(token, "divide" )) divide = true;
+        else if (!strcmp(token, "threads")) threadCount = atoi(strtok(NULL, " ") ?: "1");
+        else if (!strcmp(token, "hash"   )) hashMB = atoi(strtok(NULL, " ") ?: "0");
+        else if (isdigit(*token))           depth = atoi(token);
+    }
+
+    threadCount = CLAMP(threadCount, 1, 256);
+    SetPerftHash(hashMB);
+
+    if (suite) {
+        RunSuite(threadCount);
+        SetPerftHash(0);
+        return;
+    }
+
+    printf("\nPerft starting:\nDepth : %d\nFEN   : %s\n", depth, fen);
+    fflush(stdout);
+
+    const TimePoint start = Now();
+    uint64_t leafNodes = RunPerft(fen, depth, threadCount, divide);
+    const TimePoint elapsed = TimeSince(start) + 1;
+
+    printf("\nPerft complete:"
+           "\nTime : %" PRId64 "ms"
+           "\nNPS  : %" PRId64
+           "\nNodes: %" PRIu64 "\n",
+           elapsed, leafNodes * 1000 / elapsed, leafNodes);
+    fflush(stdout);
+
+    SetPerftHash(0);
+}
+
+// Runs perft with the command line arguments as the command
+void PerftCLI(int argc, char **argv) {
+
+    char str[8192] = "perft";
+
+    for (int i = 2; i < argc; ++i)
+        strncat(str, " ", sizeof(str) - strlen(str) - 1),
+        strncat(str, argv[i], sizeof(str) - strlen(str) - 1);
+
+    Perft(str);
+}
@@ -19,6 +19,7 @@
 #include "board.h"
 #include "evaluate.h"
 #include "psqt.h"
+#include "startup.h"
 
 
 extern const int PieceTypeValue[TYPE_NB];
@@ -92,4 +93,6 @@ CONSTR(1) InitPSQT() {
             PSQT[MakePiece(WHITE, pt)][MirrorSquare(sq)] =  value;
             PSQT[MakePiece(BLACK, pt)][             sq ] = -value;
         }
+
+    StartupMark("InitPSQT");
 }
@@ -29,6 +29,7 @@
 #include "move.h"
 #include "movepicker.h"
 #include "search.h"
+#include "startup.h"
 #include "syzygy.h"
 #include "time.h"
 #include "threads.h"
@@ -40,9 +41,14 @@ SearchLimits Limits = { .multiPV = 1 };
 atomic_bool ABORT_SIGNAL;
 atomic_bool SEARCH_STOPPED = true;
 atomic_bool Minimal = false;
+atomic_bool Silent = false;
+atomic_bool Verbose = false;
 
 static int Reductions[2][32][32];
 
+// Quiet checks are searched in this many plies of quiescence
+#define QS_CHECK_PLIES 1
+
 
 // Initializes the late move reduction array
 CONSTR(1) InitReductions() {
@@ -50,6 +56,8 @@ CONSTR(1) InitReductions() {
         for (int moves = 1; moves < 32; ++moves)
             Reductions[0][depth][moves] = 0.38 + log(depth) * log(moves) / 3.76, // capture
             Reductions[1][depth][moves] = 2.01 + log(depth) * log(moves) / 2.32; // quiet
+
+    StartupMark("InitReductions");
 }
 
 // Checks whether a move was already searched in multi-pv mode
@@ -81,9 +89,9 @@ static void UpdatePv(Stack *ss, Move move) {
 }
 
 // Quiescence
-static int Quiescence(Thread *thread, Stack *ss, int alpha, int beta) {
+static int Quiescence(Thread *thread, Stack *ss, int alpha, int beta, Depth depth) {
 
-    Position *pos = &thread->pos;
+    Position *pos = thread->pos;
     MovePicker mp;
     ss->pv.length = 0;
 
@@ -99,6 +107,9 @@ static int Quiescence(Thread *thread, Stack *ss, int alpha, int beta) {
     if (OutOfTime(thread) || loadRelaxed(ABORT_SIGNAL))
         longjmp(thread->jumpBuffer, true);
 
+    thread->qnodes++;
+    thread->seldepth = MAX(thread->seldepth, ss->ply);
+
     // Detect upcoming repetitions
     if (alpha < 0 && HasCycle(pos, ss->ply)) {
         alpha = DrawScore(pos);
@@ -111,7 +122,7 @@ static int Quiescence(Thread *thread, Stack *ss, int alpha, int beta) {
         return DrawScore(pos);
 
     // Position is drawn by 50 move rule
-    if (pos->rule50 >= 100 && (!inCheck || LegalMoveCount(pos) > 0))
+    if (pos->rule50 >= 100 && (!inCheck || HasLegalMove(pos)))
         return DrawScore(pos);
 
     // If we are at max depth, return static eval
@@ -127,6 +138,8 @@ static int Quiescence(Thread *thread, Stack *ss, int alpha, int beta) {
     // Probe transposition table
     bool ttHit;
     TTEntry *tte = ProbeTT(pos->key, &ttHit);
+    thread->ttProbes++;
+    thread->ttHits += ttHit;
 
     Move ttMove = ttHit ? tte->move : NOMOVE;
     int ttScore = ttHit ? ScoreFromTT(tte->score, ss->ply) : NOSCORE;
@@ -134,7 +147,7 @@ static int Quiescence(Thread *thread, Stack *ss, int alpha, int beta) {
     // Depth ttDepth = tte->depth;
     int ttBound = Bound(tte);
 
-    if (ttMove && !MoveIsPseudoLegal(pos, ttMove))
+    if (ttMove && (!MoveIsPseudoLegal(pos, ttMove) || !MoveIsLegal(pos, ttMove)))
         ttHit = false, ttMove = NOMOVE, ttScore = NOSCORE, ttEval = NOSCORE;
 
     // Trust TT if not a pvnode
@@ -144,11 +157,13 @@ static int Quiescence(Thread *thread, Stack *ss, int alpha, int beta) {
     if (inCheck) goto moveloop;
 
     // Do a static evaluation for pruning considerations
+    bool lazy = false;
     eval = (ss-1)->move == NOMOVE ? -(ss-1)->staticEval + 2 * Tempo
          : ttEval != NOSCORE      ? ttEval
-                                  : EvalPosition(pos, thread->pawnCache);
+                                  : EvalPositionBounded(pos, thread->pawnCache, alpha, beta, &lazy);
 
-    unadjustedEval = eval;
+    // A lazy eval only decides the stand pat and is not stored
+    unadjustedEval = lazy ? NOSCORE : eval;
     eval = CorrectEval(thread, ss, eval, pos->rule50);
 
     // Use ttScore as eval if it is more informative
@@ -168,20 +183,25 @@ static int Quiescence(Thread *thread, Stack *ss, int alpha, int beta) {
 
 moveloop:
 
-    if (!inCheck) InitNoisyMP(&mp, thread, ss, ttMove);
+    if (!inCheck) InitNoisyMP(&mp, thread, ss, ttMove, depth > -QS_CHECK_PLIES);
     else          InitNormalMP(&mp, thread, ss, 0, ttMove, NOMOVE);
 
     // Move loop
     Move bestMove = NOMOVE;
     Move move;
     while ((move = NextMove(&mp))) {
-        if (!MoveIsLegal(pos, move)) continue;
 
         // Avoid pruning until at least one move avoids a terminal loss score
         if (isLoss(bestScore)) goto search;
 
         // Only try moves the movepicker deems good
-        if (mp.stage > NOISY_GOOD) break;
+        if (mp.stage > QUIET_CHECKS) break;
+
+        // Quiet checks are tried unless they lose material
+        if (mp.stage == QUIET_CHECKS) {
+            if (!MoveSEE(&mp, move, 0)) continue;
+            goto search;
+        }
 
         // Futility pruning
         if (    futility + PieceValue[EG][capturing(move)] <= alpha
@@ -192,7 +212,7 @@ moveloop:
 
         // SEE pruning
         if (    futility <= alpha
-            && !SEE(pos, move, 1)) {
+            && !MoveSEE(&mp, move, 1)) {
             bestScore = MAX(bestScore, futility);
             continue;
         }
@@ -202,9 +222,9 @@ search:
         ss->continuation = &thread->continuation[inCheck][moveIsCapture(move)][piece(move)][toSq(move)];
         ss->contCorr = &thread->contCorrHistory[piece(move)][toSq(move)];
 
-        MakeMove(pos, move);
-        int score = -Quiescence(thread, ss+1, -beta, -alpha);
-        TakeMove(pos);
+        pos = thread->pos = MakeMove(pos, move);
+        int score = -Quiescence(thread, ss+1, -beta, -alpha, depth - 1);
+        pos = thread->pos = TakeMove(pos);
 
         // Found a new best move in this position
         if (score > bestScore) {
@@ -236,14 +256,23 @@ search:
     return bestScore;
 }
 
+// Reverse futility pruning, the eval is so far above beta that some move is assumed to beat it
+INLINE bool ReverseFutility(Thread *thread, Stack *ss, int eval, int beta, Depth depth, bool improving, Move ttMove) {
+    return   depth < 7
+          && STAT_IF(STAT_RFP, depth,
+                 eval >= beta
+              && eval - 77 * (depth - improving) - (ss-1)->histScore / 131 >= beta
+              && (!ttMove || GetHistory(thread, ss, ttMove) > 6450));
+}
+
 // Alpha Beta
 static int AlphaBeta(Thread *thread, Stack *ss, int alpha, int beta, Depth depth, bool cutnode) {
 
     // Quiescence at the end of search
     if (depth <= 0)
-        return Quiescence(thread, ss, alpha, beta);
+        return Quiescence(thread, ss, alpha, beta, 0);
 
-    Position *pos = &thread->pos;
+    Position *pos = thread->pos;
     MovePicker mp;
     ss->pv.length = 0;
     ss->doubleExtensions = (ss-1)->doubleExtensions;
@@ -256,6 +285,8 @@ static int AlphaBeta(Thread *thread, Stack *ss, int alpha, int beta, Depth depth
     if (OutOfTime(thread) || loadRelaxed(ABORT_SIGNAL))
         longjmp(thread->jumpBuffer, true);
 
+    thread->seldepth = MAX(thread->seldepth, ss->ply);
+
     // Early exits
     if (!root) {
 
@@ -271,7 +302,7 @@ static int AlphaBeta(Thread *thread, Stack *ss, int alpha, int beta, Depth depth
             return DrawScore(pos);
 
         // Position is drawn by 50 move rule
-        if (pos->rule50 >= 100 && (!inCheck || LegalMoveCount(pos) > 0))
+        if (pos->rule50 >= 100 && (!inCheck || HasLegalMove(pos)))
             return DrawScore(pos);
 
         // Max depth reached
@@ -288,6 +319,8 @@ static int AlphaBeta(Thread *thread, Stack *ss, int alpha, int beta, Depth depth
     // Probe transposition table
     bool ttHit;
     TTEntry *tte = ProbeTT(pos->key, &ttHit);
+    thread->ttProbes++;
+    thread->ttHits += ttHit;
 
     Move ttMove = ttHit ? tte->move : NOMOVE;
     int ttScore = ttHit ? ScoreFromTT(tte->score, ss->ply) : NOSCORE;
@@ -295,14 +328,14 @@ static int AlphaBeta(Thread *thread, Stack *ss, int alpha, int beta, Depth depth
     Depth ttDepth = tte->depth;
     int ttBound = Bound(tte);
 
-    if (ttMove && (!MoveIsPseudoLegal(pos, ttMove) || ttMove == ss->excluded))
+    if (ttMove && (!MoveIsPseudoLegal(pos, ttMove) || !MoveIsLegal(pos, ttMove) || ttMove == ss->excluded))
         ttHit = false, ttMove = NOMOVE, ttScore = NOSCORE, ttEval = NOSCORE;
 
     // Trust TT if not a pvnode and the entry depth is sufficiently high
     if (!pvNode && ttHit && ttDepth >= depth && TTScoreIsMoreInformative(ttBound, ttScore, beta)) {
 
         // Give a history bonus to quiet tt moves that causes a cutoff
-        if (ttScore >= beta && moveIsQuiet(ttMove)) {
+        if (ttScore >= beta && ttMove && moveIsQuiet(ttMove)) {
             QuietHistoryUpdate(ttMove, Bonus(depth));
             PawnHistoryUpdate(ttMove, Bonus(depth));
         }
@@ -337,12 +370,32 @@ static int AlphaBeta(Thread *thread, Stack *ss, int alpha, int beta, Depth depth
 
     (ss+1)->killer = NOMOVE;
 
+    // Only a lazy fail high can be used, to decide reverse futility pruning
+    bool lazyRFP =   !pvNode
+                  && depth < 7
+                  && thread->doPruning
+                  && !ss->excluded
+                  && !isTerminal(beta);
+
     // Do a static evaluation for pruning considerations
+    bool lazy = false;
     int eval = ss->staticEval =  inCheck           ? NOSCORE
                                : lastMoveNullMove  ? -(ss-1)->staticEval + 2 * Tempo
                                : ttEval != NOSCORE ? ttEval
+                               : lazyRFP           ? EvalPositionBounded(pos, thread->pawnCache, -INFINITE, beta, &lazy)
                                                    : EvalPosition(pos, thread->pawnCache);
 
+    // A lazy eval is only trusted to decide reverse futility pruning,
+    // anything else gets a full evaluation
+    if (lazy) {
+        int lazyEval = CorrectEval(thread, ss, eval, pos->rule50);
+
+        if (ReverseFutility(thread, ss, lazyEval, beta, depth, false, ttMove))
+            return lazyEval;
+
+        eval = ss->staticEval = EvalPosition(pos, thread->pawnCache);
+    }
+
     int unadjustedEval = eval;
     ss->staticEval = eval = CorrectEval(thread, ss, eval, pos->rule50);
 
@@ -365,10 +418,7 @@ static int AlphaBeta(Thread *thread, Stack *ss, int alpha, int beta, Depth depth
         goto move_loop;
 
     // Reverse Futility Pruning
-    if (   depth < 7
-        && eval >= beta
-        && eval - 77 * (depth - improving) - (ss-1)->histScore / 131 >= beta
-        && (!ttMove || GetHistory(thread, ss, ttMove) > 6450))
+    if (ReverseFutility(thread, ss, eval, beta, depth, improving, ttMove))
         return eval;
 
     // Null Move Pruning
@@ -384,12 +434,12 @@ static int AlphaBeta(Thread *thread, Stack *ss, int alpha, int beta, Depth depth
         ss->continuation = &thread->continuation[0][0][EMPTY][0];
         ss->contCorr = &thread->contCorrHistory[EMPTY][0];
 
-        MakeNullMove(pos);
+        pos = thread->pos = MakeNullMove(pos);
         int score = -AlphaBeta(thread, ss+1, -beta, -alpha, depth - reduction, !cutnode);
-        TakeNullMove(pos);
+        pos = thread->pos = TakeNullMove(pos);
 
         // Cutoff
-        if (score >= beta)
+        if (STAT_IF(STAT_NMP, depth, score >= beta))
             // Don't return unproven terminal win scores
             return isWin(score) ? beta : score;
     }
@@ -407,24 +457,23 @@ static int AlphaBeta(Thread *thread, Stack *ss, int alpha, int beta, Depth depth
 
             if (mp.stage > NOISY_GOOD) break;
 
-            if (!MoveIsLegal(pos, move)) continue;
-            MakeMove(pos, move);
-
             ss->move = move;
             ss->continuation = &thread->continuation[inCheck][moveIsCapture(move)][piece(move)][toSq(move)];
             ss->contCorr = &thread->contCorrHistory[piece(move)][toSq(move)];
 
+            pos = thread->pos = MakeMove(pos, move);
+
             // See if a quiescence search beats the threshold
-            int score = -Quiescence(thread, ss+1, -probCutBeta, -probCutBeta+1);
+            int score = -Quiescence(thread, ss+1, -probCutBeta, -probCutBeta+1, 0);
 
             // If it did, do a proper search with reduced depth
             if (score >= probCutBeta)
                 score = -AlphaBeta(thread, ss+1, -probCutBeta, -probCutBeta+1, depth-4, !cutnode);
 
-            TakeMove(pos);
+            pos = thread->pos = TakeMove(pos);
 
             // Cut if the reduced depth search beats the threshold, terminal scores are exact
-            if (score >= probCutBeta)
+            if (STAT_IF(STAT_PROBCUT, depth, score >= probCutBeta))
                 return isWin(score) ? score : score - 160;
         }
     }
@@ -440,6 +489,7 @@ move_loop:
     int score = -INFINITE;
 
     Color opponent = !sideToMove;
+    bool ttCapture = ttMove && moveIsCapture(ttMove);
 
     // Move loop
     Move move;
@@ -448,7 +498,6 @@ move_loop:
         if (move == ss->excluded) continue;
         if (root && AlreadySearchedMultiPV(thread, move)) continue;
         if (root && NotInSearchMoves(Limits.searchmoves, move)) continue;
-        if (!MoveIsLegal(pos, move)) continue;
 
         moveCount++;
 
@@ -467,15 +516,15 @@ move_loop:
             Depth lmrDepth = depth - 1 - R;
 
             // Quiet late move pruning
-            if (moveCount > (improving ? 2 + depth * depth : depth * depth / 2))
+            if (!mp.onlyNoisy && STAT_IF(STAT_LMP, depth, moveCount > (improving ? 2 + depth * depth : depth * depth / 2)))
                 mp.onlyNoisy = true;
 
             // History pruning
-            if (quiet && lmrDepth < 3 && ss->histScore < -1024 * depth)
+            if (quiet && lmrDepth < 3 && STAT_IF(STAT_HISTORY_PRUNE, depth, ss->histScore < -1024 * depth))
                 continue;
 
             // SEE pruning
-            if (lmrDepth < 7 && !SEE(pos, move, -73 * depth))
+            if (lmrDepth < 7 && STAT_IF(STAT_SEE_PRUNE, depth, !MoveSEE(&mp, move, -73 * depth)))
                 continue;
         }
 
@@ -501,12 +550,12 @@ move_loop:
             ss->excluded = NOMOVE;
 
             // Singular - extend by 1 or 2 ply
-            if (score < singularBeta) {
+            if (STAT_IF(STAT_SINGULAR, depth, score < singularBeta)) {
                 extension = 1;
                 if (!pvNode && score < singularBeta - 1 && ss->doubleExtensions <= 5)
                     extension = 2;
             // MultiCut - ttMove as well as at least one other move seem good enough to beat beta
-            } else if (singularBeta >= beta)
+            } else if (STAT_IF(STAT_MULTICUT, depth, singularBeta >= beta))
                 return singularBeta;
             // Negative extension - not singular but likely still good enough to beat beta or cutnode
             else if (ttScore >= beta || cutnode)
@@ -519,13 +568,15 @@ move_loop:
 
 skip_extensions:
 
-        MakeMove(pos, move);
-
         ss->move = move;
         ss->doubleExtensions = (ss-1)->doubleExtensions + (extension == 2);
         ss->continuation = &thread->continuation[inCheck][moveIsCapture(move)][piece(move)][toSq(move)];
         ss->contCorr = &thread->contCorrHistory[piece(move)][toSq(move)];
 
+        int contBonus = 0;
+
+        pos = thread->pos = MakeMove(pos, move);
+
         Depth newDepth = depth - 1 + extension;
 
         // Reduced depth zero-window search
@@ -542,7 +593,7 @@ skip_extensions:
             // Reduce less when improving
             r -= improving;
             // Reduce quiets more if ttMove is a capture
-            r += moveIsCapture(ttMove);
+            r += ttCapture;
             // Reduce more when opponent has few pieces
             r += pos->nonPawnCount[opponent] < 2;
             // Reduce more in cut nodes
@@ -554,7 +605,8 @@ skip_extensions:
             score = -AlphaBeta(thread, ss+1, -alpha-1, -alpha, lmrDepth, true);
 
             // Re-search with the same window at full depth if the reduced search failed high
-            if (score > alpha && lmrDepth < newDepth) {
+            if (STAT_IF(STAT_LMR, depth, score > alpha && lmrDepth < newDepth)) {
+
                 bool deeper = score > bestScore + 1 + 6 * (newDepth - lmrDepth);
 
                 newDepth += deeper;
@@ -563,7 +615,7 @@ skip_extensions:
 
                 // Update continuation history if the re-search failed high or low
                 if (quiet && (score <= alpha || score >= beta))
-                    UpdateContHistories(ss, move, score >= beta ? Bonus(depth) : Malus(depth));
+                    contBonus = score >= beta ? Bonus(depth) : Malus(depth);
             }
         }
 
@@ -576,7 +628,11 @@ skip_extensions:
             score = -AlphaBeta(thread, ss+1, -beta, -alpha, newDepth, false);
 
         // Undo the move
-        TakeMove(pos);
+        pos = thread->pos = TakeMove(pos);
+
+        // Continuation history is indexed by the moving piece, so update after the takeback
+        if (contBonus)
+            UpdateContHistories(thread, ss, move, contBonus);
 
         if (root) {
             RootMove *rm;
@@ -642,7 +698,7 @@ skip_extensions:
 
     // Update correction history
     if (   !inCheck
-        && !capturing(bestMove)
+        && !(bestMove && moveIsCapture(bestMove))
         && !(bestScore >= beta && bestScore <= ss->staticEval)
         && !(!bestMove && bestScore >= ss->staticEval))
         UpdateCorrectionHistory(thread, ss, bestScore, ss->staticEval, depth);
@@ -653,7 +709,7 @@ skip_extensions:
 // Aspiration window
 static void AspirationWindow(Thread *thread, Stack *ss) {
 
-    Position *pos = &thread->pos;
+    Position *pos = thread->pos;
 
     const bool mainThread = thread->index == 0;
     const int multiPV = thread->multiPV;
@@ -688,16 +744,22 @@ static void AspirationWindow(Thread *thread, Stack *ss) {
             && !Minimal
             && (score <= alpha || score >= beta)
             && TimeSince(Limits.start) > 3000)
-            PrintThinking(thread, alpha, beta);
+            PrintThinking(thread, thread->depth, thread->seldepth, alpha, beta);
+
+        StatTried(STAT_ASPIRATION, thread->depth);
 
         // Failed low, relax lower bound and search again
         if (score <= alpha) {
+            StatSucceeded(STAT_ASPIRATION, thread->depth);
+            thread->failLows++;
             alpha = MAX(alpha - delta, -INFINITE);
             beta  = (alpha + 3 * beta) / 4;
             depth = thread->depth;
 
         // Failed high, relax upper bound and search again
         } else if (score >= beta) {
+            StatSucceeded(STAT_ASPIRATION, thread->depth);
+            thread->failHighs++;
             beta = MIN(beta + delta, INFINITE);
             depth = MAX(1, depth - !isTerminal(score));
 
@@ -717,17 +779,29 @@ static void AspirationWindow(Thread *thread, Stack *ss) {
 static void *IterativeDeepening(void *voidThread) {
 
     Thread *thread = voidThread;
-    Position *pos = &thread->pos;
+    Position *pos = thread->pos;
     Stack *ss = thread->ss+SS_OFFSET;
     bool mainThread = thread->index == 0;
     int multiPV = MIN(Limits.multiPV, thread->rootMoveCount);
 
+    // Info lines are limited to one per interval, the last completed
+    // iteration not printed due to this is printed when the search ends.
+    // Volatile as they are read after the longjmp out of an aborted iteration
+    volatile TimePoint lastInfo = -INFO_INTERVAL;
+    volatile Depth unprinted = 0, unprintedSeldepth = 0;
+
+#ifdef STATS
+    volatile uint64_t iterationStart = 0;
+#endif
+
     // Iterative deepening
     while (++thread->depth <= (mainThread ? Limits.depth : MAX_PLY)) {
 
         // Jump here and return if we run out of allocated time mid-search
         if (setjmp(thread->jumpBuffer)) break;
 
+        thread->seldepth = 0;
+
         // Search the position, once for each multi-pv
         for (thread->multiPV = 0; thread->multiPV < multiPV; ++thread->multiPV)
             AspirationWindow(thread, ss);
@@ -738,9 +812,22 @@ static void *IterativeDeepening(void *voidThread) {
         // Only the main thread concerns itself with the rest
         if (!mainThread) continue;
 
+#ifdef STATS
+        thread->stats.iterationNodes[thread->depth] += pos->nodes - iterationStart;
+        iterationStart = pos->nodes;
+#endif
+
         // Print search info
-        if (!Minimal)
-            PrintThinking(thread, -INFINITE, INFINITE);
+        if (!Minimal && TimeSince(Limits.start) - lastInfo >= INFO_INTERVAL)
+            PrintThinking(thread, thread->depth, thread->seldepth, -INFINITE, INFINITE),
+            lastInfo = TimeSince(Limits.start),
+            unprinted = 0;
+        else
+            unprinted = thread->depth,
+            unprintedSeldepth = thread->seldepth;
+
+        if (Verbose)
+            PrintIteration(thread);
 
         // Stop searching after finding a short enough mate
         if (MATE - abs(thread->rootMoves[0].score) <= 2 * abs(Limits.mate)) break;
@@ -757,10 +844,6 @@ static void *IterativeDeepening(void *voidThread) {
             && !thread->uncertain
             && TimeSince(Limits.start) > Limits.optimalUsage * timeRatio)
             break;
-
-        // Clear key history for seldepth calculation
-        for (int i = 1; i < MAX_PLY; ++i)
-            history(i).key = 0;
     }
 
     // Print final search info in minimal mode
@@ -768,9 +851,13 @@ static void *IterativeDeepening(void *voidThread) {
         // Fix the depth when the search is stopped due to reaching the depth limit
         if (thread->depth > Limits.depth)
             thread->depth--;
-        PrintThinking(thread, -INFINITE, INFINITE);
+        PrintThinking(thread, thread->depth, thread->seldepth, -INFINITE, INFINITE);
     }
 
+    // Make sure the last completed depth is reported before bestmove
+    else if (mainThread && unprinted)
+        PrintThinking(thread, unprinted, unprintedSeldepth, -INFINITE, INFINITE);
+
     return NULL;
 }
 
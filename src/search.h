@@ -38,6 +38,8 @@ extern SearchLimits Limits;
 extern atomic_bool ABORT_SIGNAL;
 extern atomic_bool SEARCH_STOPPED;
 extern atomic_bool Minimal;
+extern atomic_bool Silent; // No search output, for bench printing json or csv
+extern atomic_bool Verbose; // Report the work done in each iteration
 
 
 void *SearchPosition(void *pos);
@@ -0,0 +1,61 @@
+/*
+  Weiss is a UCI compliant chess engine.
+  Copyright (C) 2019-2026 Terje Kirstihagen
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+
+#include "startup.h"
+#include "time.h"
+
+
+/* Startup profiling, each initializer records a mark when it finishes, so
+ * the time between marks is the time spent in it. Constructors of the same
+ * priority run in any order, so the marks are reported in the order seen. */
+
+typedef struct StartupEntry {
+    const char *name;
+    uint64_t ns;
+} StartupEntry;
+
+static StartupEntry Marks[32];
+static int MarkCount;
+
+
+// Records the time when an initializer finishes
+void StartupMark(const char *name) {
+    if (MarkCount < 32)
+        Marks[MarkCount++] = (StartupEntry) { name, NowNs() };
+}
+
+// Marks the start before any other initializer runs
+CONSTR(-1) InitStartup() {
+    StartupMark("start");
+}
+
+// Prints the time spent in each initializer
+void StartupProfile() {
+
+    StartupMark("total");
+
+    puts("Startup profile:");
+
+    for (int i = 1; i < MarkCount - 1; ++i)
+        printf("%-16s %8.3f ms\n", Marks[i].name, (Marks[i].ns - Marks[i-1].ns) / 1e6);
+
+    printf("%-16s %8.3f ms\n", Marks[MarkCount-1].name, (Marks[MarkCount-1].ns - Marks[0].ns) / 1e6);
+    fflush(stdout);
+}
@@ -0,0 +1,92 @@
+/*
+  Weiss is a UCI compliant chess engine.
+  Copyright (C) 2019-2026 Terje Kirstihagen
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "stats.h"
+#include "threads.h"
+
+
+#ifdef STATS
+
+static SearchStats Total;
+
+static const char *FeatureNames[STAT_NB] = {
+    "reverse futility", "null move", "probcut", "singular", "multicut",
+    "late move", "history pruning", "see pruning", "lmr re-search", "aspiration fail"
+};
+
+// Adds the counts of all threads to the totals and resets them
+void CollectStats() {
+
+    for (Thread *t = Threads; t < Threads + Threads->count; ++t) {
+
+        for (StatFeature f = 0; f < STAT_NB; ++f)
+            for (int d = 0; d < STATS_DEPTH; ++d)
+                Total.tried[f][d]     += t->stats.tried[f][d],
+                Total.succeeded[f][d] += t->stats.succeeded[f][d];
+
+        for (int d = 0; d <= MAX_PLY; ++d)
+            Total.iterationNodes[d] += t->stats.iterationNodes[d];
+
+        memset(&t->stats, 0, sizeof(SearchStats));
+    }
+}
+
+// Prints the totals, success rates by depth, and the branching factor of each iteration
+void PrintStats() {
+
+    puts("Search statistics:");
+    printf("%-18s %13s %13s %7s\n", "", "tried", "succeeded", "rate");
+
+    for (StatFeature f = 0; f < STAT_NB; ++f) {
+        uint64_t tried = 0, succeeded = 0;
+        for (int d = 0; d < STATS_DEPTH; ++d)
+            tried += Total.tried[f][d], succeeded += Total.succeeded[f][d];
+        printf("%-18s %13" PRIu64 " %13" PRIu64 " %6.2f%%\n",
+               FeatureNames[f], tried, succeeded, 100.0 * succeeded / MAX(tried, 1));
+    }
+
+    printf("\nSuccess rate by depth (%%), the last column includes greater depths:\n%-18s", "");
+    for (int d = 1; d < STATS_DEPTH; ++d)
+        printf(" %5d", d);
+    printf("\n");
+
+    for (StatFeature f = 0; f < STAT_NB; ++f) {
+        printf("%-18s", FeatureNames[f]);
+        for (int d = 1; d < STATS_DEPTH; ++d)
+            Total.tried[f][d] ? printf(" %5.1f", 100.0 * Total.succeeded[f][d] / Total.tried[f][d])
+                              : printf(" %5s", "-");
+        printf("\n");
+    }
+
+    puts("\nNodes and effective branching factor by iteration:");
+    for (int d = 1; d <= MAX_PLY && Total.iterationNodes[d]; ++d)
+        printf("%5d %13" PRIu64 " %7.2f\n", d, Total.iterationNodes[d],
+               d > 1 ? (double)Total.iterationNodes[d] / MAX(Total.iterationNodes[d-1], 1) : 0.0);
+
+    fflush(stdout);
+    memset(&Total, 0, sizeof(SearchStats));
+}
+
+#else
+
+void CollectStats() {}
+void PrintStats() {}
+
+#endif
@@ -0,0 +1,66 @@
+/*
+  Weiss is a UCI compliant chess engine.
+  Copyright (C) 2019-2026 Terje Kirstihagen
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "types.h"
+
+
+/* Search statistics, only counted in builds with -DSTATS (make stats).
+ * Each thread counts how often the selective features are tried and how
+ * often they succeed, by remaining depth, and bench prints the totals. */
+
+#define STATS_DEPTH 16 // The last bucket holds all greater depths
+
+typedef enum StatFeature {
+    STAT_RFP,           // Succeeded: pruned
+    STAT_NMP,           // Tried per null move search, succeeded: cutoff
+    STAT_PROBCUT,       // Tried per capture searched, succeeded: cutoff
+    STAT_SINGULAR,      // Succeeded: extended
+    STAT_MULTICUT,      // Tried when not singular, succeeded: cutoff
+    STAT_LMP,           // Succeeded: remaining quiets skipped
+    STAT_HISTORY_PRUNE, // Succeeded: pruned
+    STAT_SEE_PRUNE,     // Succeeded: pruned
+    STAT_LMR,           // Succeeded: re-searched at full depth
+    STAT_ASPIRATION,    // Tried per window, succeeded: failed high or low
+    STAT_NB
+} StatFeature;
+
+typedef struct SearchStats {
+    uint64_t tried[STAT_NB][STATS_DEPTH];
+    uint64_t succeeded[STAT_NB][STATS_DEPTH];
+    uint64_t iterationNodes[MAX_PLY + 1]; // Main thread nodes spent on each iteration
+} SearchStats;
+
+// STAT_IF wraps the condition of a feature, counting a try each time it is
+// evaluated and a success when it holds. Without STATS it is just the condition.
+#ifdef STATS
+#define StatsDepth(depth) CLAMP((depth), 0, STATS_DEPTH - 1)
+#define StatTried(feature, depth)     (thread->stats.tried    [feature][StatsDepth(depth)]++)
+#define StatSucceeded(feature, depth) (thread->stats.succeeded[feature][StatsDepth(depth)]++)
+#define STAT_IF(feature, depth, cond) \
+    (StatTried(feature, depth), (cond) ? (StatSucceeded(feature, depth), true) : false)
+#else
+#define StatTried(feature, depth)     ((void)0)
+#define StatSucceeded(feature, depth) ((void)0)
+#define STAT_IF(feature, depth, cond) (cond)
+#endif
+
+
+void CollectStats();
+void PrintStats();
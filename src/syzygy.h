@@ -20,6 +20,7 @@
 
 #include "onlinesyzygy/onlinesyzygy.h"
 #include "pyrrhic/tbprobe.h"
+#include "tbgen/tbgen.h"
 #include "bitboard.h"
 #include "move.h"
 #include "transposition.h"
@@ -36,22 +37,25 @@ static int TBScore(const unsigned result, const int distance) {
 // Probe local Syzygy files using Pyrrhic to get score
 static bool ProbeWDL(const Position *pos, int *score, int *bound, int ply) {
 
+    int pieces = PopCount(pieceBB(ALL));
+
     // Don't probe at root, when castling is possible, or when 50 move rule
     // was not reset by the last move. Finally, there is obviously no point
     // if there are more pieces than we have TBs for.
     if (  !ply
         || pos->castlingRights
         || pos->rule50
-        || PopCount(pieceBB(ALL)) > TB_LARGEST)
+        || pieces > MAX(TB_LARGEST, TBGEN_LARGEST))
         return false;
 
-    // Call Pyrrhic
-    unsigned result = tb_probe_wdl(
-        colorBB(WHITE),  colorBB(BLACK),
-        pieceBB(KING),   pieceBB(QUEEN),
-        pieceBB(ROOK),   pieceBB(BISHOP),
-        pieceBB(KNIGHT), pieceBB(PAWN),
-        pos->epSquare, !sideToMove);
+    // Call Pyrrhic, or fall back to the generated tables
+    unsigned result = pieces > TB_LARGEST ? TBGenProbeWDL(pos)
+                    : tb_probe_wdl(
+                        colorBB(WHITE),  colorBB(BLACK),
+                        pieceBB(KING),   pieceBB(QUEEN),
+                        pieceBB(ROOK),   pieceBB(BISHOP),
+                        pieceBB(KNIGHT), pieceBB(PAWN),
+                        pos->epSquare, !sideToMove);
 
     // Probe failed
     if (result == TB_RESULT_FAILED)
@@ -89,7 +93,7 @@ static bool ProbeRoot(const Position *pos, Move *move, unsigned *wdl, unsigned *
     unsigned to    = TB_GET_TO(result);
     unsigned promo = TB_GET_PROMOTES(result);
 
-    *move = MOVE(from, to, 0, 0, promo ? 6 - promo : 0, 0);
+    *move = MOVE(from, to, promo ? PromoFlag(6 - promo) : FLAG_NONE);
     *wdl = TB_GET_WDL(result);
     *dtz = TB_GET_DTZ(result) - 1;
 
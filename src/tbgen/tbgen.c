@@ -0,0 +1,715 @@
+/*
+  Weiss is a UCI compliant chess engine.
+  Copyright (C) 2019-2026 Terje Kirstihagen
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../bitboard.h"
+#include "../board.h"
+#include "../time.h"
+#include "../pyrrhic/tbprobe.h"
+#include "tbgen.h"
+
+
+bool TBGen = false;
+int TBGenMemory = TBGEN_MEMORY_DEFAULT;
+atomic_int TBGEN_LARGEST = 0;
+
+static int currentMB = 0;
+
+// Generation runs in the background so it never holds up isready or go
+static pthread_t Generator;
+static bool GeneratorRunning = false;
+static atomic_bool Cancel = false;
+
+
+// All 3 and 4 man tables in an order where each only depends on earlier
+// ones through captures and promotions. KPKP is left out as it is the only
+// one where en passant can happen, which the generator doesn't handle.
+static const char *TableNames[][2] = {
+    { "KQ",  "k"  }, { "KR",  "k"  }, { "KB",  "k"  }, { "KN",  "k"  },
+    { "KP",  "k"  },
+    { "KQQ", "k"  }, { "KQR", "k"  }, { "KQB", "k"  }, { "KQN", "k"  },
+    { "KRR", "k"  }, { "KRB", "k"  }, { "KRN", "k"  }, { "KBB", "k"  },
+    { "KBN", "k"  }, { "KNN", "k"  },
+    { "KQ",  "kq" }, { "KQ",  "kr" }, { "KQ",  "kb" }, { "KQ",  "kn" },
+    { "KR",  "kr" }, { "KR",  "kb" }, { "KR",  "kn" }, { "KB",  "kb" },
+    { "KB",  "kn" }, { "KN",  "kn" },
+    { "KQP", "k"  }, { "KRP", "k"  }, { "KBP", "k"  }, { "KNP", "k"  },
+    { "KQ",  "kp" }, { "KR",  "kp" }, { "KB",  "kp" }, { "KN",  "kp" },
+    { "KPP", "k"  },
+};
+
+#define TABLE_NB (int)(sizeof(TableNames) / sizeof(TableNames[0]))
+#define SIG_NB 64
+
+// Pieces are ordered white king, black king, then white's and black's
+// other pieces from most to least valuable. Positions are indexed with
+// the white king restricted by symmetry: to the a1-d1-d4 triangle in
+// pawnless tables, and to files a-d in tables with pawns.
+typedef struct TBTable {
+    int n;
+    bool pawns;
+    Piece pieces[4];
+    size_t size;
+    uint8_t *data; // 2 bits per position
+    atomic_bool ready; // Set once data is complete, probes ignore the table until then
+} TBTable;
+
+static TBTable Tables[TABLE_NB];
+static TBTable *TableMap[SIG_NB][SIG_NB];
+
+static int KingIndex[2][64];
+static Square KingSquare[2][32];
+static const int KingDomain[2] = { 10, 32 };
+
+static const char PieceChars[] = ".PNBRQK..pnbrqk";
+
+// Final results, from the side to move's point of view
+enum { TB_GEN_DRAW, TB_GEN_WIN, TB_GEN_LOSS };
+
+// States during generation, in the low 3 bits
+enum { UNKNOWN, INVALID, WIN, LOSS, DRAW };
+
+// Flags during generation: ESCAPE means a capture or promotion avoids a loss,
+// VERIFY that the position may be lost, PENDING and NEXT that its predecessors
+// are yet to be visited in the current or next pass
+enum { ESCAPE = 8, VERIFY = 16, PENDING = 32, NEXT = 64 };
+
+#define STATE(s) ((s) & 7)
+
+
+static void InitKingIndex() {
+
+    int count[2] = { 0, 0 };
+
+    for (Square sq = A1; sq <= H8; ++sq) {
+
+        bool inTriangle = FileOf(sq) <= FILE_D && RankOf(sq) <= FileOf(sq);
+        bool inHalf     = FileOf(sq) <= FILE_D;
+
+        KingIndex[0][sq] = inTriangle ? count[0] : -1;
+        KingIndex[1][sq] = inHalf     ? count[1] : -1;
+
+        if (inTriangle) KingSquare[0][count[0]++] = sq;
+        if (inHalf)     KingSquare[1][count[1]++] = sq;
+    }
+}
+
+// Material signature of one side's non-king pieces, sorted by value
+static int Signature(const PieceType *types, int count) {
+    return count == 0 ? 0
+         : count == 1 ? types[0] * 8
+                      : types[0] * 8 + types[1];
+}
+
+INLINE Square FlipDiagonal(Square sq) {
+    return (sq >> 3) | ((sq & 7) << 3);
+}
+
+// Index of the squares as they are, ordering identical pieces
+static size_t RawIndex(const TBTable *tb, const Square *sq, Color stm) {
+
+    Square s2 = sq[2], s3 = sq[3];
+
+    if (tb->n == 4 && tb->pieces[2] == tb->pieces[3] && s2 > s3)
+        s2 = sq[3], s3 = sq[2];
+
+    size_t idx = stm * KingDomain[tb->pawns] + KingIndex[tb->pawns][sq[0]];
+    idx = idx * 64 + sq[1];
+    idx = idx * 64 + s2;
+    if (tb->n == 4)
+        idx = idx * 64 + s3;
+
+    return idx;
+}
+
+// Index of the canonical position among those equal by symmetry
+static size_t Index(const TBTable *tb, const Square *squares, Color stm) {
+
+    Square sq[4];
+    memcpy(sq, squares, sizeof(sq));
+
+    if (FileOf(sq[0]) > FILE_D)
+        for (int i = 0; i < tb->n; ++i)
+            sq[i] ^= 7;
+
+    if (tb->pawns)
+        return RawIndex(tb, sq, stm);
+
+    if (RankOf(sq[0]) > RANK_4)
+        for (int i = 0; i < tb->n; ++i)
+            sq[i] ^= 56;
+
+    if (RankOf(sq[0]) > FileOf(sq[0]))
+        for (int i = 0; i < tb->n; ++i)
+            sq[i] = FlipDiagonal(sq[i]);
+
+    size_t idx = RawIndex(tb, sq, stm);
+
+    // A king on the diagonal allows a second form, use the lowest index
+    if (RankOf(sq[0]) == FileOf(sq[0])) {
+        for (int i = 0; i < tb->n; ++i)
+            sq[i] = FlipDiagonal(sq[i]);
+        idx = MIN(idx, RawIndex(tb, sq, stm));
+    }
+
+    return idx;
+}
+
+static Color Decode(const TBTable *tb, size_t idx, Square *sq) {
+
+    if (tb->n == 4)
+        sq[3] = idx % 64, idx /= 64;
+
+    sq[2] = idx % 64, idx /= 64;
+    sq[1] = idx % 64, idx /= 64;
+    sq[0] = KingSquare[tb->pawns][idx % KingDomain[tb->pawns]];
+
+    return idx / KingDomain[tb->pawns];
+}
+
+static int Result(const TBTable *tb, size_t idx) {
+    return (tb->data[idx / 4] >> (2 * (idx % 4))) & 3;
+}
+
+// Looks up a position given as an unordered list of pieces, returns -1 if there is no table
+static int Lookup(const Piece *pc, const Square *sq, int n, Color stm) {
+
+    if (n == 2) return TB_GEN_DRAW;
+
+    Square kings[COLOR_NB], squares[COLOR_NB][2];
+    PieceType types[COLOR_NB][2];
+    int count[COLOR_NB] = { 0, 0 };
+
+    // Split the pieces by color, sorting the non-kings by value
+    for (int i = 0; i < n; ++i) {
+
+        Color c = ColorOf(pc[i]);
+        PieceType pt = PieceTypeOf(pc[i]);
+
+        if (pt == KING) {
+            kings[c] = sq[i];
+            continue;
+        }
+
+        if (count[c] == 2) return -1;
+
+        int j = count[c]++;
+        for (; j > 0 && types[c][j-1] < pt; --j)
+            types[c][j] = types[c][j-1],
+            squares[c][j] = squares[c][j-1];
+
+        types[c][j] = pt;
+        squares[c][j] = sq[i];
+    }
+
+    int sig[COLOR_NB] = { Signature(types[WHITE], count[WHITE]),
+                          Signature(types[BLACK], count[BLACK]) };
+
+    // Tables have the stronger material as white, flip colors if needed
+    Color strong = sig[WHITE] >= sig[BLACK] ? WHITE : BLACK;
+    Square flip = strong == WHITE ? 0 : 56;
+
+    TBTable *tb = TableMap[sig[strong]][sig[!strong]];
+
+    if (tb == NULL || !tb->ready) return -1;
+
+    Square s[4] = { kings[strong] ^ flip, kings[!strong] ^ flip };
+    int k = 2;
+
+    for (int i = 0; i < count[strong]; ++i)
+        s[k++] = squares[strong][i] ^ flip;
+    for (int i = 0; i < count[!strong]; ++i)
+        s[k++] = squares[!strong][i] ^ flip;
+
+    return Result(tb, Index(tb, s, strong == WHITE ? stm : !stm));
+}
+
+static Bitboard Occupied(const Square *sq, int n) {
+    Bitboard occ = 0;
+    for (int i = 0; i < n; ++i)
+        occ |= BB(sq[i]);
+    return occ;
+}
+
+// Whether the king of the given color is attacked
+static bool InCheck(const Piece *pc, const Square *sq, int n, Color color) {
+
+    Bitboard occ = Occupied(sq, n);
+    Square king = 0;
+
+    for (int i = 0; i < n; ++i)
+        if (pc[i] == MakePiece(color, KING))
+            king = sq[i];
+
+    for (int i = 0; i < n; ++i)
+        if (   ColorOf(pc[i]) != color
+            && PieceAttackBB(pc[i], sq[i], occ) & BB(king))
+            return true;
+
+    return false;
+}
+
+typedef struct Scan {
+    int legal;       // Legal moves
+    int inTable;     // Legal moves staying within the table
+    bool exitWin;    // A capture or promotion wins
+    bool exitEscape; // A capture or promotion doesn't lose
+} Scan;
+
+// Goes through the legal moves of a position, looking up the results of
+// captures and promotions. Returns false if a needed table is missing.
+static bool ScanMoves(const TBTable *tb, const Square *sq, Color stm, Scan *scan) {
+
+    const int n = tb->n;
+    const Piece *pc = tb->pieces;
+    const Direction up = stm == WHITE ? NORTH : SOUTH;
+
+    *scan = (Scan) { 0, 0, false, false };
+
+    Bitboard occ = Occupied(sq, n), us = 0;
+    for (int i = 0; i < n; ++i)
+        if (ColorOf(pc[i]) == stm)
+            us |= BB(sq[i]);
+
+    // Find squares attacked by the opponent, checks and pins, so only
+    // moves by pinned pieces or out of check need a full legality test
+    Square king = sq[stm == WHITE ? 0 : 1];
+    Bitboard danger = 0, pinned = 0;
+    bool inCheck = false;
+
+    for (int j = 0; j < n; ++j) {
+
+        if (ColorOf(pc[j]) == stm) continue;
+
+        Bitboard attacks = PieceAttackBB(pc[j], sq[j], occ ^ BB(king));
+        Bitboard between = BetweenBB[sq[j]][king] & occ;
+
+        danger |= attacks;
+        inCheck |= (attacks & BB(king)) != 0;
+
+        if (   PieceTypeOf(pc[j]) >= BISHOP && PieceTypeOf(pc[j]) <= QUEEN
+            && AttackBB(PieceTypeOf(pc[j]), sq[j], 0) & BB(king)
+            && Single(between))
+            pinned |= between & us;
+    }
+
+    for (int i = 0; i < n; ++i) {
+
+        if (ColorOf(pc[i]) != stm) continue;
+
+        PieceType pt = PieceTypeOf(pc[i]);
+        Bitboard targets;
+
+        if (pt == PAWN) {
+            targets = PawnAttackBB(stm, sq[i]) & occ & ~us;
+            if (!(occ & BB(sq[i] + up))) {
+                targets |= BB(sq[i] + up);
+                if (   RelativeRank(stm, RankOf(sq[i])) == RANK_2
+                    && !(occ & BB(sq[i] + 2 * up)))
+                    targets |= BB(sq[i] + 2 * up);
+            }
+        } else
+            targets = AttackBB(pt, sq[i], occ) & ~us;
+
+        while (targets) {
+
+            Square to = PopLsb(&targets);
+            Piece cpc[4];
+            Square csq[4];
+            int cn = 0;
+
+            // Build the resulting piece list, leaving out any captured piece
+            for (int j = 0; j < n; ++j)
+                if (j == i)
+                    cpc[cn] = pc[j], csq[cn++] = to;
+                else if (sq[j] != to)
+                    cpc[cn] = pc[j], csq[cn++] = sq[j];
+
+            if (  pt == KING ? (danger & BB(to)) != 0
+                : inCheck || (pinned & BB(sq[i])) ? InCheck(cpc, csq, cn, stm)
+                                                  : false)
+                continue;
+
+            scan->legal++;
+
+            bool promotion = pt == PAWN && RelativeRank(stm, RankOf(to)) == RANK_8;
+
+            if (cn == n && !promotion) {
+                scan->inTable++;
+                continue;
+            }
+
+            // Captures and promotions lead to other tables
+            for (PieceType promo = QUEEN; promo >= (promotion ? KNIGHT : QUEEN); --promo) {
+
+                for (int j = 0; j < cn && promotion; ++j)
+                    if (csq[j] == to)
+                        cpc[j] = MakePiece(stm, promo);
+
+                int result = Lookup(cpc, csq, cn, !stm);
+
+                if (result < 0) return false;
+
+                scan->exitWin    |= result == TB_GEN_LOSS;
+                scan->exitEscape |= result != TB_GEN_WIN;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Whether all moves staying within the table lead to positions won for the opponent.
+// Illegal moves lead to positions marked invalid, so no separate check is needed.
+static bool AllMovesLose(const TBTable *tb, const uint8_t *gen, Square *sq, Color stm) {
+
+    const Direction up = stm == WHITE ? NORTH : SOUTH;
+
+    Bitboard occ = Occupied(sq, tb->n);
+
+    for (int i = 0; i < tb->n; ++i) {
+
+        if (ColorOf(tb->pieces[i]) != stm) continue;
+
+        PieceType pt = PieceTypeOf(tb->pieces[i]);
+        Square from = sq[i];
+        Bitboard targets;
+
+        if (pt == PAWN) {
+            targets = 0;
+            if (   RelativeRank(stm, RankOf(from)) < RANK_7
+                && !(occ & BB(from + up))) {
+                targets |= BB(from + up);
+                if (   RelativeRank(stm, RankOf(from)) == RANK_2
+                    && !(occ & BB(from + 2 * up)))
+                    targets |= BB(from + 2 * up);
+            }
+        } else
+            targets = AttackBB(pt, from, occ) & ~occ;
+
+        while (targets) {
+
+            sq[i] = PopLsb(&targets);
+
+            int state = STATE(gen[Index(tb, sq, !stm)]);
+
+            if (state != WIN && state != INVALID)
+                return sq[i] = from, false;
+        }
+
+        sq[i] = from;
+    }
+
+    return true;
+}
+
+// Whether a position is legal and the canonical form of its symmetry class
+static bool Valid(const TBTable *tb, const Square *sq, Color stm, size_t idx) {
+
+    Bitboard occ = Occupied(sq, tb->n);
+
+    if (PopCount(occ) != tb->n || Distance(sq[0], sq[1]) <= 1)
+        return false;
+
+    for (int i = 2; i < tb->n; ++i)
+        if (PieceTypeOf(tb->pieces[i]) == PAWN && (BB(sq[i]) & (rank1BB | rank8BB)))
+            return false;
+
+    return !InCheck(tb->pieces, sq, tb->n, !stm)
+        && Index(tb, sq, stm) == idx;
+}
+
+// Retrograde analysis: after classifying positions whose result follows directly
+// from their moves, results are propagated backwards from each newly decided position.
+// A predecessor of a lost position is won. A predecessor of a won position is lost
+// if verifying all its moves shows they all lead to won positions. Verifying instead of
+// counting remaining moves keeps symmetric duplicates of a move from being counted twice.
+static bool Generate(TBTable *tb) {
+
+    uint8_t *gen = calloc(tb->size, 1);
+    Square sq[4];
+    Scan scan;
+
+    if (!gen)
+        return false;
+
+    // Classify positions by their captures, promotions, mates and stalemates
+    for (size_t idx = 0; idx < tb->size; ++idx) {
+
+        if (idx % 65536 == 0 && Cancel)
+            return free(gen), false;
+
+        Color stm = Decode(tb, idx, sq);
+
+        if (!Valid(tb, sq, stm, idx)) {
+            gen[idx] = INVALID;
+            continue;
+        }
+
+        if (!ScanMoves(tb, sq, stm, &scan))
+            return free(gen), false;
+
+        gen[idx] = !scan.legal       ? (InCheck(tb->pieces, sq, tb->n, stm) ? LOSS | PENDING : DRAW)
+                 : scan.exitWin      ? WIN | PENDING
+                 : scan.inTable      ? (scan.exitEscape ? ESCAPE : UNKNOWN)
+                 : scan.exitEscape   ? DRAW
+                                     : LOSS | PENDING;
+    }
+
+    bool changed = true;
+
+    // Propagate backwards until nothing changes
+    while (changed) {
+
+        changed = false;
+
+        if (Cancel)
+            return free(gen), false;
+
+        for (size_t idx = 0; idx < tb->size; ++idx) {
+
+            if (!(gen[idx] & PENDING)) continue;
+
+            gen[idx] &= ~PENDING;
+
+            Color stm = Decode(tb, idx, sq);
+            Color mover = !stm;
+            Direction up = mover == WHITE ? NORTH : SOUTH;
+            Bitboard occ = Occupied(sq, tb->n);
+            bool lost = STATE(gen[idx]) == LOSS;
+
+            // Undo each possible non-capturing move by the side that just moved
+            for (int i = 0; i < tb->n; ++i) {
+
+                if (ColorOf(tb->pieces[i]) != mover) continue;
+
+                PieceType pt = PieceTypeOf(tb->pieces[i]);
+                Square to = sq[i];
+                Bitboard froms = 0;
+
+                if (pt == PAWN) {
+                    int rank = RelativeRank(mover, RankOf(to));
+                    if (rank >= RANK_3 && !(occ & BB(to - up))) {
+                        froms |= BB(to - up);
+                        if (rank == RANK_4 && !(occ & BB(to - 2 * up)))
+                            froms |= BB(to - 2 * up);
+                    }
+                } else
+                    froms = AttackBB(pt, to, occ) & ~occ;
+
+                while (froms) {
+
+                    sq[i] = PopLsb(&froms);
+
+                    uint8_t *pred = &gen[Index(tb, sq, mover)];
+
+                    if (STATE(*pred) != UNKNOWN) continue;
+
+                    // Won positions are marked right away, possible losses are verified
+                    // once the pass is complete so each is checked only once per pass
+                    if (lost)
+                        *pred = WIN | NEXT;
+                    else if (!(*pred & ESCAPE))
+                        *pred |= VERIFY;
+                }
+
+                sq[i] = to;
+            }
+        }
+
+        for (size_t idx = 0; idx < tb->size; ++idx) {
+
+            if (gen[idx] & VERIFY) {
+
+                Color stm = Decode(tb, idx, sq);
+
+                gen[idx] = AllMovesLose(tb, gen, sq, stm) ? LOSS | NEXT : UNKNOWN;
+            }
+
+            if (gen[idx] & NEXT)
+                gen[idx] ^= NEXT | PENDING, changed = true;
+        }
+    }
+
+    // Pack results, anything still unknown is a draw
+    tb->data = calloc((tb->size + 3) / 4, 1);
+
+    if (!tb->data)
+        return free(gen), false;
+
+    for (size_t idx = 0; idx < tb->size; ++idx) {
+        int result = STATE(gen[idx]) == WIN  ? TB_GEN_WIN
+                   : STATE(gen[idx]) == LOSS ? TB_GEN_LOSS
+                                             : TB_GEN_DRAW;
+        tb->data[idx / 4] |= result << (2 * (idx % 4));
+    }
+
+    free(gen);
+
+    tb->ready = true;
+
+    return true;
+}
+
+// Sets up the table definitions
+static void InitTables() {
+
+    InitKingIndex();
+
+    memset(TableMap, 0, sizeof(TableMap));
+
+    for (int t = 0; t < TABLE_NB; ++t) {
+
+        TBTable *tb = &Tables[t];
+        const char *white = TableNames[t][0] + 1;
+        const char *black = TableNames[t][1] + 1;
+        PieceType types[COLOR_NB][2];
+        int count[COLOR_NB] = { 0, 0 };
+
+        tb->n = 2;
+        tb->pawns = false;
+        tb->pieces[0] = wK;
+        tb->pieces[1] = bK;
+
+        for (; *white; ++white) {
+            tb->pieces[tb->n++] = strchr(PieceChars, *white) - PieceChars;
+            types[WHITE][count[WHITE]++] = PieceTypeOf(tb->pieces[tb->n-1]);
+        }
+
+        for (; *black; ++black) {
+            tb->pieces[tb->n++] = strchr(PieceChars, *black) - PieceChars;
+            types[BLACK][count[BLACK]++] = PieceTypeOf(tb->pieces[tb->n-1]);
+        }
+
+        for (int i = 2; i < tb->n; ++i)
+            tb->pawns |= PieceTypeOf(tb->pieces[i]) == PAWN;
+
+        tb->size = 2 * KingDomain[tb->pawns];
+        for (int i = 1; i < tb->n; ++i)
+            tb->size *= 64;
+
+        TableMap[Signature(types[WHITE], count[WHITE])]
+                [Signature(types[BLACK], count[BLACK])] = tb;
+    }
+}
+
+// Frees all generated tables
+static void FreeTables() {
+
+    for (int t = 0; t < TABLE_NB; ++t) {
+        Tables[t].ready = false;
+        free(Tables[t].data);
+        Tables[t].data = NULL;
+    }
+
+    TBGEN_LARGEST = 0;
+}
+
+// Generates as many tables as fit in the memory budget, each can
+// be probed as soon as it is done. The budget also covers the byte
+// per position working buffer of the table being generated.
+static void *GenerateTables(void *arg) {
+
+    TimePoint start = Now();
+    size_t budget = (size_t)*(int *)arg * 1024 * 1024;
+    size_t used = 0;
+    int generated = 0;
+
+    for (int t = 0; t < TABLE_NB && !Cancel; ++t) {
+
+        TBTable *tb = &Tables[t];
+        size_t bytes = (tb->size + 3) / 4;
+
+        if (used + bytes + tb->size > budget || !Generate(tb))
+            continue;
+
+        used += bytes;
+        generated++;
+        TBGEN_LARGEST = MAX(TBGEN_LARGEST, tb->n);
+    }
+
+    if (!Cancel)
+        printf("info string TBGen: %d of %d tables generated, %d MB, %d ms\n",
+               generated, TABLE_NB, (int)(used / (1024 * 1024)), TimeSince(start)),
+        fflush(stdout);
+
+    return NULL;
+}
+
+// Stops any generation in progress and frees the tables
+static void StopTBGen() {
+
+    if (GeneratorRunning) {
+        Cancel = true;
+        pthread_join(Generator, NULL);
+        GeneratorRunning = false;
+    }
+
+    FreeTables();
+}
+
+// Starts generating or frees the tables according to the options,
+// probes fail for each table until it has been generated
+void InitTBGen() {
+
+    int requestedMB = TBGen ? TBGenMemory : 0;
+
+    // Skip if already in the requested state
+    if (requestedMB == currentMB)
+        return;
+
+    StopTBGen();
+
+    currentMB = requestedMB;
+
+    if (!requestedMB)
+        return;
+
+    InitTables();
+
+    Cancel = false;
+    GeneratorRunning = !pthread_create(&Generator, NULL, GenerateTables, &currentMB);
+}
+
+// Probes the generated tables, returning a Pyrrhic style WDL result
+unsigned TBGenProbeWDL(const Position *pos) {
+
+    if (pos->epSquare || PopCount(pieceBB(ALL)) > TBGEN_LARGEST)
+        return TB_RESULT_FAILED;
+
+    Piece pc[4];
+    Square sq[4];
+    int n = 0;
+
+    Bitboard pieces = pieceBB(ALL);
+    while (pieces)
+        sq[n] = PopLsb(&pieces),
+        pc[n] = pieceOn(sq[n]),
+        n++;
+
+    int result = Lookup(pc, sq, n, sideToMove);
+
+    return result < 0               ? TB_RESULT_FAILED
+         : result == TB_GEN_WIN     ? TB_WIN
+         : result == TB_GEN_LOSS    ? TB_LOSS
+                                    : TB_DRAW;
+}
@@ -0,0 +1,34 @@
+/*
+  Weiss is a UCI compliant chess engine.
+  Copyright (C) 2019-2026 Terje Kirstihagen
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "../board.h"
+#include "../types.h"
+
+
+#define TBGEN_MEMORY_DEFAULT 96
+
+
+extern bool TBGen;
+extern int TBGenMemory;
+extern atomic_int TBGEN_LARGEST;
+
+
+void InitTBGen();
+unsigned TBGenProbeWDL(const Position *pos);
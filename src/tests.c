@@ -16,15 +16,20 @@
   along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
+#include <ctype.h>
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "board.h"
+#include "counters.h"
+#include "cpu.h"
 #include "evaluate.h"
 #include "makemove.h"
 #include "move.h"
 #include "movegen.h"
 #include "search.h"
+#include "stats.h"
 #include "threads.h"
 #include "tests.h"
 #include "time.h"
@@ -86,117 +91,820 @@ static const char *BenchmarkFENs[] = {
     "2r2b2/5p2/5k2/p1r1pP2/P2pB3/1P3P2/K1P3R1/7R w - - 23 93",
 };
 
+typedef enum BenchFormat { BENCH_TEXT, BENCH_JSON, BENCH_CSV } BenchFormat;
+
+typedef struct BenchOptions {
+    Depth depth;
+    uint64_t nodes;
+    int movetime;
+    int threads;
+    int hashMB;
+    int runs;
+    int warmup;
+    bool clearTT;
+    bool perf;
+    bool scaling;
+    BenchFormat format;
+    const char *file;
+    const char **fens;
+    int count;
+} BenchOptions;
+
 typedef struct BenchResult {
     TimePoint elapsed;
     uint64_t nodes;
     int score;
     Move best;
+    PerfCounts counts;
 } BenchResult;
 
-void Benchmark(int argc, char **argv) {
+typedef struct BenchRun {
+    BenchResult *results;
+    uint64_t *threadNodes; // Optional, nodes searched by each thread
+    TimePoint elapsed;
+    uint64_t nodes;
+    PerfCounts counts;
+} BenchRun;
+
+// Summary of a set of runs of the same positions
+typedef struct BenchStats {
+    double npsMean;
+    double npsMedian;
+    double npsStdev;
+    double timeMean;
+    double nodesMean;
+} BenchStats;
+
+
+INLINE int RunNPS(const BenchRun *run) {
+    return 1000.0 * run->nodes / MAX(run->elapsed, 1);
+}
+
+INLINE int ResultNPS(const BenchResult *r) {
+    return 1000.0 * r->nodes / (r->elapsed + 1);
+}
+
+static int CompareDouble(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static const char *BenchUsage =
+    "Usage: bench [depth] [threads] [hash] [perf] [scaling] [verbose] [<option>=<value> ...]\n"
+    "Options: depth, nodes, movetime, file, cleartt, threads, hash, runs, warmup, format=text|json|csv\n";
+
+// Parses the bench arguments. Options are given as name=value, and
+// can be mixed with the perf keyword and the positional depth, threads
+// and hash of older versions. Returns false on anything it doesn't know.
+static bool ParseBenchOptions(int argc, char **argv, BenchOptions *opts) {
+
+    *opts = (BenchOptions) {
+        .hashMB = HASH_DEFAULT, .runs = 1, .clearTT = true,
+        .fens = BenchmarkFENs, .count = sizeof(BenchmarkFENs) / sizeof(char *)
+    };
+
+    int *positional[] = { &opts->depth, &opts->threads, &opts->hashMB };
+    int n = 0;
+
+    for (int i = 2; i < argc; ++i) {
+
+        char *arg = argv[i];
+
+        #define OptionIs(name) (!strncmp(arg, name "=", strlen(name "=")))
+        #define OptionValue    (strchr(arg, '=') + 1)
+
+        if      (!strcmp(arg, "perf"))  opts->perf    = true;
+        else if (!strcmp(arg, "scaling")) opts->scaling = true;
+        else if (!strcmp(arg, "verbose")) Verbose       = true;
+        else if (OptionIs("depth"))     opts->depth   = atoi(OptionValue);
+        else if (OptionIs("nodes"))     opts->nodes   = strtoull(OptionValue, NULL, 10);
+        else if (OptionIs("movetime"))  opts->movetime = atoi(OptionValue);
+        else if (OptionIs("cleartt"))   opts->clearTT = strcmp(OptionValue, "false");
+        else if (OptionIs("file"))      opts->file    = OptionValue;
+        else if (OptionIs("threads"))   opts->threads = atoi(OptionValue);
+        else if (OptionIs("hash"))      opts->hashMB  = atoi(OptionValue);
+        else if (OptionIs("runs"))      opts->runs    = MAX(1, atoi(OptionValue));
+        else if (OptionIs("warmup"))    opts->warmup  = MAX(0, atoi(OptionValue));
+        else if (OptionIs("format") && !strcmp(OptionValue, "text")) opts->format = BENCH_TEXT;
+        else if (OptionIs("format") && !strcmp(OptionValue, "json")) opts->format = BENCH_JSON;
+        else if (OptionIs("format") && !strcmp(OptionValue, "csv"))  opts->format = BENCH_CSV;
+        else if (!strchr(arg, '=') && n < 3) *positional[n++] = atoi(arg);
+        else {
+            fprintf(stderr, OptionIs("format") ? "Unknown bench format %s\n"
+                                               : "Unknown bench option %s\n", arg);
+            fputs(BenchUsage, stderr);
+            return false;
+        }
+    }
+
+    // Depth 14 unless limited some other way
+    opts->depth = opts->depth ?: opts->nodes || opts->movetime ? MAX_PLY : 14;
+
+    // Scaling goes up to all hardware threads unless told otherwise
+    opts->threads = MAX(1, opts->threads ?: opts->scaling ? CPUThreads() : 1);
+
+    return true;
+}
+
+// Reads positions from a file with one FEN or EPD per line, EPD operations
+// are dropped, as are lines without exactly one king per side. Returns the
+// number of positions read or -1 on failure.
+static int ReadBenchFile(const char *path, const char ***fens) {
+
+    *fens = NULL;
+
+    FILE *file = fopen(path, "r");
+    if (!file) return -1;
+
+    char line[1024];
+    int count = 0, size = 0, lineNo = 0;
+
+    while (fgets(line, sizeof(line), file)) {
+
+        lineNo++;
+
+        // The first four fields are the same in both, FEN adds the move counters
+        char *fields[6], *save;
+        int n = 0;
+        for (char *token = strtok_r(line, " \t\r\n", &save); token && n < 6; token = strtok_r(NULL, " \t\r\n", &save))
+            fields[n++] = token;
+
+        if (n < 4 || fields[0][0] == '#') continue;
+
+        // The search can't handle a side without its king
+        int kings[2] = { 0 };
+        for (char *c = fields[0]; *c; ++c)
+            kings[0] += *c == 'K', kings[1] += *c == 'k';
+
+        if (kings[0] != 1 || kings[1] != 1) {
+            fprintf(stderr, "Skipping line %d of %s, it needs one king per side\n", lineNo, path);
+            continue;
+        }
+
+        bool counters = n == 6 && isdigit(fields[4][0]) && isdigit(fields[5][0]);
+
+        char fen[128];
+        snprintf(fen, sizeof(fen), "%s %s %s %s %s %s", fields[0], fields[1], fields[2], fields[3],
+                 counters ? fields[4] : "0", counters ? fields[5] : "1");
+
+        if (count == size)
+            size = MAX(64, 2 * size),
+            *fens = realloc(*fens, size * sizeof(char *));
+
+        (*fens)[count++] = strdup(fen);
+    }
+
+    fclose(file);
+    return count;
+}
 
-    // Default depth 16, 1 thread, and 32MB hash
-    Limits.depth     = argc > 2 ? atoi(argv[2]) : 14;
-    int threadCount  = argc > 3 ? atoi(argv[3]) : 1;
-    TT.requestedMB   = argc > 4 ? atoi(argv[4]) : HASH_DEFAULT;
+// Searches each position once, from a fresh state so runs are repeatable
+static void RunBench(const BenchOptions *opts, BenchRun *run) {
 
     Position pos;
-    InitThreads(threadCount);
-    InitTT();
+    PerfCounts before, after;
 
-    int FENCount = sizeof(BenchmarkFENs) / sizeof(char *);
-    BenchResult results[FENCount];
-    TimePoint totalElapsed = 1; // Avoid possible div/0
-    uint64_t totalNodes = 0;
+    InitThreads(opts->threads);
+    ClearTT();
+    memset(&run->counts, 0, sizeof(PerfCounts));
+    run->elapsed = run->nodes = 0;
+    if (run->threadNodes)
+        memset(run->threadNodes, 0, opts->threads * sizeof(uint64_t));
 
-    for (int i = 0; i < FENCount; ++i) {
+    for (int i = 0; i < opts->count; ++i) {
 
-        printf("[# %2d] %s\n", i + 1, BenchmarkFENs[i]);
+        if (!Silent)
+            printf("[# %2d] %s\n", i + 1, opts->fens[i]);
 
         // Search
-        ParseFen(BenchmarkFENs[i], &pos);
+        ParseFen(opts->fens[i], &pos);
         ABORT_SIGNAL = false;
+        if (opts->perf) ReadPerfCounters(&before);
         Limits.start = Now();
         SearchPosition(&pos);
+        if (opts->perf) ReadPerfCounters(&after);
 
         // Collect results
-        BenchResult *r = &results[i];
+        BenchResult *r = &run->results[i];
+        for (PerfCounter c = 0; opts->perf && c < PC_NB; ++c)
+            r->counts.value[c] = after.value[c] - before.value[c],
+            run->counts.value[c] += r->counts.value[c];
         r->elapsed = TimeSince(Limits.start);
         r->nodes   = TotalNodes();
         r->score   = Threads->rootMoves[0].score;
         r->best    = Threads->rootMoves[0].move;
 
-        totalElapsed += r->elapsed;
-        totalNodes   += r->nodes;
+        for (int t = 0; run->threadNodes && t < opts->threads; ++t)
+            run->threadNodes[t] += Threads[t].pos->nodes;
+
+        run->elapsed += r->elapsed;
+        run->nodes   += r->nodes;
+
+        CollectStats();
 
-        ClearTT();
+        if (opts->clearTT)
+            ClearTT();
     }
+}
+
+// Mean, median and stdev of the nps of each run, and the mean time and nodes
+static BenchStats RunStats(const BenchRun *runs, const int count) {
+
+    BenchStats stats = { 0 };
+    double nps[count];
+
+    for (int i = 0; i < count; ++i)
+        nps[i] = RunNPS(&runs[i]),
+        stats.npsMean   += nps[i] / count,
+        stats.timeMean  += (double)runs[i].elapsed / count,
+        stats.nodesMean += (double)runs[i].nodes / count;
+    for (int i = 0; i < count && count > 1; ++i)
+        stats.npsStdev += (nps[i] - stats.npsMean) * (nps[i] - stats.npsMean) / (count - 1);
+    stats.npsStdev = sqrt(stats.npsStdev);
+    qsort(nps, count, sizeof(double), CompareDouble);
+    stats.npsMedian = (nps[(count - 1) / 2] + nps[count / 2]) / 2;
+
+    return stats;
+}
+
+// Prints the main counter ratios on one line
+static void PrintPerfLine(const PerfCounts *counts, const uint64_t nodes) {
+    printf("        %6.2f IPC %8.1f cycles/node %6.3f LLC-misses/node %6.3f branch-misses/node\n",
+           (double)counts->value[PC_INSTRUCTIONS] / MAX(counts->value[PC_CYCLES], 1),
+           (double)counts->value[PC_CYCLES] / MAX(nodes, 1),
+           (double)counts->value[PC_LLC_MISSES] / MAX(nodes, 1),
+           (double)counts->value[PC_BRANCH_MISSES] / MAX(nodes, 1));
+}
+
+// Prints counter totals and their ratios per node
+static void PrintPerfCounts(const PerfCounts *counts, const uint64_t nodes) {
+
+    for (PerfCounter c = 0; c < PC_NB; ++c)
+        if (PerfCounterOpen[c])
+            printf("%-14s %15" PRIu64 " %10.2f per node\n",
+                   PerfCounterNames[c], counts->value[c], (double)counts->value[c] / MAX(nodes, 1));
+
+    if (PerfCounterOpen[PC_CYCLES] && PerfCounterOpen[PC_INSTRUCTIONS])
+        printf("%-14s %15.2f\n", "IPC",
+               (double)counts->value[PC_INSTRUCTIONS] / MAX(counts->value[PC_CYCLES], 1));
+}
+
+static void PrintText(const BenchOptions *opts, const BenchRun *runs, const BenchStats *stats) {
+
+    const BenchRun *last = &runs[opts->runs - 1];
 
     puts("======================================================");
 
-    for (int i = 0; i < FENCount; ++i) {
-        BenchResult *r = &results[i];
+    for (int i = 0; i < opts->count; ++i) {
+        const BenchResult *r = &last->results[i];
         printf("[# %2d] %5d cp  %5s %10" PRIu64 " nodes %10d nps\n",
-               i+1, r->score, MoveToStr(r->best), r->nodes,
-               (int)(1000.0 * r->nodes / (r->elapsed + 1)));
+               i+1, r->score, MoveToStr(r->best), r->nodes, ResultNPS(r));
+        if (opts->perf)
+            PrintPerfLine(&r->counts, r->nodes);
     }
 
     puts("======================================================");
 
+    if (opts->perf) {
+        PrintPerfCounts(&last->counts, last->nodes);
+        puts("======================================================");
+    }
+
+    if (opts->runs > 1) {
+        for (int i = 0; i < opts->runs; ++i)
+            printf("Run %3d: %7" PRIi64 " ms %13" PRIu64 " nodes %10d nps\n",
+                   i + 1, runs[i].elapsed, runs[i].nodes, RunNPS(&runs[i]));
+        printf("NPS    : mean %d median %d stdev %d (%.2f%%)\n",
+               (int)stats->npsMean, (int)stats->npsMedian, (int)stats->npsStdev,
+               100 * stats->npsStdev / MAX(stats->npsMean, 1));
+        puts("======================================================");
+    }
+
+    // Time and nps are means over the runs, the nodes are the signature of the first
     printf("OVERALL: %7" PRIi64 " ms %13" PRIu64 " nodes %10d nps\n",
-           totalElapsed, totalNodes, (int)(1000.0 * totalNodes / totalElapsed));
+           (TimePoint)stats->timeMean, runs[0].nodes, (int)stats->npsMean);
 }
 
-#ifdef DEV
+static void PrintJSONCounts(const BenchOptions *opts, const PerfCounts *counts) {
+
+    if (!opts->perf) return;
+
+    bool first = true;
+
+    printf(", \"counters\": {");
+    for (PerfCounter c = 0; c < PC_NB; ++c)
+        if (PerfCounterOpen[c])
+            printf("%s\"%s\": %" PRIu64, first ? "" : ", ", PerfCounterNames[c], counts->value[c]),
+            first = false;
+    printf("}");
+}
+
+static void PrintJSON(const BenchOptions *opts, const BenchRun *runs, const BenchStats *stats) {
 
-// Helper for Perft()
-static uint64_t RecursivePerft(Position *pos, const Depth depth) {
+    printf("{\n  \"options\": { \"file\": \"%s\", \"positions\": %d, \"depth\": %d, \"nodes\": %" PRIu64
+           ", \"movetime\": %d, \"cleartt\": %s, \"threads\": %d, \"hash\": %d, \"runs\": %d, \"warmup\": %d },\n",
+           opts->file ?: "", opts->count, opts->depth, opts->nodes, opts->movetime, opts->clearTT ? "true" : "false",
+           opts->threads, opts->hashMB, opts->runs, opts->warmup);
+    printf("  \"signature\": %" PRIu64 ",\n", runs[0].nodes);
+    printf("  \"summary\": { \"time_ms\": %.1f, \"nps_mean\": %.0f, \"nps_median\": %.0f, \"nps_stdev\": %.0f },\n",
+           stats->timeMean, stats->npsMean, stats->npsMedian, stats->npsStdev);
+    printf("  \"runs\": [\n");
 
-    if (depth == 0) return 1;
+    for (int i = 0; i < opts->runs; ++i) {
 
-    uint64_t leafnodes = 0;
+        const BenchRun *run = &runs[i];
 
-    MoveList list;
-    list.count = list.next = 0;
-    GenAllMoves(pos, &list);
+        printf("    { \"nodes\": %" PRIu64 ", \"time_ms\": %" PRIi64 ", \"nps\": %d",
+               run->nodes, run->elapsed, RunNPS(run));
+        PrintJSONCounts(opts, &run->counts);
+        printf(", \"positions\": [\n");
 
-    for (int i = 0; i < list.count; i++) {
-        if (!MoveIsLegal(pos, list.moves[i].move)) continue;
-        MakeMove(pos, list.moves[i].move);
-        leafnodes += RecursivePerft(pos, depth - 1);
-        TakeMove(pos);
+        for (int j = 0; j < opts->count; ++j) {
+            const BenchResult *r = &run->results[j];
+            printf("      { \"fen\": \"%s\", \"nodes\": %" PRIu64 ", \"time_ms\": %" PRIi64
+                   ", \"nps\": %d, \"best\": \"%s\", \"score\": %d",
+                   opts->fens[j], r->nodes, r->elapsed, ResultNPS(r), MoveToStr(r->best), r->score);
+            PrintJSONCounts(opts, &r->counts);
+            printf(" }%s\n", j < opts->count - 1 ? "," : "");
+        }
+
+        printf("    ] }%s\n", i < opts->runs - 1 ? "," : "");
     }
 
-    return leafnodes;
+    printf("  ]\n}\n");
 }
 
-// Counts number of moves that can be made in a position to some depth
-void Perft(char *str) {
+// One row per position and run, a row per run with position 'all',
+// and the summary statistics as a trailing comment
+static void PrintCSV(const BenchOptions *opts, const BenchRun *runs, const BenchStats *stats) {
+
+    printf("run,position,fen,nodes,time_ms,nps,best,score");
+    for (PerfCounter c = 0; opts->perf && c < PC_NB; ++c)
+        if (PerfCounterOpen[c])
+            printf(",%s", PerfCounterNames[c]);
+    printf("\n");
+
+    for (int i = 0; i < opts->runs; ++i) {
+
+        const BenchRun *run = &runs[i];
+
+        for (int j = 0; j < opts->count; ++j) {
+            const BenchResult *r = &run->results[j];
+            printf("%d,%d,%s,%" PRIu64 ",%" PRIi64 ",%d,%s,%d",
+                   i + 1, j + 1, opts->fens[j], r->nodes, r->elapsed, ResultNPS(r), MoveToStr(r->best), r->score);
+            for (PerfCounter c = 0; opts->perf && c < PC_NB; ++c)
+                if (PerfCounterOpen[c])
+                    printf(",%" PRIu64, r->counts.value[c]);
+            printf("\n");
+        }
+
+        printf("%d,all,,%" PRIu64 ",%" PRIi64 ",%d,,", i + 1, run->nodes, run->elapsed, RunNPS(run));
+        for (PerfCounter c = 0; opts->perf && c < PC_NB; ++c)
+            if (PerfCounterOpen[c])
+                printf(",%" PRIu64, run->counts.value[c]);
+        printf("\n");
+    }
 
-    char *default_fen = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+    printf("# signature=%" PRIu64 " time_ms=%.1f nps_mean=%.0f nps_median=%.0f nps_stdev=%.0f\n",
+           runs[0].nodes, stats->timeMean, stats->npsMean, stats->npsMedian, stats->npsStdev);
+}
 
-    strtok(str, " ");
-    char *d = strtok(NULL, " ");
-    char *fen = strtok(NULL, "\0") ?: default_fen;
+// Runs the positions with 1, 2, 4 ... threads up to the thread count, comparing
+// each to the single threaded run. Time, nodes and nps are means over the runs,
+// best move agreement and the share of each thread are from the last run.
+// Time-to-depth speedup is only meaningful with a depth limit.
+static void BenchScaling(BenchOptions *opts) {
+
+    const int maxThreads = opts->threads;
+    int counts[32], n = 0;
+
+    for (int t = 1; t < maxThreads; t *= 2)
+        counts[n++] = t;
+    counts[n++] = maxThreads;
+
+    opts->perf = opts->perf && OpenPerfCounters();
+
+    BenchRun runs[n][opts->runs];
+    BenchStats stats[n];
+
+    if (opts->format == BENCH_TEXT)
+        printf("Threads %8s %13s %10s %7s %8s %8s %8s %8s\n",
+               "ms", "nodes", "nps", "stdev", "nps-x", "ttd-x", "overhead", "agree");
+    else if (opts->format == BENCH_CSV) {
+        printf("threads,time_ms,nodes,nps,nps_stdev,nps_speedup,ttd_speedup,node_overhead,bestmove_agreement");
+        for (PerfCounter c = 0; opts->perf && c < PC_NB; ++c)
+            if (PerfCounterOpen[c])
+                printf(",%s", PerfCounterNames[c]);
+        printf("\n");
+    } else
+        puts("{\n  \"scaling\": [");
+
+    for (int i = 0; i < n; ++i) {
+
+        for (int r = 0; r < opts->runs; ++r)
+            runs[i][r].results     = calloc(opts->count, sizeof(BenchResult)),
+            runs[i][r].threadNodes = calloc(counts[i], sizeof(uint64_t));
+
+        opts->threads = counts[i];
+        for (int w = 0; w < opts->warmup; ++w)
+            RunBench(opts, &runs[i][0]);
+        for (int r = 0; r < opts->runs; ++r)
+            RunBench(opts, &runs[i][r]);
+
+        stats[i] = RunStats(runs[i], opts->runs);
+
+        // Compare against the single threaded run
+        const BenchRun *run = &runs[i][opts->runs - 1];
+        int agree = 0;
+        for (int j = 0; j < opts->count; ++j)
+            agree += run->results[j].best == runs[0][opts->runs - 1].results[j].best;
+
+        double npsSpeedup = stats[i].npsMean / MAX(stats[0].npsMean, 1);
+        double ttdSpeedup = MAX(stats[0].timeMean, 1) / MAX(stats[i].timeMean, 1);
+        double overhead   = stats[i].nodesMean / MAX(stats[0].nodesMean, 1);
+
+        if (opts->format == BENCH_TEXT) {
+            printf("%7d %8.0f %13.0f %10.0f %6.2f%% %8.2f %8.2f %8.2f %5d/%d\n",
+                   counts[i], stats[i].timeMean, stats[i].nodesMean, stats[i].npsMean,
+                   100 * stats[i].npsStdev / MAX(stats[i].npsMean, 1),
+                   npsSpeedup, ttdSpeedup, overhead, agree, opts->count);
+            printf("%7s", "");
+            for (int t = 0; t < counts[i]; ++t)
+                printf(" %.1f%%", 100.0 * run->threadNodes[t] / MAX(run->nodes, 1));
+            printf("\n");
+            if (opts->perf)
+                PrintPerfLine(&run->counts, run->nodes);
+
+        } else if (opts->format == BENCH_CSV) {
+            printf("%d,%.1f,%.0f,%.0f,%.0f,%.3f,%.3f,%.3f,%d",
+                   counts[i], stats[i].timeMean, stats[i].nodesMean, stats[i].npsMean, stats[i].npsStdev,
+                   npsSpeedup, ttdSpeedup, overhead, agree);
+            for (PerfCounter c = 0; opts->perf && c < PC_NB; ++c)
+                if (PerfCounterOpen[c])
+                    printf(",%" PRIu64, run->counts.value[c]);
+            printf("\n");
+
+        } else {
+            printf("    { \"threads\": %d, \"time_ms\": %.1f, \"nodes\": %.0f, \"nps\": %.0f, \"nps_stdev\": %.0f"
+                   ", \"nps_speedup\": %.3f, \"ttd_speedup\": %.3f, \"node_overhead\": %.3f"
+                   ", \"bestmove_agreement\": %d",
+                   counts[i], stats[i].timeMean, stats[i].nodesMean, stats[i].npsMean, stats[i].npsStdev,
+                   npsSpeedup, ttdSpeedup, overhead, agree);
+            PrintJSONCounts(opts, &run->counts);
+            printf(", \"thread_nodes\": [");
+            for (int t = 0; t < counts[i]; ++t)
+                printf("%s%" PRIu64, t ? ", " : "", run->threadNodes[t]);
+            printf("] }%s\n", i < n - 1 ? "," : "");
+        }
+
+        fflush(stdout);
+    }
 
-    Depth depth = d ? atoi(d) : 5;
-    ParseFen(fen, &Threads->pos);
+    if (opts->format == BENCH_JSON)
+        printf("  ],\n  \"positions\": %d, \"depth\": %d, \"runs\": %d, \"warmup\": %d\n}\n",
+               opts->count, opts->depth, opts->runs, opts->warmup);
 
-    printf("\nPerft starting:\nDepth : %d\nFEN   : %s\n", depth, fen);
-    fflush(stdout);
+    if (opts->perf)
+        ClosePerfCounters();
+
+    for (int i = 0; i < n; ++i)
+        for (int r = 0; r < opts->runs; ++r)
+            free(runs[i][r].results),
+            free(runs[i][r].threadNodes);
+}
+
+// Runs the positions the requested number of times and prints the results
+static void BenchRuns(BenchOptions *opts) {
+
+    opts->perf = opts->perf && OpenPerfCounters();
 
-    const TimePoint start = Now();
-    uint64_t leafNodes = RecursivePerft(&Threads->pos, depth);
-    const TimePoint elapsed = TimeSince(start) + 1;
+    BenchRun runs[opts->runs];
+    for (int i = 0; i < opts->runs; ++i)
+        runs[i].results = calloc(opts->count, sizeof(BenchResult)),
+        runs[i].threadNodes = NULL;
 
-    printf("\nPerft complete:"
-           "\nTime : %" PRId64 "ms"
-           "\nNPS  : %" PRId64
-           "\nNodes: %" PRIu64 "\n",
-           elapsed, leafNodes * 1000 / elapsed, leafNodes);
+    // Warmup runs reuse the first run's storage and are overwritten
+    for (int i = 0; i < opts->warmup; ++i)
+        RunBench(opts, &runs[0]);
+
+    for (int i = 0; i < opts->runs; ++i)
+        RunBench(opts, &runs[i]);
+
+    BenchStats stats = RunStats(runs, opts->runs);
+
+    if      (opts->format == BENCH_JSON) PrintJSON(opts, runs, &stats);
+    else if (opts->format == BENCH_CSV)  PrintCSV(opts, runs, &stats);
+    else                                PrintText(opts, runs, &stats);
     fflush(stdout);
+
+#ifdef STATS
+    if (opts->format == BENCH_TEXT)
+        puts(""), PrintStats();
+#endif
+
+    if (opts->perf)
+        ClosePerfCounters();
+
+    for (int i = 0; i < opts->runs; ++i)
+        free(runs[i].results);
+}
+
+/* Usage: bench [depth] [threads] [hash] [perf] [scaling] [verbose] [<option>=<value> ...]
+ *
+ * Options: depth, nodes and movetime limit each search, file is a FEN or EPD
+ * file to use instead of the built-in positions, cleartt=false keeps the TT
+ * between positions. Also threads, hash, runs, warmup and format (text, json
+ * or csv).
+ * With perf, hardware counters are read around each search where the
+ * system allows it. The signature is the node count of the first run.
+ * Scaling runs the positions at 1, 2, 4 ... up to threads, by default all
+ * hardware threads, and compares them to the single threaded run. Runs,
+ * warmup and perf apply to each thread count.
+ * Verbose adds a line on the work done in each iteration of each search.
+ * Unknown options print the usage and exit non-zero, as does a file with
+ * no usable positions. */
+int Benchmark(int argc, char **argv) {
+
+    BenchOptions opts;
+    if (!ParseBenchOptions(argc, argv, &opts))
+        return 1;
+
+    if (opts.file && (opts.count = ReadBenchFile(opts.file, &opts.fens)) <= 0) {
+        fprintf(stderr, "No positions read from %s\n", opts.file);
+        free(opts.fens);
+        return 1;
+    }
+
+    Limits.depth     = opts.depth;
+    Limits.nodes     = opts.nodes;
+    Limits.nodeTime  = opts.nodes;
+    Limits.movetime  = opts.movetime;
+    Limits.timelimit = opts.movetime;
+    TT.requestedMB   = opts.hashMB;
+    Silent           = opts.format != BENCH_TEXT || opts.scaling;
+
+    InitThreads(opts.threads);
+    InitTT();
+
+    if (opts.scaling)
+        BenchScaling(&opts);
+    else
+        BenchRuns(&opts);
+
+    if (opts.file) {
+        for (int i = 0; i < opts.count; ++i)
+            free((char *)opts.fens[i]);
+        free(opts.fens);
+    }
+
+    return 0;
+}
+
+/* Microbenchmark of the primitives the search spends its time in, timed over
+ * the bench positions after a few moves have been played from each.
+ *
+ * Usage: microbench [repetitions] */
+
+#define MICRO_PLIES 8
+
+typedef struct MicroPosition {
+    Position pos[2]; // The second holds the moves made in copy-make builds
+    History history[MICRO_PLIES + 1];
+    MoveList legal;
+    MoveList noisy;
+    Key keys[256]; // Keys after each legal move, half of them stored in the TT
+} MicroPosition;
+
+typedef struct Microbenchmark {
+    const char *name;
+    uint64_t (*pass)(void); // One pass over the corpus, returns the operation count
+} Microbenchmark;
+
+static MicroPosition *Corpus;
+static int CorpusSize;
+static volatile uint64_t Sink; // Keeps the results from being optimized away
+
+#define ForEachCorpusPosition(mp, pos) \
+    for (MicroPosition *mp = Corpus; mp < Corpus + CorpusSize; ++mp) \
+        for (Position *pos = mp->pos; pos; pos = NULL)
+
+static uint64_t PassMakeTake() {
+    uint64_t ops = 0;
+    ForEachCorpusPosition(mp, pos)
+        for (int i = 0; i < mp->legal.count; ++i, ++ops)
+            TakeMove(MakeMove(pos, mp->legal.moves[i].move));
+    return ops;
+}
+
+static uint64_t PassGenNoisy() {
+    uint64_t sum = 0, ops = 0;
+    ForEachCorpusPosition(mp, pos) {
+        MoveList list;
+        list.count = list.next = 0;
+        GenNoisyMoves(pos, &list);
+        sum += list.count, ops++;
+    }
+    Sink = sum;
+    return ops;
+}
+
+static uint64_t PassGenQuiet() {
+    uint64_t sum = 0, ops = 0;
+    ForEachCorpusPosition(mp, pos) {
+        MoveList list;
+        list.count = list.next = 0;
+        GenQuietMoves(pos, &list);
+        sum += list.count, ops++;
+    }
+    Sink = sum;
+    return ops;
+}
+
+static uint64_t PassEval() {
+    uint64_t sum = 0, ops = 0;
+    ForEachCorpusPosition(mp, pos)
+        sum += EvalPosition(pos, Threads->pawnCache), ops++;
+    Sink = sum;
+    return ops;
 }
 
+static uint64_t PassSEE() {
+    uint64_t sum = 0, ops = 0;
+    ForEachCorpusPosition(mp, pos)
+        for (int i = 0; i < mp->noisy.count; ++i, ++ops)
+            sum += SEE(pos, mp->noisy.moves[i].move, 0, NULL);
+    Sink = sum;
+    return ops;
+}
+
+static uint64_t PassProbeTT() {
+    uint64_t sum = 0, ops = 0;
+    bool ttHit;
+    ForEachCorpusPosition(mp, pos)
+        for (int i = 0; i < mp->legal.count; ++i, ++ops)
+            sum += (uintptr_t)ProbeTT(mp->keys[i], &ttHit) + ttHit;
+    Sink = sum;
+    return ops;
+}
+
+static uint64_t PassHasCycle() {
+    uint64_t sum = 0, ops = 0;
+    ForEachCorpusPosition(mp, pos)
+        sum += HasCycle(pos, 2), ops++;
+    Sink = sum;
+    return ops;
+}
+
+static uint64_t PassKeyAfter() {
+    uint64_t sum = 0, ops = 0;
+    ForEachCorpusPosition(mp, pos)
+        for (int i = 0; i < mp->legal.count; ++i, ++ops)
+            sum += KeyAfter(pos, mp->legal.moves[i].move);
+    Sink = sum;
+    return ops;
+}
+
+static const Microbenchmark Microbenchmarks[] = {
+    { "MakeMove+TakeMove", PassMakeTake },
+    { "GenNoisyMoves",     PassGenNoisy },
+    { "GenQuietMoves",     PassGenQuiet },
+    { "EvalPosition",      PassEval     },
+    { "SEE",               PassSEE      },
+    { "ProbeTT",           PassProbeTT  },
+    { "HasCycle",          PassHasCycle },
+    { "KeyAfter",          PassKeyAfter },
+};
+
+// Sets up the corpus, playing a few moves from each bench position so
+// there is some history for the repetition checks
+static void InitCorpus() {
+
+    CorpusSize = sizeof(BenchmarkFENs) / sizeof(char *);
+    Corpus = calloc(CorpusSize, sizeof(MicroPosition));
+
+    for (int i = 0; i < CorpusSize; ++i) {
+
+        MicroPosition *mp = &Corpus[i];
+        Position *pos = mp->pos;
+
+        ParseFen(BenchmarkFENs[i], pos);
+        pos->gameHistory = mp->history;
+
+        for (int ply = 0; ply < MICRO_PLIES; ++ply) {
+            mp->legal.count = mp->legal.next = 0;
+            GenAllMoves(pos, &mp->legal);
+            if (!mp->legal.count) break;
+            Position *next = MakeMove(pos, mp->legal.moves[(7 * ply + i) % mp->legal.count].move);
+            if (next != pos) *pos = *next;
+        }
+
+        mp->legal.count = mp->legal.next = 0;
+        GenAllMoves(pos, &mp->legal);
+        mp->noisy.count = mp->noisy.next = 0;
+        GenNoisyMoves(pos, &mp->noisy);
+
+        for (int j = 0; j < mp->legal.count; ++j) {
+            bool ttHit;
+            mp->keys[j] = KeyAfter(pos, mp->legal.moves[j].move);
+            TTEntry *tte = ProbeTT(mp->keys[j], &ttHit);
+            if (j % 2)
+                StoreTTEntry(tte, mp->keys[j], mp->legal.moves[j].move, 0, 0, 1, BOUND_EXACT);
+        }
+    }
+}
+
+// Times each primitive in repetitions of roughly 20ms after a warmup
+void Microbench(int argc, char **argv) {
+
+    const int reps = argc > 2 ? MAX(2, atoi(argv[2])) : 10;
+    const uint64_t repNs = 20000000;
+
+    InitThreads(1);
+    InitTT();
+    InitCorpus();
+
+    printf("Microbench: %d positions, %d repetitions\n\n", CorpusSize, reps);
+    printf("%-18s %10s %10s %10s %10s\n", "", "ns/op", "stdev", "min", "ops/rep");
+    puts("======================================================================");
+
+    for (size_t b = 0; b < sizeof(Microbenchmarks) / sizeof(Microbenchmark); ++b) {
+
+        const Microbenchmark *mb = &Microbenchmarks[b];
+
+        // Warm up and find how many passes make up a repetition
+        uint64_t passes = 0, start = NowNs();
+        while (NowNs() - start < repNs)
+            mb->pass(), passes++;
+
+        double nsPerOp[reps], sum = 0, min = INFINITY;
+        uint64_t ops = 0;
+
+        for (int r = 0; r < reps; ++r) {
+
+            ops = 0, start = NowNs();
+            for (uint64_t p = 0; p < passes; ++p)
+                ops += mb->pass();
+
+            nsPerOp[r] = (double)(NowNs() - start) / MAX(ops, 1);
+            sum += nsPerOp[r];
+            min = MIN(min, nsPerOp[r]);
+        }
+
+        double mean = sum / reps, variance = 0;
+        for (int r = 0; r < reps; ++r)
+            variance += (nsPerOp[r] - mean) * (nsPerOp[r] - mean) / (reps - 1);
+
+        printf("%-18s %10.2f %10.2f %10.2f %10" PRIu64 "\n", mb->name, mean, sqrt(variance), min, ops);
+        fflush(stdout);
+    }
+
+    free(Corpus);
+}
+
+/* Checks that the vector eval terms and the whole eval equal the scalar
+ * ones, over the bench positions and every position one move away from them.
+ *
+ * Usage: simdcheck */
+int SIMDCheck() {
+
+#ifdef SIMD_EVAL
+    int count = 0, failed = 0;
+    History history[2];
+
+    for (size_t i = 0; i < sizeof(BenchmarkFENs) / sizeof(char *); ++i) {
+
+        Position root[2];
+        ParseFen(BenchmarkFENs[i], root);
+        root->gameHistory = history;
+
+        MoveList list;
+        list.count = list.next = 0;
+        GenAllMoves(root, &list);
+
+        for (int j = -1; j < list.count; ++j) {
+
+            Position *pos = j >= 0 ? MakeMove(root, list.moves[j].move) : root;
+
+            count++;
+            if (!SIMDEvalMatches(pos)) {
+                failed++;
+                printf("Mismatch: %s%s%s\n", BenchmarkFENs[i],
+                       j >= 0 ? " moves " : "", j >= 0 ? MoveToStr(list.moves[j].move) : "");
+            }
+
+            if (j >= 0) TakeMove(pos);
+        }
+    }
+
+    printf("SIMD eval: %d positions, %d mismatches\n", count, failed);
+    return failed != 0;
+#else
+    puts("SIMD eval: not in this build");
+    return 0;
+#endif
+}
+
+#ifdef DEV
 void PrintEval(Position *pos) {
     printf("%d\n", EvalPositionWhitePov(pos, Threads->pawnCache));
     fflush(stdout);
@@ -22,9 +22,10 @@
 #include "types.h"
 
 
-void Benchmark(int argc, char **argv);
+int Benchmark(int argc, char **argv);
+void Microbench(int argc, char **argv);
+int SIMDCheck();
 
 #ifdef DEV
-void Perft(char *line);
 void PrintEval(Position *pos);
 #endif
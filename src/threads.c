@@ -44,6 +44,7 @@ void InitThreads(int count) {
 
     // Each thread knows its own index and total thread count
     for (int i = 0; i < count; ++i)
+        Threads[i].pos   = Threads[i].positions,
         Threads[i].index = i,
         Threads[i].count = count;
 }
@@ -67,7 +68,7 @@ void SortRootMoves(Thread *thread, int begin) {
 uint64_t TotalNodes() {
     uint64_t total = 0;
     for (int i = 0; i < Threads->count; ++i)
-        total += Threads[i].pos.nodes;
+        total += Threads[i].pos->nodes;
     return total;
 }
 
@@ -79,12 +80,25 @@ uint64_t TotalTBHits() {
     return total;
 }
 
+// Gives a thread its own copy of the part of the game history that can
+// still repeat, the search continues the history from there
+static void SetSearchHistory(Thread *thread, const Position *pos) {
+
+    int kept = MIN(pos->histPly, MIN(pos->rule50, HISTORY_WINDOW));
+
+    if (kept)
+        memcpy(thread->gameHistory, &pos->gameHistory[pos->histPly - kept], kept * sizeof(History));
+
+    thread->pos->gameHistory = thread->gameHistory;
+    thread->pos->histPly = kept;
+}
+
 // Setup threads for a new search
 void PrepareSearch(Position *pos, Move searchmoves[]) {
 
     MoveList legalMoves;
     legalMoves.count = legalMoves.next = 0;
-    GenLegalMoves(pos, &legalMoves);
+    GenAllMoves(pos, &legalMoves);
 
     RootMove rootMoves[256] = { 0 };
     int rootMoveCount = 0;
@@ -102,7 +116,9 @@ void PrepareSearch(Position *pos, Move searchmoves[]) {
 
     for (Thread *t = Threads; t < Threads + Threads->count; ++t) {
         memset(t, 0, offsetof(Thread, pos));
-        memcpy(&t->pos, pos, sizeof(Position));
+        t->pos = t->positions;
+        memcpy(t->pos, pos, sizeof(Position));
+        SetSearchHistory(t, pos);
         memcpy(t->rootMoves, rootMoves, sizeof(rootMoves));
         t->rootMoveCount = rootMoveCount;
         for (Depth d = 0; d <= MAX_PLY; ++d)
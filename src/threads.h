@@ -22,13 +22,22 @@
 
 #include "board.h"
 #include "evaluate.h"
+#include "stats.h"
 #include "types.h"
 
 
 #define SS_OFFSET 10
+
+// Copy-make builds need a position for each ply
+#ifdef COPY_MAKE
+#define POSITION_STACK (MAX_PLY + 1)
+#else
+#define POSITION_STACK 1
+#endif
 #define MULTI_PV_MAX 64
 #define PAWN_HISTORY_SIZE 512
 #define CORRECTION_HISTORY_SIZE 16384
+#define HISTORY_WINDOW 100 // Moves before the root a search needs for repetitions
 
 typedef int16_t ButterflyHistory[COLOR_NB][64][64];
 typedef int16_t PawnHistory[PAWN_HISTORY_SIZE][PIECE_NB][64];
@@ -64,7 +73,11 @@ typedef struct Thread {
     Stack ss[128];
     jmp_buf jumpBuffer;
     uint64_t tbhits;
+    uint64_t qnodes;
+    uint64_t ttProbes, ttHits;
+    int failHighs, failLows;
     Depth depth;
+    Depth seldepth;
     bool doPruning;
     bool uncertain;
     int multiPV;
@@ -72,7 +85,9 @@ typedef struct Thread {
     RootMove rootMoves[256];
 
     // Anything below here is not zeroed out between searches
-    Position pos;
+    Position *pos; // The searched position, moving up and down the stack in copy-make builds
+    Position positions[POSITION_STACK];
+    History gameHistory[HISTORY_WINDOW + 128];
     PawnCache pawnCache;
     ButterflyHistory history;
     PawnHistory pawnHistory;
@@ -84,6 +99,10 @@ typedef struct Thread {
     CorrectionHistory nonPawnCorrHistory[COLOR_NB];
     ContiuationCorrectionHistory contCorrHistory;
 
+#ifdef STATS
+    SearchStats stats;
+#endif
+
     int index;
     int count;
 
@@ -61,10 +61,10 @@ bool OutOfTime(Thread *thread) {
         ||  thread->depth == 1)
         return false;
 
-    if (Limits.nodeTime && thread->pos.nodes >= Limits.nodes)
+    if (Limits.nodeTime && thread->pos->nodes >= Limits.nodes)
         return true;
 
-    if ((thread->pos.nodes & 2047) != 2047)
+    if ((thread->pos->nodes & 2047) != 2047)
         return false;
 
     int elapsed = TimeSince(Limits.start);
@@ -33,5 +33,12 @@ INLINE int TimeSince(const TimePoint tp) {
     return Now() - tp;
 }
 
+// Nanosecond clock for timing short operations
+INLINE uint64_t NowNs() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000ull + t.tv_nsec;
+}
+
 void InitTimeManagement();
 bool OutOfTime(Thread *thread);
@@ -0,0 +1,100 @@
+/*
+  Weiss is a UCI compliant chess engine.
+  Copyright (C) 2019-2026 Terje Kirstihagen
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/* Generates attacks.c, the pext slider attack tables embedded in the engine.
+ * Standalone so it builds without the tables it makes, run with make tables.
+ *
+ * For each square, bishops first then rooks, the entries are in pext index
+ * order of the occupancy mask. Each holds the attacks compressed to the
+ * squares of the empty board attack set, see Magic in bitboard.h. */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdint.h>
+
+typedef uint64_t Bitboard;
+
+
+// Attacks of a slider, stepping each direction until hitting a piece or the edge
+static Bitboard SliderAttacks(int sq, int bishop, Bitboard occupied) {
+
+    const int dirs[2][4][2] = { { {  1, 0 }, { -1, 0 }, { 0, 1 }, {  0, -1 } },
+                                { {  1, 1 }, {  1,-1 }, {-1, 1 }, { -1, -1 } } };
+    Bitboard attacks = 0;
+
+    for (int d = 0; d < 4; ++d) {
+        int rank = sq / 8 + dirs[bishop][d][0];
+        int file = sq % 8 + dirs[bishop][d][1];
+        for (; 0 <= rank && rank < 8 && 0 <= file && file < 8; rank += dirs[bishop][d][0], file += dirs[bishop][d][1]) {
+            attacks |= 1ull << (8 * rank + file);
+            if (occupied & (1ull << (8 * rank + file))) break;
+        }
+    }
+
+    return attacks;
+}
+
+// Software pext, so the generator runs anywhere
+static uint64_t Extract(Bitboard bb, Bitboard mask) {
+    uint64_t result = 0;
+    for (int bit = 0; mask; mask &= mask - 1, ++bit)
+        if (bb & mask & -mask)
+            result |= 1ull << bit;
+    return result;
+}
+
+static void PrintTable(const char *name, int bishop, int size) {
+
+    int count = 0;
+
+    printf("\nconst uint16_t %s[%d] = {", name, size);
+
+    for (int sq = 0; sq < 64; ++sq) {
+
+        int rank = sq / 8, file = sq % 8;
+        Bitboard edges = ((0xFFull | 0xFF00000000000000ull) & ~(0xFFull << (8 * rank)))
+                       | ((0x0101010101010101ull | 0x8080808080808080ull) & ~(0x0101010101010101ull << file));
+
+        Bitboard rays = SliderAttacks(sq, bishop, 0);
+        Bitboard mask = rays & ~edges;
+
+        // Carry rippler, the subsets come in pext index order
+        Bitboard occupied = 0;
+        do {
+            printf("%s0x%04" PRIx64 ",", count % 12 ? " " : "\n    ", Extract(SliderAttacks(sq, bishop, occupied), rays));
+            occupied = (occupied - mask) & mask;
+            count++;
+        } while (occupied);
+    }
+
+    printf("\n};\n");
+
+    if (count != size)
+        fprintf(stderr, "%s has %d entries, expected %d\n", name, count, size);
+}
+
+int main() {
+
+    puts("// Generated by tools/gentables.c with make tables, do not edit\n");
+    puts("#include \"bitboard.h\"");
+
+    PrintTable("BishopPextAttacks", 1, 5248);
+    PrintTable("RookPextAttacks", 0, 102400);
+
+    return 0;
+}
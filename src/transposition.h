@@ -28,7 +28,7 @@
 #define HASH_MAX ((int)(pow(2, 40) * sizeof(TTBucket) / (1024 * 1024))) // 40 could be set as high as 64
 #define HASH_DEFAULT 32
 
-#define BUCKET_SIZE 2
+#define BUCKET_SIZE 5
 
 #define ValidBound(bound) (bound >= BOUND_UPPER && bound <= BOUND_EXACT)
 #define ValidScore(score) (score >= -MATE && score <= MATE)
@@ -55,8 +55,10 @@ typedef struct {
     uint8_t genBound;
 } TTEntry;
 
+// Five 12 byte entries fill a cache line
 typedef struct {
-    TTEntry entries[2];
+    TTEntry entries[BUCKET_SIZE];
+    char padding[4];
 } TTBucket;
 
 typedef struct {
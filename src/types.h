@@ -57,7 +57,7 @@
 typedef uint64_t Bitboard;
 typedef uint64_t Key;
 
-typedef uint32_t Move;
+typedef uint16_t Move;
 typedef uint32_t Square;
 
 typedef int64_t TimePoint;
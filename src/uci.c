@@ -22,11 +22,15 @@
 #include "pyrrhic/tbprobe.h"
 #include "noobprobe/noobprobe.h"
 #include "onlinesyzygy/onlinesyzygy.h"
+#include "tbgen/tbgen.h"
 #include "tuner/tuner.h"
 #include "board.h"
+#include "cpu.h"
 #include "makemove.h"
 #include "move.h"
+#include "perft.h"
 #include "search.h"
+#include "startup.h"
 #include "tests.h"
 #include "threads.h"
 #include "time.h"
@@ -67,10 +71,32 @@ static void ParseTimeControl(const char *str, const Position *pos) {
 INLINE void Go(Position *pos, char *str) {
     ABORT_SIGNAL = false;
     InitTT();
+    InitTBGen();
     ParseTimeControl(str, pos);
     StartMainThread(SearchPosition, pos);
 }
 
+// Makes sure the game history has room for the next move, it grows
+// with the game as searches only copy the end of it
+static void ReserveGameHistory(Position *pos) {
+
+    static History *gameHistory;
+    static int size;
+
+    if (pos->histPly >= size) {
+        size = MAX(256, 2 * size);
+        gameHistory = realloc(gameHistory, size * sizeof(History));
+
+        // Allocation failed
+        if (!gameHistory) {
+            printf("Failed to allocate game history for %d moves.\n", size);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    pos->gameHistory = gameHistory;
+}
+
 // Parses a 'position' and sets up the board
 static void Pos(Position *pos, char *str) {
 
@@ -79,6 +105,7 @@ static void Pos(Position *pos, char *str) {
     // Set up original position. This will either be a
     // position given as FEN, or the normal start position
     ParseFen(isFen ? str + 13 : START_FEN, pos);
+    ReserveGameHistory(pos);
 
     // Check if there are moves to be made from the initial position
     if ((str = strstr(str, "moves")) == NULL) return;
@@ -87,15 +114,14 @@ static void Pos(Position *pos, char *str) {
     char *move = strtok(str, " ");
     while ((move = strtok(NULL, " "))) {
 
-        // Parse and make move
-        MakeMove(pos, ParseMove(move, pos));
+        // Parse and make move, in a scratch copy with room for the
+        // position after it in copy-make builds
+        Position scratch[2] = { *pos };
+        *pos = *MakeMove(scratch, ParseMove(move, pos));
+        ReserveGameHistory(pos);
 
         // Keep track of how many moves have been played
         pos->gameMoves += sideToMove == WHITE;
-
-        // Reset histPly so long games don't go out of bounds of arrays
-        if (pos->rule50 == 0)
-            pos->histPly = 0;
     }
 
     pos->nodes = 0;
@@ -116,11 +142,14 @@ static void SetOption(char *str) {
     else if (OptionNameIs("SyzygyPath"   )) tb_init(optionValue);
     else if (OptionNameIs("MultiPV"      )) Limits.multiPV = IntValue;
     else if (OptionNameIs("Minimal"      )) Minimal        = BooleanValue;
+    else if (OptionNameIs("Verbose"      )) Verbose        = BooleanValue;
     else if (OptionNameIs("NoobBookLimit")) NoobLimit      = IntValue;
     else if (OptionNameIs("NoobBookMode" )) NoobBookSetMode(optionValue);
     else if (OptionNameIs("NoobBook"     )) NoobBook       = BooleanValue;
     else if (OptionNameIs("UCI_Chess960" )) Chess960       = BooleanValue;
     else if (OptionNameIs("OnlineSyzygy" )) OnlineSyzygy   = BooleanValue;
+    else if (OptionNameIs("TBGenMemory"  )) TBGenMemory    = IntValue;
+    else if (OptionNameIs("TBGen"        )) TBGen          = BooleanValue;
     else puts("info string No such option.");
 
     fflush(stdout);
@@ -144,11 +173,15 @@ static void Info() {
     printf("option name SyzygyPath type string default <empty>\n");
     printf("option name MultiPV type spin default 1 min 1 max %d\n", MULTI_PV_MAX);
     printf("option name Minimal type check default false\n");
+    printf("option name Verbose type check default false\n");
     printf("option name UCI_Chess960 type check default false\n");
     printf("option name NoobBook type check default false\n");
     printf("option name NoobBookMode type string default <best>\n");
     printf("option name NoobBookLimit type spin default 0 min 0 max 1000\n");
     printf("option name OnlineSyzygy type check default false\n");
+    printf("option name TBGen type check default false\n");
+    printf("option name TBGenMemory type spin default %d min 1 max 1024\n", TBGEN_MEMORY_DEFAULT);
+    printf("info string Using %s\n", CPUDescription());
     printf("uciok\n"); fflush(stdout);
 }
 
@@ -162,6 +195,7 @@ static void Stop() {
 // Signals the engine is ready
 static void IsReady() {
     InitTT();
+    InitTBGen();
     puts("readyok");
     fflush(stdout);
 }
@@ -185,9 +219,21 @@ static int HashInput(char *str) {
 // Sets up the engine and follows UCI protocol commands
 int main(int argc, char **argv) {
 
+    // Microbenchmark, checked before bench as the name contains it
+    if (argc > 1 && strstr(argv[1], "microbench"))
+        return Microbench(argc, argv), 0;
+
     // Benchmark
     if (argc > 1 && strstr(argv[1], "bench"))
-        return Benchmark(argc, argv), 0;
+        return Benchmark(argc, argv);
+
+    // Vector eval against the scalar one
+    if (argc > 1 && strstr(argv[1], "simdcheck"))
+        return SIMDCheck();
+
+    // Perft
+    if (argc > 1 && strstr(argv[1], "perft"))
+        return PerftCLI(argc, argv), 0;
 
     // Tuner
 #ifdef TUNE
@@ -197,8 +243,15 @@ int main(int argc, char **argv) {
 
     // Init engine
     InitThreads(1);
+    StartupMark("InitThreads");
     Position pos;
     ParseFen(START_FEN, &pos);
+    ReserveGameHistory(&pos);
+    StartupMark("ParseFen");
+
+    // Report the time spent getting here
+    if (argc > 1 && strstr(argv[1], "--startup-profile"))
+        return StartupProfile(), 0;
 
     // Input loop
     char str[INPUT_SIZE];
@@ -212,11 +265,11 @@ int main(int argc, char **argv) {
             case UCINEWGAME : NewGame();      break;
             case STOP       : Stop();         break;
             case QUIT       : Stop();         return 0;
-#ifdef DEV
             // Non-UCI commands
+            case PERFT      : Perft(str);     break;
+#ifdef DEV
             case EVAL       : PrintEval(&pos);  break;
             case PRINT      : PrintBoard(&pos); break;
-            case PERFT      : Perft(str);       break;
 #endif
         }
     }
@@ -228,21 +281,34 @@ INLINE int MateScore(const int score) {
     return score > 0 ? d : -d;
 }
 
-// Print thinking
-void PrintThinking(const Thread *thread, int alpha, int beta) {
+// Scanning the TT is slow, so hashfull is only sampled once per interval
+static int SampleHashFull(TimePoint elapsed) {
+
+    static TimePoint start, sampled;
+    static int hashFull;
+
+    if (start != Limits.start || elapsed - sampled >= HASHFULL_INTERVAL)
+        start = Limits.start,
+        sampled = elapsed,
+        hashFull = HashFull();
+
+    return hashFull;
+}
+
+// Print thinking, all lines of an update are written at once
+void PrintThinking(const Thread *thread, Depth depth, Depth seldepth, int alpha, int beta) {
+
+    if (Silent) return;
 
-    const Position *pos = &thread->pos;
+    static char buffer[MULTI_PV_MAX * (192 + 6 * MAX_PLY)];
+    char *out = buffer, *end = buffer + sizeof(buffer);
 
     TimePoint elapsed = TimeSince(Limits.start);
     uint64_t nodes    = TotalNodes();
     uint64_t tbhits   = TotalTBHits();
-    int hashFull      = HashFull();
+    int hashFull      = SampleHashFull(elapsed);
     int nps           = (int)(1000 * nodes / (elapsed + 1));
 
-    Depth seldepth = 128;
-    for (; seldepth > 0; --seldepth)
-        if (history(seldepth-1).key != 0) break;
-
     for (int i = 0; i < Limits.multiPV; ++i) {
 
         const PV *pv = &thread->rootMoves[i].pv;
@@ -266,22 +332,79 @@ void PrintThinking(const Thread *thread, int alpha, int beta) {
                                     : score;
 
         // Basic info
-        printf("info depth %d seldepth %d multipv %d score %s %d%s time %" PRId64
+        out += snprintf(out, end - out,
+               "info depth %d seldepth %d multipv %d score %s %d%s time %" PRId64
                " nodes %" PRIu64 " nps %d tbhits %" PRIu64 " hashfull %d pv",
-                thread->depth, seldepth, i+1, type, score, bound, elapsed,
+                depth, seldepth, i+1, type, score, bound, elapsed,
                 nodes, nps, tbhits, hashFull);
 
         // Principal variation
         for (int j = 0; j < pv->length; j++)
-            printf(" %s", MoveToStr(pv->line[j]));
+            out += snprintf(out, end - out, " %s", MoveToStr(pv->line[j]));
 
-        printf("\n");
+        out += snprintf(out, end - out, "\n");
     }
+
+    fwrite(buffer, 1, out - buffer, stdout);
+    fflush(stdout);
+}
+
+// Prints the work done in the last iteration, the node counts of all threads
+// but the re-searches of the main thread only
+void PrintIteration(const Thread *thread) {
+
+    if (Silent) return;
+
+    typedef struct {
+        TimePoint start, time;
+        uint64_t nodes, qnodes, ttProbes, ttHits;
+        int failHighs, failLows;
+    } Totals;
+
+    static Totals prev, prevIter;
+
+    Totals now = {
+        .start     = Limits.start,
+        .time      = TimeSince(Limits.start),
+        .failHighs = thread->failHighs,
+        .failLows  = thread->failLows
+    };
+
+    for (Thread *t = Threads; t < Threads + Threads->count; ++t)
+        now.nodes    += t->pos->nodes,
+        now.qnodes   += t->qnodes,
+        now.ttProbes += t->ttProbes,
+        now.ttHits   += t->ttHits;
+
+    // Start over for each new search
+    if (prev.start != now.start)
+        prev = prevIter = (Totals) { .start = now.start };
+
+    Totals iter = {
+        .time      = now.time      - prev.time,
+        .nodes     = now.nodes     - prev.nodes,
+        .qnodes    = now.qnodes    - prev.qnodes,
+        .ttProbes  = now.ttProbes  - prev.ttProbes,
+        .ttHits    = now.ttHits    - prev.ttHits,
+        .failHighs = now.failHighs - prev.failHighs,
+        .failLows  = now.failLows  - prev.failLows
+    };
+
+    printf("info string iteration depth %d nodes %" PRIu64 " time %" PRId64
+           " ebf %.2f qnodes %.1f%% tthits %.1f%% failhigh %d faillow %d\n",
+           thread->depth, iter.nodes, iter.time,
+           prevIter.nodes ? (double)iter.nodes / prevIter.nodes : 0.0,
+           100.0 * MIN(iter.qnodes, iter.nodes) / MAX(iter.nodes, 1),
+           100.0 * iter.ttHits / MAX(iter.ttProbes, 1),
+           iter.failHighs, iter.failLows);
     fflush(stdout);
+
+    prev = now, prevIter = iter;
 }
 
 // Print conclusion of search
 void PrintBestMove(Move move) {
+    if (Silent) return;
     printf("bestmove %s\n", MoveToStr(move));
     fflush(stdout);
 }
@@ -26,6 +26,8 @@
 #define NAME "Weiss 2.1-dev"
 
 #define START_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+#define HASHFULL_INTERVAL 1000 // ms between samples of the TT load
+#define INFO_INTERVAL       10 // ms between info lines of fast iterations
 #define INPUT_SIZE 8192
 
 
@@ -66,5 +68,6 @@ INLINE void SetLimit(const char *str, const char *token, int *limit) {
         *limit = atoi(ptr + strlen(token));
 }
 
-void PrintThinking(const Thread *thread, int alpha, int beta);
+void PrintThinking(const Thread *thread, Depth depth, Depth seldepth, int alpha, int beta);
+void PrintIteration(const Thread *thread);
 void PrintBestMove(Move move);